@@ -641,28 +641,38 @@ void ComplexGeoData::restoreStream(std::istream& stream, std::size_t count)
 }
 
 void ComplexGeoData::SaveDocFile(Base::Writer& writer) const
+{
+    saveElementMap(writer.Stream());
+}
+
+void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
+{
+    restoreElementMap(reader);
+}
+
+void ComplexGeoData::saveElementMap(std::ostream& stream) const
 {
     flushElementMap();
     if (_elementMap) {
-        writer.Stream() << "BeginElementMap v1\n";
-        _elementMap->save(writer.Stream());
+        stream << "BeginElementMap v1\n";
+        _elementMap->save(stream);
     }
 }
 
-void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
+void ComplexGeoData::restoreElementMap(std::istream& stream)
 {
     std::string marker;
     std::string ver;
-    reader >> marker;
+    stream >> marker;
     if (boost::equals(marker, "BeginElementMap")) {
         resetElementMap();
-        reader >> ver;
+        stream >> ver;
         if (ver != "v1") {
             FC_WARN("Unknown element map format");  // NOLINT
         }
         else {
             resetElementMap(std::make_shared<ElementMap>());
-            _elementMap = _elementMap->restore(Hasher, reader);
+            _elementMap = _elementMap->restore(Hasher, stream);
             return;
         }
     }
@@ -670,7 +680,7 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
     if (count < 0 || count > std::numeric_limits<int>::max()) {
         FC_THROWM(Base::RuntimeError, "Failed to restore element map " << _persistenceName);
     }
-    restoreStream(reader, static_cast<std::size_t>(count));
+    restoreStream(stream, static_cast<std::size_t>(count));
 }
 
 unsigned int ComplexGeoData::getMemSize() const
@@ -601,6 +601,11 @@ public:
     void RestoreDocFile(Base::Reader& reader) override;
     unsigned int getMemSize() const override;
 
+    /// Write the element map to a stream in the layout of SaveDocFile()
+    void saveElementMap(std::ostream& stream) const;
+    /// Restore the element map from a stream written by saveElementMap()
+    void restoreElementMap(std::istream& stream);
+
     /// Set the filename for persistence.
     void setPersistenceFileName(const char* name) const;
 
@@ -22,18 +22,36 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <array>
 #include <boost/core/ignore_unused.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <limits>
+#include <set>
 
+#include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
-#include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
-#include <BRepGProp_Face.hxx>
+#include <BRepTools.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_BezierSurface.hxx>
+#include <Geom_ElementarySurface.hxx>
+#include <Geom_Surface.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
 #include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
+#include <gp_Vec.hxx>
 
 #include <QEventLoop>
 #include <QFuture>
@@ -41,17 +59,22 @@
 #include <QtConcurrentMap>
 
 #include <Base/Console.h>
+#include <Base/Converter.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
+#include <Base/Tools.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/FacetTree.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/TessellationCache.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Points/App/PointsFeature.h>
-#include <Mod/Points/App/PointsGrid.h>
+#include <Mod/Points/App/PointsOctree.h>
 
 #include "InspectionFeature.h"
 
@@ -283,72 +306,82 @@ private:
 };
 }  // namespace Inspection
 
-InspectNominalMesh::InspectNominalMesh(const Mesh::MeshObject& rMesh, float offset)
-    : _mesh(rMesh.getKernel())
+void InspectNominalGeometry::getDistances(
+    const Base::Vector3f* points,
+    std::size_t count,
+    float* dists
+) const
 {
-    Base::Matrix4D tmp;
-    _clTrf = rMesh.getTransform();
-    _bApply = _clTrf != tmp;
+    for (std::size_t i = 0; i < count; i++) {
+        dists[i] = getDistance(points[i]);
+    }
+}
 
-    // Max. limit of grid elements
-    float fMaxGridElements = 8000000.0f;
-    Base::BoundBox3f box = _mesh.GetBoundBox().Transformed(rMesh.getTransform());
+// ----------------------------------------------------------------
 
-    // estimate the minimum allowed grid length
-    float fMinGridLen
-        = (float)pow((box.LengthX() * box.LengthY() * box.LengthZ() / fMaxGridElements), 0.3333f);
-    float fGridLen = 5.0f * MeshCore::MeshAlgorithm(_mesh).GetAverageEdgeLength();
+InspectNominalMesh::InspectNominalMesh(const Mesh::MeshObject& rMesh, float offset)
+    : _offset(offset)
+{
+    const MeshCore::MeshKernel& kernel = rMesh.getKernel();
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    facets.reserve(kernel.CountFacets());
 
-    // We want to avoid to get too small grid elements otherwise building up the grid structure
-    // would take too much time and memory. Having quite a dense grid speeds up more the following
-    // algorithms extremely. Due to the issue above it's always a compromise between speed and
-    // memory usage.
-    fGridLen = std::max<float>(fMinGridLen, fGridLen);
+    MeshCore::MeshFacetIterator clFIter(kernel);
+    clFIter.Transform(rMesh.getTransform());
+    for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
+        facets.push_back(*clFIter);
+    }
 
-    // build up grid structure to speed up algorithms
-    _pGrid = new MeshInspectGrid(_mesh, fGridLen, rMesh.getTransform());
-    _box = box;
-    _box.Enlarge(offset);
+    // build up the search structure in parallel, the queries are done from several threads
+    _pTree = new MeshCore::MeshFacetTree(facets);
+    // the caller already distributes the batches over the thread pool
+    _pTree->SetThreads(1);
 }
 
 InspectNominalMesh::~InspectNominalMesh()
 {
-    delete this->_pGrid;
+    delete this->_pTree;
 }
 
 float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
 {
-    if (!_box.IsInBox(point)) {
-        return std::numeric_limits<float>::max();  // must be inside bbox
+    // points farther away than the search radius are rejected anyway
+    Base::Vector3f nearest;
+    float fMinDist = std::numeric_limits<float>::max();
+    MeshCore::FacetIndex index = _pTree->FindNearest(point, _offset, nearest, fMinDist);
+    if (index == MeshCore::FACET_INDEX_MAX) {
+        return std::numeric_limits<float>::max();
     }
 
-    std::vector<unsigned long> indices;
-    //_pGrid->GetElements(point, indices);
-    if (indices.empty()) {
-        std::set<unsigned long> inds;
-        _pGrid->MeshGrid::SearchNearestFromPoint(point, inds);
-        indices.insert(indices.begin(), inds.begin(), inds.end());
+    const MeshCore::MeshGeomFacet& geomFace = _pTree->GetFacet(index);
+    if (point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) <= 0) {
+        fMinDist = -fMinDist;
     }
+    return fMinDist;
+}
 
-    float fMinDist = std::numeric_limits<float>::max();
-    bool positive = true;
-    for (unsigned long it : indices) {
-        MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(it);
-        if (_bApply) {
-            geomFace.Transform(_clTrf);
+void InspectNominalMesh::getDistances(
+    const Base::Vector3f* points,
+    std::size_t count,
+    float* dists
+) const
+{
+    std::vector<Base::Vector3f> queries(points, points + count);
+    std::vector<MeshCore::FacetIndex> indices;
+    std::vector<float> minDists;
+    _pTree->FindNearest(queries, _offset, indices, minDists);
+
+    for (std::size_t i = 0; i < count; i++) {
+        dists[i] = minDists[i];
+        if (indices[i] == MeshCore::FACET_INDEX_MAX) {
+            continue;
         }
 
-        float fDist = geomFace.DistanceToPoint(point);
-        if (fabs(fDist) < fabs(fMinDist)) {
-            fMinDist = fDist;
-            positive = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) > 0;
+        const MeshCore::MeshGeomFacet& geomFace = _pTree->GetFacet(indices[i]);
+        if (points[i].DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) <= 0) {
+            dists[i] = -dists[i];
         }
     }
-
-    if (!positive) {
-        fMinDist = -fMinDist;
-    }
-    return fMinDist;
 }
 
 // ----------------------------------------------------------------
@@ -440,120 +473,264 @@ float InspectNominalFastMesh::getDistance(const Base::Vector3f& point) const
 // ----------------------------------------------------------------
 
 InspectNominalPoints::InspectNominalPoints(const Points::PointKernel& Kernel, float /*offset*/)
-    : _rKernel(Kernel)
 {
-    int uGridPerAxis = 50;  // totally 125.000 grid elements
-    this->_pGrid = new Points::PointsGrid(Kernel, uGridPerAxis);
+    // the octree works on the transformed points
+    _points.reserve(Kernel.size());
+    for (const auto& pnt : Kernel) {
+        _points.push_back(Base::convertTo<Base::Vector3f>(pnt));
+    }
+    this->_pOctree = new Points::PointsOctree(_points);
 }
 
 InspectNominalPoints::~InspectNominalPoints()
 {
-    delete this->_pGrid;
+    delete this->_pOctree;
 }
 
 float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 {
-    // TODO: Make faster
-    std::set<unsigned long> indices;
-    unsigned long x, y, z;
-    Base::Vector3d pointd(point.x, point.y, point.z);
-    _pGrid->Position(pointd, x, y, z);
-    _pGrid->GetElements(x, y, z, indices);
-
-    double fMinDist = std::numeric_limits<double>::max();
-    for (unsigned long it : indices) {
-        Base::Vector3d pt = _rKernel.getPoint(it);
-        double fDist = Base::Distance(pointd, pt);
-        if (fDist < fMinDist) {
-            fMinDist = fDist;
-        }
-    }
-
-    return (float)fMinDist;
+    unsigned long index {};
+    float fMinDist = std::numeric_limits<float>::max();
+    _pOctree->FindNearest(_points, point, std::numeric_limits<float>::max(), index, fMinDist);
+    return fMinDist;
 }
 
 // ----------------------------------------------------------------
 
-InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radius*/)
-    : _rShape(shape)
+struct InspectNominalShape::FaceData
 {
-    distss = new BRepExtrema_DistShapeShape();
-    distss->LoadS1(_rShape);
+    Handle(Geom_Surface) surface;
+    bool reversed {false};
+    Standard_Real u1 {0}, u2 {0}, v1 {0}, v2 {0};
+    std::vector<gp_Pnt2d> uvNodes;
+    // swept and offset surfaces are evaluated with the help of an adaptor that caches its
+    // last result, so they must not be evaluated from several threads at once
+    std::shared_ptr<std::mutex> lock;
+};
 
-    // When having a solid then use its shell because otherwise the distance
-    // for inner points will always be zero
-    if (!_rShape.IsNull() && _rShape.ShapeType() == TopAbs_SOLID) {
-        TopExp_Explorer xp;
-        xp.Init(_rShape, TopAbs_SHELL);
-        if (xp.More()) {
-            distss->LoadS1(xp.Current());
-            isSolid = true;
-        }
+struct InspectNominalShape::FacetData
+{
+    std::size_t face;
+    std::array<int, 3> nodes;
+};
+
+InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float offset)
+    : _pShape(new TopoDS_Shape(shape))
+    , _pTree(new MeshCore::MeshFacetTree())
+    , _offset(offset)
+{
+    if (_pShape->IsNull()) {
+        return;
+    }
+
+    // only tessellate the faces that are not meshed yet, the triangles are just needed to
+    // find the nearest face and a start value for the projection onto its surface
+    Bnd_Box bounds;
+    BRepBndLib::Add(*_pShape, bounds);
+    double deflection = 0.001;
+    if (!bounds.IsVoid()) {
+        deflection = std::max(deflection, 0.001 * std::sqrt(bounds.SquareExtent()));
     }
-    // distss->SetDeflection(radius);
+
+    fetchFacets(deflection);
 }
 
 InspectNominalShape::~InspectNominalShape()
 {
-    delete distss;
+    delete _pTree;
+    delete _pShape;
 }
 
-float InspectNominalShape::getDistance(const Base::Vector3f& point) const
+void InspectNominalShape::fetchFacets(double deflection)
 {
-    gp_Pnt pnt3d(point.x, point.y, point.z);
-    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
-    distss->LoadS2(mkVert.Vertex());
+    bool needsMesh = false;
+    for (TopExp_Explorer xp(*_pShape, TopAbs_FACE); xp.More() && !needsMesh; xp.Next()) {
+        TopLoc_Location loc;
+        needsMesh = BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull();
+    }
+    if (needsMesh) {
+        Part::TessellationCache::instance().mesh(*_pShape, deflection, 0.5);
+    }
 
-    float fMinDist = std::numeric_limits<float>::max();
-    if (distss->Perform() && distss->NbSolution() > 0) {
-        fMinDist = (float)distss->Value();
-        // the shape is a solid, check if the vertex is inside
-        if (isSolid) {
-            if (isInsideSolid(pnt3d)) {
-                fMinDist = -fMinDist;
+    std::vector<MeshCore::MeshGeomFacet> triangles;
+    for (TopExp_Explorer xp(*_pShape, TopAbs_FACE); xp.More(); xp.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(xp.Current());
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+        if (mesh.IsNull()) {
+            continue;
+        }
+
+        FaceData data;
+        data.surface = BRep_Tool::Surface(face);
+        if (!data.surface.IsNull() && !data.surface->IsKind(STANDARD_TYPE(Geom_ElementarySurface))
+            && !data.surface->IsKind(STANDARD_TYPE(Geom_BSplineSurface))
+            && !data.surface->IsKind(STANDARD_TYPE(Geom_BezierSurface))) {
+            data.lock = std::make_shared<std::mutex>();
+        }
+        data.reversed = face.Orientation() == TopAbs_REVERSED;
+        BRepTools::UVBounds(face, data.u1, data.u2, data.v1, data.v2);
+        if (mesh->HasUVNodes() && !data.surface.IsNull()) {
+            data.uvNodes.reserve(mesh->NbNodes());
+            for (Standard_Integer i = 1; i <= mesh->NbNodes(); i++) {
+                data.uvNodes.push_back(mesh->UVNode(i));
             }
         }
-        else if (fMinDist > 0) {
-            // check if the distance was computed from a face
-            if (isBelowFace(pnt3d)) {
-                fMinDist = -fMinDist;
+        _deflection = std::max(_deflection, static_cast<float>(mesh->Deflection()));
+
+        const gp_Trsf& trsf = loc.Transformation();
+        for (Standard_Integer i = 1; i <= mesh->NbTriangles(); i++) {
+            int n1 {}, n2 {}, n3 {};
+            mesh->Triangle(i).Get(n1, n2, n3);
+            // let the triangle normals point outwards
+            if (data.reversed) {
+                std::swap(n2, n3);
             }
+
+            gp_Pnt p1 = mesh->Node(n1).Transformed(trsf);
+            gp_Pnt p2 = mesh->Node(n2).Transformed(trsf);
+            gp_Pnt p3 = mesh->Node(n3).Transformed(trsf);
+            triangles.emplace_back(
+                Base::convertTo<Base::Vector3f>(p1),
+                Base::convertTo<Base::Vector3f>(p2),
+                Base::convertTo<Base::Vector3f>(p3)
+            );
+            _facets.push_back(FacetData {_faces.size(), {n1 - 1, n2 - 1, n3 - 1}});
         }
+
+        _faces.push_back(std::move(data));
     }
-    return fMinDist;
-}
 
-bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
-{
-    const Standard_Real tol = 0.001;
-    BRepClass3d_SolidClassifier classifier(_rShape);
-    classifier.Perform(pnt3d, tol);
-    return (classifier.State() == TopAbs_IN);
+    _pTree->Build(triangles);
 }
 
-bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
+bool InspectNominalShape::refineOnFace(
+    std::size_t facet,
+    const Base::Vector3f& point,
+    const Base::Vector3f& nearest,
+    float& dist
+) const
 {
-    // check if the distance was computed from a face
-    for (Standard_Integer index = 1; index <= distss->NbSolution(); index++) {
-        if (distss->SupportTypeShape1(index) == BRepExtrema_IsInFace) {
-            TopoDS_Shape face = distss->SupportOnShape1(index);
-            Standard_Real u, v;
-            distss->ParOnFaceS1(index, u, v);
-            // gp_Pnt pnt = distss->PointOnShape1(index);
-            BRepGProp_Face props(TopoDS::Face(face));
-            gp_Vec normal;
-            gp_Pnt center;
-            props.Normal(u, v, center, normal);
-            gp_Vec dir(center, pnt3d);
-            Standard_Real scalar = normal.Dot(dir);
-            if (scalar < 0) {
-                return true;
-            }
+    const FacetData& data = _facets[facet];
+    const FaceData& face = _faces[data.face];
+    if (face.uvNodes.empty()) {
+        return false;
+    }
+
+    // interpolate the start value from the parameters of the triangle corners
+    const MeshCore::MeshGeomFacet& triangle = _pTree->GetFacet(MeshCore::FacetIndex(facet));
+    float w0 {}, w1 {}, w2 {};
+    if (!triangle.Weights(nearest, w0, w1, w2)) {
+        w0 = w1 = w2 = 1.0F / 3.0F;
+    }
+    const gp_Pnt2d& uv0 = face.uvNodes[data.nodes[0]];
+    const gp_Pnt2d& uv1 = face.uvNodes[data.nodes[1]];
+    const gp_Pnt2d& uv2 = face.uvNodes[data.nodes[2]];
+    Standard_Real u = w0 * uv0.X() + w1 * uv1.X() + w2 * uv2.X();
+    Standard_Real v = w0 * uv0.Y() + w1 * uv1.Y() + w2 * uv2.Y();
+
+    std::unique_lock<std::mutex> guard;
+    if (face.lock) {
+        guard = std::unique_lock<std::mutex>(*face.lock);
+    }
+
+    // Gauss-Newton iteration for the foot point on the surface
+    gp_Pnt pnt(point.x, point.y, point.z);
+    gp_Pnt foot;
+    gp_Vec du, dv;
+    const Standard_Real tol = Precision::PConfusion();
+    for (int iter = 0; iter < 8; iter++) {
+        face.surface->D1(u, v, foot, du, dv);
+        gp_Vec res(foot, pnt);
+        Standard_Real a11 = du.Dot(du);
+        Standard_Real a12 = du.Dot(dv);
+        Standard_Real a22 = dv.Dot(dv);
+        Standard_Real det = a11 * a22 - a12 * a12;
+        if (det <= Precision::SquareConfusion() * a11 * a22) {
             break;
         }
+
+        Standard_Real b1 = du.Dot(res);
+        Standard_Real b2 = dv.Dot(res);
+        Standard_Real deltaU = (a22 * b1 - a12 * b2) / det;
+        Standard_Real deltaV = (a11 * b2 - a12 * b1) / det;
+        u = std::clamp(u + deltaU, face.u1, face.u2);
+        v = std::clamp(v + deltaV, face.v1, face.v2);
+        if (std::fabs(deltaU) < tol && std::fabs(deltaV) < tol) {
+            break;
+        }
+    }
+
+    face.surface->D1(u, v, foot, du, dv);
+    Base::Vector3f footPoint = Base::convertTo<Base::Vector3f>(foot);
+
+    // The surface isn't trimmed to the face boundary, so reject foot points that have left
+    // the neighbourhood of the triangle. Then the triangle gives the better approximation.
+    float size = std::max({
+        Base::Distance(triangle._aclPoints[0], triangle._aclPoints[1]),
+        Base::Distance(triangle._aclPoints[1], triangle._aclPoints[2]),
+        Base::Distance(triangle._aclPoints[2], triangle._aclPoints[0]),
+    });
+    if (Base::Distance(footPoint, nearest) > size + _deflection) {
+        return false;
+    }
+
+    gp_Vec normal = du.Crossed(dv);
+    if (face.reversed) {
+        normal.Reverse();
+    }
+    if (normal.SquareMagnitude() <= Precision::SquareConfusion()) {
+        return false;
+    }
+
+    gp_Vec dir(foot, pnt);
+    dist = static_cast<float>(dir.Magnitude());
+    if (normal.Dot(dir) < 0) {
+        dist = -dist;
+    }
+    return true;
+}
+
+float InspectNominalShape::getDistanceToEdges(const Base::Vector3f& point) const
+{
+    // a shape without faces has no inside, so the distance is always positive
+    BRepExtrema_DistShapeShape distss;
+    distss.LoadS1(*_pShape);
+    distss.LoadS2(BRepBuilderAPI_MakeVertex(gp_Pnt(point.x, point.y, point.z)).Vertex());
+    if (distss.Perform() && distss.NbSolution() > 0) {
+        return static_cast<float>(distss.Value());
+    }
+    return std::numeric_limits<float>::max();
+}
+
+float InspectNominalShape::getDistance(const Base::Vector3f& point) const
+{
+    if (_pShape->IsNull()) {
+        return std::numeric_limits<float>::max();
+    }
+    if (_pTree->IsEmpty()) {
+        return getDistanceToEdges(point);
+    }
+
+    // the triangles deviate from the surface by up to the deflection
+    Base::Vector3f nearest;
+    float fMinDist = std::numeric_limits<float>::max();
+    MeshCore::FacetIndex index
+        = _pTree->FindNearest(point, _offset + 2.0F * _deflection, nearest, fMinDist);
+    if (index == MeshCore::FACET_INDEX_MAX) {
+        return std::numeric_limits<float>::max();
+    }
+
+    float fDist {};
+    if (refineOnFace(index, point, nearest, fDist)) {
+        return fDist;
     }
 
-    return false;
+    const MeshCore::MeshGeomFacet& geomFace = _pTree->GetFacet(index);
+    if (point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) < 0) {
+        fMinDist = -fMinDist;
+    }
+    return fMinDist;
 }
 
 // ----------------------------------------------------------------
@@ -763,7 +940,101 @@ public:
 
 PROPERTY_SOURCE(Inspection::Feature, App::DocumentObject)
 
+namespace
+{
+std::size_t meshFingerprint(const Mesh::MeshObject& mesh)
+{
+    std::size_t seed = 0;
+    const MeshCore::MeshKernel& kernel = mesh.getKernel();
+    for (const auto& it : kernel.GetPoints()) {
+        Base::hash_combine(seed, it.x);
+        Base::hash_combine(seed, it.y);
+        Base::hash_combine(seed, it.z);
+    }
+    for (const auto& it : kernel.GetFacets()) {
+        for (auto index : it._aulPoints) {
+            Base::hash_combine(seed, index);
+        }
+    }
+    Base::Matrix4D mat = mesh.getTransform();
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            Base::hash_combine(seed, mat[i][j]);
+        }
+    }
+    return seed;
+}
+
+std::size_t pointsFingerprint(const Points::PointKernel& kernel)
+{
+    // the iterator delivers the transformed points
+    std::size_t seed = 0;
+    for (const auto& it : kernel) {
+        Base::hash_combine(seed, it.x);
+        Base::hash_combine(seed, it.y);
+        Base::hash_combine(seed, it.z);
+    }
+    return seed;
+}
+}  // namespace
+
+/*
+ * Building the search structures of the nominals is the expensive part of an inspection. As
+ * long as a nominal doesn't change they are kept, so that e.g. moving the actual geometry only
+ * recomputes the distances. Meshes and points are compared by their content, shapes by their
+ * identity.
+ */
+struct Feature::NominalCache
+{
+    struct Entry
+    {
+        std::size_t fingerprint {0};
+        float offset {0.0F};
+        TopoDS_Shape shape;
+        std::unique_ptr<InspectNominalGeometry> geometry;
+    };
+
+    std::map<const App::DocumentObject*, Entry> entries;
+};
+
+InspectNominalGeometry* Feature::getNominal(App::DocumentObject* obj)
+{
+    float offset = static_cast<float>(this->SearchRadius.getValue());
+    NominalCache::Entry& entry = nominalCache->entries[obj];
+
+    if (obj->isDerivedFrom<Mesh::Feature>()) {
+        const Mesh::MeshObject& mesh = static_cast<Mesh::Feature*>(obj)->Mesh.getValue();
+        std::size_t fingerprint = meshFingerprint(mesh);
+        if (!entry.geometry || entry.fingerprint != fingerprint || entry.offset != offset) {
+            entry.geometry = std::make_unique<InspectNominalMesh>(mesh, offset);
+            entry.fingerprint = fingerprint;
+        }
+    }
+    else if (obj->isDerivedFrom<Points::Feature>()) {
+        const Points::PointKernel& kernel = static_cast<Points::Feature*>(obj)->Points.getValue();
+        std::size_t fingerprint = pointsFingerprint(kernel);
+        if (!entry.geometry || entry.fingerprint != fingerprint) {
+            entry.geometry = std::make_unique<InspectNominalPoints>(kernel, offset);
+            entry.fingerprint = fingerprint;
+        }
+    }
+    else if (obj->isDerivedFrom<Part::Feature>()) {
+        TopoDS_Shape shape = static_cast<Part::Feature*>(obj)->Shape.getValue();
+        if (!entry.geometry || !entry.shape.IsEqual(shape) || entry.offset != offset) {
+            entry.geometry = std::make_unique<InspectNominalShape>(shape, offset);
+            entry.shape = shape;
+        }
+    }
+    else {
+        entry.geometry.reset();
+    }
+
+    entry.offset = offset;
+    return entry.geometry.get();
+}
+
 Feature::Feature()
+    : nominalCache(std::make_unique<NominalCache>())
 {
     ADD_PROPERTY(SearchRadius, (0.05));
     ADD_PROPERTY(Thickness, (0.0));
@@ -793,8 +1064,6 @@ short Feature::mustExecute() const
 
 App::DocumentObjectExecReturn* Feature::execute()
 {
-    bool useMultithreading = true;
-
     App::DocumentObject* pcActual = Actual.getValue();
     if (!pcActual) {
         throw Base::ValueError("No actual geometry to inspect specified");
@@ -810,7 +1079,6 @@ App::DocumentObjectExecReturn* Feature::execute()
         actual = new InspectActualPoints(pts->Points.getValue());
     }
     else if (pcActual->isDerivedFrom<Part::Feature>()) {
-        useMultithreading = false;
         Part::Feature* part = static_cast<Part::Feature*>(pcActual);
         actual = new InspectActualShape(part->Shape.getShape());
     }
@@ -818,31 +1086,23 @@ App::DocumentObjectExecReturn* Feature::execute()
         throw Base::TypeError("Unknown geometric type");
     }
 
-    // clang-format off
-    // get a list of nominals
+    // get a list of nominals and drop the cached ones that are not used any more
     std::vector<InspectNominalGeometry*> inspectNominal;
     const std::vector<App::DocumentObject*>& nominals = Nominals.getValues();
-    for (auto it : nominals) {
-        InspectNominalGeometry* nominal = nullptr;
-        if (it->isDerivedFrom<Mesh::Feature>()) {
-            Mesh::Feature* mesh = static_cast<Mesh::Feature*>(it);
-            nominal = new InspectNominalMesh(mesh->Mesh.getValue(), this->SearchRadius.getValue());
-        }
-        else if (it->isDerivedFrom<Points::Feature>()) {
-            Points::Feature* pts = static_cast<Points::Feature*>(it);
-            nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
+    std::set<const App::DocumentObject*> used(nominals.begin(), nominals.end());
+    for (auto it = nominalCache->entries.begin(); it != nominalCache->entries.end();) {
+        if (used.count(it->first) == 0) {
+            it = nominalCache->entries.erase(it);
         }
-        else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
-            Part::Feature* part = static_cast<Part::Feature*>(it);
-            nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
+        else {
+            ++it;
         }
-
-        if (nominal) {
+    }
+    for (auto it : nominals) {
+        if (InspectNominalGeometry* nominal = getNominal(it)) {
             inspectNominal.push_back(nominal);
         }
     }
-    // clang-format on
 
 #if 0
 # if 1  // test with some huge data sets
@@ -899,86 +1159,88 @@ App::DocumentObjectExecReturn* Feature::execute()
     Base::Console().message("RMS value for '%s' with search radius [%.4f,%.4f] is: %.4f\n",
         this->Label.getValue(), -this->SearchRadius.getValue(), this->SearchRadius.getValue(), fRMS);
 #else
+    // collect the actual points once, the nominals are then processed chunk by chunk
     unsigned long count = actual->countPoints();
+    std::vector<Base::Vector3f> points(count);
+    for (unsigned long index = 0; index < count; index++) {
+        points[index] = actual->getPoint(index);
+    }
+
+    const std::size_t chunkSize = 4096;
+    std::vector<std::size_t> chunks((points.size() + chunkSize - 1) / chunkSize);
+    std::iota(chunks.begin(), chunks.end(), 0);
+
     std::vector<float> vals(count);
-    std::function<DistanceInspectionRMS(int)> fMap = [&](unsigned int index) {
+    float radius = static_cast<float>(this->SearchRadius.getValue());
+    std::function<DistanceInspectionRMS(std::size_t)> fMap = [&](std::size_t chunk) {
         DistanceInspectionRMS res;
-        Base::Vector3f pnt = actual->getPoint(index);
+        std::size_t begin = chunk * chunkSize;
+        std::size_t size = std::min(chunkSize, points.size() - begin);
 
-        float fMinDist = std::numeric_limits<float>::max();
+        float* minDists = &vals[begin];
+        std::fill(minDists, minDists + size, std::numeric_limits<float>::max());
+        std::vector<float> dists(size);
         for (auto it : inspectNominal) {
-            float fDist = it->getDistance(pnt);
-            if (fabs(fDist) < fabs(fMinDist)) {
-                fMinDist = fDist;
+            it->getDistances(&points[begin], size, dists.data());
+            for (std::size_t i = 0; i < size; i++) {
+                if (fabs(dists[i]) < fabs(minDists[i])) {
+                    minDists[i] = dists[i];
+                }
             }
         }
 
-        if (fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = std::numeric_limits<float>::max();
-        }
-        else if (-fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = -std::numeric_limits<float>::max();
-        }
-        else {
-            res.m_sumsq += static_cast<double>(fMinDist) * static_cast<double>(fMinDist);
-            res.m_numv++;
+        for (std::size_t i = 0; i < size; i++) {
+            float fMinDist = minDists[i];
+            if (fMinDist > radius) {
+                fMinDist = std::numeric_limits<float>::max();
+            }
+            else if (-fMinDist > radius) {
+                fMinDist = -std::numeric_limits<float>::max();
+            }
+            else {
+                res.m_sumsq += static_cast<double>(fMinDist) * static_cast<double>(fMinDist);
+                res.m_numv++;
+            }
+            minDists[i] = fMinDist;
         }
 
-        vals[index] = fMinDist;
         return res;
     };
 
-    DistanceInspectionRMS res;
-
-    if (useMultithreading) {
-        // Build vector of increasing indices
-        std::vector<unsigned long> index(count);
-        std::iota(index.begin(), index.end(), 0);
-        // Perform map-reduce operation : compute distances and update sum of squares for RMS
-        // computation
-        QFuture<DistanceInspectionRMS> future
-            = QtConcurrent::mappedReduced(index, fMap, &DistanceInspectionRMS::operator+=);
-        // Setup progress bar
-        Base::SequencerLauncher seq("Inspecting...", 100);
-        unsigned int currentStep = 0;
-        const unsigned int steps = static_cast<unsigned int>(actual->countPoints());
-        QFutureWatcher<DistanceInspectionRMS> watcher;
-        QObject::connect(
-            &watcher,
-            &QFutureWatcher<DistanceInspectionRMS>::progressValueChanged,
-            [&](int value) {
-                if (steps == 0) {
-                    return;
-                }
-                const unsigned int step = (100U * static_cast<unsigned int>(value)) / steps;
-                if (step > currentStep) {
-                    currentStep = step;
-                    seq.next();
-                }
+    // Perform map-reduce operation : compute distances and update sum of squares for RMS
+    // computation
+    QFuture<DistanceInspectionRMS> future
+        = QtConcurrent::mappedReduced(chunks, fMap, &DistanceInspectionRMS::operator+=);
+    // Setup progress bar
+    Base::SequencerLauncher seq("Inspecting...", 100);
+    unsigned int currentStep = 0;
+    const auto steps = static_cast<unsigned int>(chunks.size());
+    QFutureWatcher<DistanceInspectionRMS> watcher;
+    QObject::connect(
+        &watcher,
+        &QFutureWatcher<DistanceInspectionRMS>::progressValueChanged,
+        [&](int value) {
+            if (steps == 0) {
+                return;
+            }
+            const unsigned int step = (100U * static_cast<unsigned int>(value)) / steps;
+            if (step > currentStep) {
+                currentStep = step;
+                seq.next();
             }
-        );
-        // Keep UI responsive during computation
-        QEventLoop loop;
-        QObject::connect(
-            &watcher,
-            &QFutureWatcher<DistanceInspectionRMS>::finished,
-            &loop,
-            &QEventLoop::quit
-        );
-        watcher.setFuture(future);
-        loop.exec();
-        res = future.result();
-    }
-    else {
-        // Single-threaded operation
-        std::stringstream str;
-        str << "Inspecting " << this->Label.getValue() << "…";
-        Base::SequencerLauncher seq(str.str().c_str(), count);
-
-        for (unsigned int i = 0; i < count; i++) {
-            res += fMap(i);
         }
-    }
+    );
+    // Keep UI responsive during computation
+    QEventLoop loop;
+    QObject::connect(
+        &watcher,
+        &QFutureWatcher<DistanceInspectionRMS>::finished,
+        &loop,
+        &QEventLoop::quit
+    );
+    watcher.setFuture(future);
+    loop.exec();
+    DistanceInspectionRMS res = future.result();
 
     Base::Console().message(
         "RMS value for '%s' with search radius [%.4f,%.4f] is: %.4f\n",
@@ -991,9 +1253,6 @@ App::DocumentObjectExecReturn* Feature::execute()
 #endif
 
     delete actual;
-    for (auto it : inspectNominal) {
-        delete it;
-    }
 
     return nullptr;
 }
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
 
@@ -32,13 +34,12 @@
 
 
 class TopoDS_Shape;
-class BRepExtrema_DistShapeShape;
-class gp_Pnt;
 
 namespace MeshCore
 {
 class MeshKernel;
 class MeshGrid;
+class MeshFacetTree;
 }  // namespace MeshCore
 
 namespace Mesh
@@ -47,7 +48,7 @@ class MeshObject;
 }
 namespace Points
 {
-class PointsGrid;
+class PointsOctree;
 }
 namespace Part
 {
@@ -115,6 +116,8 @@ public:
     InspectNominalGeometry() = default;
     virtual ~InspectNominalGeometry() = default;
     virtual float getDistance(const Base::Vector3f&) const = 0;
+    /// Calculates the distances of \a count points at once and writes them to \a dists
+    virtual void getDistances(const Base::Vector3f* points, std::size_t count, float* dists) const;
 };
 
 class InspectionExport InspectNominalMesh: public InspectNominalGeometry
@@ -123,13 +126,12 @@ public:
     InspectNominalMesh(const Mesh::MeshObject& rMesh, float offset);
     ~InspectNominalMesh() override;
     float getDistance(const Base::Vector3f&) const override;
+    void getDistances(const Base::Vector3f* points, std::size_t count, float* dists) const override;
 
 private:
-    const MeshCore::MeshKernel& _mesh;
-    MeshCore::MeshGrid* _pGrid;
-    Base::BoundBox3f _box;
-    bool _bApply;
-    Base::Matrix4D _clTrf;
+    // the tree keeps a copy of the transformed facets
+    MeshCore::MeshFacetTree* _pTree;
+    float _offset;
 };
 
 class InspectionExport InspectNominalFastMesh: public InspectNominalGeometry
@@ -156,10 +158,15 @@ public:
     float getDistance(const Base::Vector3f&) const override;
 
 private:
-    const Points::PointKernel& _rKernel;
-    Points::PointsGrid* _pGrid;
+    std::vector<Base::Vector3f> _points;
+    Points::PointsOctree* _pOctree;
 };
 
+/**
+ * The shape is tessellated once and its triangles are put into a bounding volume hierarchy.
+ * The nearest triangle of a point only gives a first guess that is refined on the underlying
+ * surface of its face afterwards.
+ */
 class InspectionExport InspectNominalShape: public InspectNominalGeometry
 {
 public:
@@ -168,13 +175,25 @@ public:
     float getDistance(const Base::Vector3f&) const override;
 
 private:
-    bool isInsideSolid(const gp_Pnt&) const;
-    bool isBelowFace(const gp_Pnt&) const;
+    struct FaceData;
+    struct FacetData;
+
+    void fetchFacets(double deflection);
+    bool refineOnFace(
+        std::size_t facet,
+        const Base::Vector3f& point,
+        const Base::Vector3f& nearest,
+        float& dist
+    ) const;
+    float getDistanceToEdges(const Base::Vector3f&) const;
 
 private:
-    BRepExtrema_DistShapeShape* distss;
-    const TopoDS_Shape& _rShape;
-    bool isSolid {false};
+    TopoDS_Shape* _pShape;
+    MeshCore::MeshFacetTree* _pTree;
+    std::vector<FaceData> _faces;
+    std::vector<FacetData> _facets;
+    float _offset;
+    float _deflection {0.0F};
 };
 
 class InspectionExport PropertyDistanceList: public App::PropertyLists
@@ -274,6 +293,14 @@ public:
     {
         return "InspectionGui::ViewProviderInspection";
     }
+
+private:
+    InspectNominalGeometry* getNominal(App::DocumentObject*);
+
+private:
+    /// Keeps the nominal geometries with their search structures between two recomputes
+    struct NominalCache;
+    std::unique_ptr<NominalCache> nominalCache;
 };
 
 class InspectionExport Group: public App::DocumentObjectGroup
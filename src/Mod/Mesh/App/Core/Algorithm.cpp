@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <thread>
 
 #include <Base/Console.h>
 #include <Base/Sequencer.h>
@@ -32,6 +33,7 @@
 #include "Algorithm.h"
 #include "Approximation.h"
 #include "Elements.h"
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "Triangulation.h"
@@ -2127,6 +2129,141 @@ void MeshRefPointToPoints::Rebuild()
     }
 }
 
+void MeshPointNeighbourhood::Rebuild()
+{
+    const MeshPointArray& rPoints = _rclMesh.GetPoints();
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    std::size_t numPoints = rPoints.size();
+
+    // every facet adds two neighbours to each of its points, duplicates are removed later
+    std::vector<std::size_t> offsets(numPoints + 1, 0);
+    _facetOffsets.assign(numPoints + 1, 0);
+    for (const auto& rFacet : rFacets) {
+        PointIndex ulP0 = rFacet._aulPoints[0];
+        PointIndex ulP1 = rFacet._aulPoints[1];
+        PointIndex ulP2 = rFacet._aulPoints[2];
+
+        offsets[ulP0 + 1] += 2;
+        offsets[ulP1 + 1] += 2;
+        offsets[ulP2 + 1] += 2;
+
+        // count a degenerated facet only once per point
+        _facetOffsets[ulP0 + 1]++;
+        if (ulP1 != ulP0) {
+            _facetOffsets[ulP1 + 1]++;
+        }
+        if (ulP2 != ulP0 && ulP2 != ulP1) {
+            _facetOffsets[ulP2 + 1]++;
+        }
+    }
+
+    for (std::size_t i = 0; i < numPoints; i++) {
+        offsets[i + 1] += offsets[i];
+        _facetOffsets[i + 1] += _facetOffsets[i];
+    }
+
+    // the facets are added in ascending order
+    _facets.resize(_facetOffsets[numPoints]);
+    std::vector<std::size_t> fillFacets(_facetOffsets.begin(), _facetOffsets.end() - 1);
+    for (std::size_t i = 0; i < rFacets.size(); i++) {
+        PointIndex ulP0 = rFacets[i]._aulPoints[0];
+        PointIndex ulP1 = rFacets[i]._aulPoints[1];
+        PointIndex ulP2 = rFacets[i]._aulPoints[2];
+
+        _facets[fillFacets[ulP0]++] = i;
+        if (ulP1 != ulP0) {
+            _facets[fillFacets[ulP1]++] = i;
+        }
+        if (ulP2 != ulP0 && ulP2 != ulP1) {
+            _facets[fillFacets[ulP2]++] = i;
+        }
+    }
+
+    _neighbours.resize(offsets[numPoints]);
+    std::vector<std::size_t> fill(offsets.begin(), offsets.end() - 1);
+    for (const auto& rFacet : rFacets) {
+        PointIndex ulP0 = rFacet._aulPoints[0];
+        PointIndex ulP1 = rFacet._aulPoints[1];
+        PointIndex ulP2 = rFacet._aulPoints[2];
+
+        _neighbours[fill[ulP0]++] = ulP1;
+        _neighbours[fill[ulP0]++] = ulP2;
+        _neighbours[fill[ulP1]++] = ulP0;
+        _neighbours[fill[ulP1]++] = ulP2;
+        _neighbours[fill[ulP2]++] = ulP0;
+        _neighbours[fill[ulP2]++] = ulP1;
+    }
+
+    // sort the neighbours of each point and remove duplicates
+    std::vector<std::size_t> counts(numPoints, 0);
+    auto sortRows = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            auto first = _neighbours.begin() + static_cast<std::ptrdiff_t>(offsets[i]);
+            auto last = _neighbours.begin() + static_cast<std::ptrdiff_t>(offsets[i + 1]);
+            std::sort(first, last);
+            last = std::unique(first, last);
+            counts[i] = static_cast<std::size_t>(last - first);
+        }
+    };
+    int threads = int(std::thread::hardware_concurrency());
+    MeshCore::parallel_for(numPoints, sortRows, threads);
+
+    // compact the rows
+    _offsets.resize(numPoints + 1);
+    _offsets[0] = 0;
+    for (std::size_t i = 0; i < numPoints; i++) {
+        _offsets[i + 1] = _offsets[i] + counts[i];
+        std::copy_n(
+            _neighbours.begin() + static_cast<std::ptrdiff_t>(offsets[i]),
+            counts[i],
+            _neighbours.begin() + static_cast<std::ptrdiff_t>(_offsets[i])
+        );
+    }
+    _neighbours.resize(_offsets[numPoints]);
+    _neighbours.shrink_to_fit();
+}
+
+void MeshPointNeighbourhood::Neighbours(
+    FacetIndex ulFacetInd,
+    float fMaxDist,
+    std::vector<FacetIndex>& facets
+) const
+{
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    Base::Vector3f clCenter = _rclMesh.GetFacet(ulFacetInd).GetGravityPoint();
+    float fMaxDist2 = fMaxDist * fMaxDist;
+
+    // the facets are kept sorted to look up the visited ones
+    facets.clear();
+    facets.push_back(ulFacetInd);
+    std::vector<FacetIndex> front {ulFacetInd};
+    std::vector<FacetIndex> next;
+    while (!front.empty()) {
+        next.clear();
+        for (FacetIndex index : front) {
+            for (PointIndex ptIndex : rFacets[index]._aulPoints) {
+                for (auto it = beginFacets(ptIndex); it != endFacets(ptIndex); ++it) {
+                    FacetIndex neighbour = *it;
+                    auto pos = std::lower_bound(facets.begin(), facets.end(), neighbour);
+                    if (pos != facets.end() && *pos == neighbour) {
+                        continue;
+                    }
+
+                    const MeshFacet& face = rFacets[neighbour];
+                    if (Base::DistanceP2(clCenter, _rclMesh.GetFacet(face).GetGravityPoint())
+                        > fMaxDist2) {
+                        continue;
+                    }
+
+                    facets.insert(pos, neighbour);
+                    next.push_back(neighbour);
+                }
+            }
+        }
+        front.swap(next);
+    }
+}
+
 Base::Vector3f MeshRefPointToPoints::GetNormal(PointIndex pos) const
 {
     const MeshPointArray& rPoints = _rclMesh.GetPoints();
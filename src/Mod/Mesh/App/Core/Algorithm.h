@@ -632,6 +632,80 @@ private:
     std::vector<std::set<PointIndex>> _map;
 };
 
+/**
+ * The MeshPointNeighbourhood class provides the same information as MeshRefPointToPoints but
+ * stores the neighbour points of all points in one contiguous array (compressed sparse row
+ * format). It is built in parallel and is much cheaper to iterate over. The neighbours of a
+ * point are sorted in ascending order.
+ * Additionally, the facets of each point are stored in the same way. They replace
+ * MeshRefPointToFacets for the detection of border points and the search of facets.
+ * \note If the underlying mesh kernel gets changed this structure becomes invalid and must
+ * be rebuilt.
+ */
+class MeshExport MeshPointNeighbourhood
+{
+public:
+    /// Construction
+    explicit MeshPointNeighbourhood(const MeshKernel& rclM)
+        : _rclMesh(rclM)
+    {
+        Rebuild();
+    }
+
+    /// Rebuilds up data structure
+    void Rebuild();
+    /// Returns the number of points
+    std::size_t Size() const
+    {
+        return _offsets.size() - 1;
+    }
+    /// Returns the number of neighbour points of the given point
+    std::size_t CountNeighbours(PointIndex pos) const
+    {
+        return _offsets[pos + 1] - _offsets[pos];
+    }
+    /// Returns the number of facets that reference the given point
+    std::size_t CountFacets(PointIndex pos) const
+    {
+        return _facetOffsets[pos + 1] - _facetOffsets[pos];
+    }
+    /// Returns true if the point has a different number of neighbour points and facets
+    bool IsBorder(PointIndex pos) const
+    {
+        return CountNeighbours(pos) != CountFacets(pos);
+    }
+    const PointIndex* begin(PointIndex pos) const
+    {
+        return _neighbours.data() + _offsets[pos];
+    }
+    const PointIndex* end(PointIndex pos) const
+    {
+        return _neighbours.data() + _offsets[pos + 1];
+    }
+    /// The facets of a point in ascending order
+    const FacetIndex* beginFacets(PointIndex pos) const
+    {
+        return _facets.data() + _facetOffsets[pos];
+    }
+    const FacetIndex* endFacets(PointIndex pos) const
+    {
+        return _facets.data() + _facetOffsets[pos + 1];
+    }
+    /**
+     * Collects the facets that are connected with \a ulFacetInd over points and whose gravity
+     * points are closer than \a fMaxDist to the gravity point of \a ulFacetInd. Gives the same
+     * facets as MeshRefPointToFacets::Neighbours() in ascending order.
+     */
+    void Neighbours(FacetIndex ulFacetInd, float fMaxDist, std::vector<FacetIndex>& facets) const;
+
+private:
+    const MeshKernel& _rclMesh; /**< The mesh kernel. */
+    std::vector<std::size_t> _offsets;
+    std::vector<PointIndex> _neighbours;
+    std::vector<std::size_t> _facetOffsets;
+    std::vector<FacetIndex> _facets;
+};
+
 /**
  * The MeshRefEdgeToFacets builds up a structure to have access to all facets
  * of an edge. On a manifold mesh an edge has one or two facets associated.
@@ -139,36 +139,53 @@ PlaneFit::PlaneFit()
     , _vDirW(0, 0, 1)
 {}
 
+void PointMoments::Add(const Base::Vector3f& pnt)
+{
+    sxx += double(pnt.x * pnt.x);
+    sxy += double(pnt.x * pnt.y);
+    sxz += double(pnt.x * pnt.z);
+    syy += double(pnt.y * pnt.y);
+    syz += double(pnt.y * pnt.z);
+    szz += double(pnt.z * pnt.z);
+    mx += double(pnt.x);
+    my += double(pnt.y);
+    mz += double(pnt.z);
+    count++;
+}
+
+void PointMoments::Clear()
+{
+    *this = PointMoments();
+}
+
 float PlaneFit::Fit()
+{
+    PointMoments moments;
+    for (const auto& vPoint : _vPoints) {
+        moments.Add(vPoint);
+    }
+
+    return Fit(moments);
+}
+
+float PlaneFit::Fit(const PointMoments& moments)
 {
     _bIsFitted = true;
-    if (CountPoints() < 3) {
+    if (moments.count < 3) {
         return std::numeric_limits<float>::max();
     }
 
-    double sxx {0.0};
-    double sxy {0.0};
-    double sxz {0.0};
-    double syy {0.0};
-    double syz {0.0};
-    double szz {0.0};
-    double mx {0.0};
-    double my {0.0};
-    double mz {0.0};
+    double sxx = moments.sxx;
+    double sxy = moments.sxy;
+    double sxz = moments.sxz;
+    double syy = moments.syy;
+    double syz = moments.syz;
+    double szz = moments.szz;
+    double mx = moments.mx;
+    double my = moments.my;
+    double mz = moments.mz;
 
-    for (const auto& vPoint : _vPoints) {
-        sxx += double(vPoint.x * vPoint.x);
-        sxy += double(vPoint.x * vPoint.y);
-        sxz += double(vPoint.x * vPoint.z);
-        syy += double(vPoint.y * vPoint.y);
-        syz += double(vPoint.y * vPoint.z);
-        szz += double(vPoint.z * vPoint.z);
-        mx += double(vPoint.x);
-        my += double(vPoint.y);
-        mz += double(vPoint.z);
-    }
-
-    size_t nSize = _vPoints.size();
+    size_t nSize = moments.count;
     sxx = sxx - mx * mx / (double(nSize));
     sxy = sxy - mx * my / (double(nSize));
     sxz = sxz - mx * mz / (double(nSize));
@@ -210,6 +210,27 @@ protected:
 
 // -------------------------------------------------------------------------------
 
+/**
+ * The sums of the coordinates and of their products of a set of points. They can be updated
+ * in constant time when adding a point and are sufficient to fit a plane into the points.
+ */
+struct MeshExport PointMoments
+{
+    void Add(const Base::Vector3f& pnt);
+    void Clear();
+
+    double sxx {0.0};
+    double sxy {0.0};
+    double sxz {0.0};
+    double syy {0.0};
+    double syz {0.0};
+    double szz {0.0};
+    double mx {0.0};
+    double my {0.0};
+    double mz {0.0};
+    std::size_t count {0};
+};
+
 /**
  * Approximation of a plane into a given set of points.
  */
@@ -230,6 +251,11 @@ public:
      * to succeed. If the fit fails FLOAT_MAX is returned.
      */
     float Fit() override;
+    /**
+     * Fit a plane using the moments of a point set instead of the added points. As the moments
+     * can be updated in constant time this allows to refit a growing point set incrementally.
+     */
+    float Fit(const PointMoments& moments);
     /**
      * Returns the distance from the point \a rcPoint to the fitted plane. If Fit() has not been
      * called FLOAT_MAX is returned.
@@ -23,12 +23,8 @@
  ***************************************************************************/
 
 #include <algorithm>
-#include <functional>
 #include <limits>
-
-#include <QFuture>
-#include <QFutureWatcher>
-#include <QtConcurrentMap>
+#include <thread>
 
 #include <Base/Sequencer.h>
 #include <Base/Tools.h>
@@ -42,13 +38,13 @@
 
 #include "Approximation.h"
 #include "Curvature.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
 #include "Tools.h"
 
 
 using namespace MeshCore;
-namespace sp = std::placeholders;
 
 MeshCurvature::MeshCurvature(const MeshKernel& kernel)
     : myKernel(kernel)
@@ -69,7 +65,7 @@ MeshCurvature::MeshCurvature(const MeshKernel& kernel, std::vector<FacetIndex> s
 void MeshCurvature::ComputePerFace(bool parallel)
 {
     myCurvature.clear();
-    MeshRefPointToFacets search(myKernel);
+    MeshPointNeighbourhood search(myKernel);
     FacetCurvature face(myKernel, search, myRadius, myMinPoints);
 
     if (!parallel) {
@@ -78,18 +74,38 @@ void MeshCurvature::ComputePerFace(bool parallel)
             CurvatureInfo info = face.Compute(it);
             myCurvature.push_back(info);
             seq.next();
+            if (myProgress) {
+                myProgress(myCurvature.size(), mySegment.size());
+            }
         }
     }
     else {
-        // NOLINTBEGIN
-        QFuture<CurvatureInfo> future
-            = QtConcurrent::mapped(mySegment, std::bind(&FacetCurvature::Compute, &face, sp::_1));
-        // NOLINTEND
-        QFutureWatcher<CurvatureInfo> watcher;
-        watcher.setFuture(future);
-        watcher.waitForFinished();
-        for (const auto& it : future) {
-            myCurvature.push_back(it);
+        // process the facets in chunks to report the progress from the calling thread. Every
+        // chunk starts a task per thread, so a chunk gives each thread a reasonable amount of work
+        const std::size_t numChunks = 100;
+        std::size_t count = mySegment.size();
+        int threads = std::max(1, int(std::thread::hardware_concurrency()));
+        std::size_t chunkSize = std::max<std::size_t>(
+            (count + numChunks - 1) / numChunks,
+            std::size_t(threads) * 1024
+        );
+
+        myCurvature.resize(count);
+        for (std::size_t first = 0; first < count; first += chunkSize) {
+            std::size_t last = std::min(first + chunkSize, count);
+            MeshCore::parallel_for(
+                last - first,
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t pos = first + begin; pos < first + end; pos++) {
+                        myCurvature[pos] = face.Compute(mySegment[pos]);
+                    }
+                },
+                threads
+            );
+
+            if (myProgress) {
+                myProgress(last, count);
+            }
         }
     }
 }
@@ -349,33 +365,9 @@ void MeshCurvature::ComputePerVertex()
 
 // --------------------------------------------------------
 
-namespace MeshCore
-{
-class FitPointCollector: public MeshCollector
-{
-public:
-    explicit FitPointCollector(std::set<PointIndex>& ind)
-        : indices(ind)
-    {}
-    void Append(const MeshCore::MeshKernel& kernel, FacetIndex index) override
-    {
-        PointIndex ulP1 {}, ulP2 {}, ulP3 {};
-        kernel.GetFacetPoints(index, ulP1, ulP2, ulP3);
-        indices.insert(ulP1);
-        indices.insert(ulP2);
-        indices.insert(ulP3);
-    }
-
-private:
-    std::set<PointIndex>& indices;
-};
-}  // namespace MeshCore
-
-// --------------------------------------------------------
-
 FacetCurvature::FacetCurvature(
     const MeshKernel& kernel,
-    const MeshRefPointToFacets& search,
+    const MeshPointNeighbourhood& search,
     float r,
     unsigned long pt
 )
@@ -393,13 +385,25 @@ CurvatureInfo FacetCurvature::Compute(FacetIndex index) const
     MeshGeomFacet face = myKernel.GetFacet(index);
     Base::Vector3f face_gravity = face.GetGravityPoint();
     Base::Vector3f face_normal = face.GetNormal();
-    std::set<PointIndex> point_indices;
-    FitPointCollector collect(point_indices);
+    std::vector<FacetIndex> facets;
+    std::vector<PointIndex> point_indices;
+    const MeshFacetArray& rFacets = myKernel.GetFacets();
 
     float searchDist = myRadius;
     int attempts = 0;
     do {
-        mySearch.Neighbours(index, searchDist, collect);
+        // the points of a larger search radius include those of the smaller one
+        mySearch.Neighbours(index, searchDist, facets);
+        point_indices.clear();
+        for (FacetIndex it : facets) {
+            const MeshFacet& facet = rFacets[it];
+            point_indices.insert(point_indices.end(), facet._aulPoints, facet._aulPoints + 3);
+        }
+        std::sort(point_indices.begin(), point_indices.end());
+        point_indices.erase(
+            std::unique(point_indices.begin(), point_indices.end()),
+            point_indices.end()
+        );
         if (point_indices.empty()) {
             break;
         }
@@ -26,13 +26,14 @@
 
 #include "Definitions.h"
 #include <Base/Vector3D.h>
+#include <functional>
 #include <vector>
 
 namespace MeshCore
 {
 
 class MeshKernel;
-class MeshRefPointToFacets;
+class MeshPointNeighbourhood;
 
 /** Curvature information. */
 struct MeshExport CurvatureInfo
@@ -44,12 +45,17 @@ struct MeshExport CurvatureInfo
 class MeshExport FacetCurvature
 {
 public:
-    FacetCurvature(const MeshKernel& kernel, const MeshRefPointToFacets& search, float, unsigned long);
+    FacetCurvature(
+        const MeshKernel& kernel,
+        const MeshPointNeighbourhood& search,
+        float,
+        unsigned long
+    );
     CurvatureInfo Compute(FacetIndex index) const;
 
 private:
     const MeshKernel& myKernel;
-    const MeshRefPointToFacets& mySearch;
+    const MeshPointNeighbourhood& mySearch;
     unsigned long myMinPoints;
     float myRadius;
 };
@@ -67,6 +73,11 @@ public:
     {
         myRadius = r;
     }
+    /** The callback is invoked with the number of processed and the total number of facets. */
+    void SetProgressCallback(std::function<void(std::size_t, std::size_t)> func)
+    {
+        myProgress = std::move(func);
+    }
     void ComputePerFace(bool parallel);
     void ComputePerVertex();
     const std::vector<CurvatureInfo>& GetCurvature() const
@@ -80,6 +91,7 @@ private:
     float myRadius;
     std::vector<FacetIndex> mySegment;
     std::vector<CurvatureInfo> myCurvature;
+    std::function<void(std::size_t, std::size_t)> myProgress;
 };
 
 }  // namespace MeshCore
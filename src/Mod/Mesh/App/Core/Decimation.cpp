@@ -22,7 +22,11 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <limits>
+#include <thread>
+
+#include <Base/Sequencer.h>
 
 #include "Decimation.h"
 #include "MeshKernel.h"
@@ -33,74 +37,49 @@ using namespace MeshCore;
 
 MeshSimplify::MeshSimplify(MeshKernel& mesh)
     : myKernel(mesh)
+    , myThreads(int(std::thread::hardware_concurrency()))
 {}
 
-void MeshSimplify::simplify(float tolerance, float reduction)
+void MeshSimplify::setThreads(int threads)
 {
-    Simplify alg;
-
-    const MeshPointArray& points = myKernel.GetPoints();
-    for (std::size_t i = 0; i < points.size(); i++) {
-        Simplify::Vertex v;
-        v.tstart = 0;
-        v.tcount = 0;
-        v.border = 0;
-        v.p = points[i];
-        alg.vertices.push_back(v);
-    }
-
-    const MeshFacetArray& facets = myKernel.GetFacets();
-    for (std::size_t i = 0; i < facets.size(); i++) {
-        Simplify::Triangle t;
-        t.deleted = 0;
-        t.dirty = 0;
-        for (double& j : t.err) {
-            j = 0.0;
-        }
-        for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
-        }
-        alg.triangles.push_back(t);
-    }
-
-    int target_count = static_cast<int>(static_cast<float>(facets.size()) * (1.0F - reduction));
+    myThreads = std::max(threads, 1);
+}
 
-    // Simplification starts
-    alg.simplify_mesh(target_count, tolerance);
+int MeshSimplify::getThreads() const
+{
+    return myThreads;
+}
 
-    // Simplification done
-    MeshPointArray new_points;
-    new_points.reserve(alg.vertices.size());
-    for (const auto& vertex : alg.vertices) {
-        new_points.push_back(vertex.p);
-    }
+void MeshSimplify::setConcurrent(bool on)
+{
+    myConcurrent = on;
+}
 
-    std::size_t numFacets = 0;
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            numFacets++;
-        }
-    }
-    MeshFacetArray new_facets;
-    new_facets.reserve(numFacets);
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            MeshFacet face;
-            face._aulPoints[0] = triangle.v[0];
-            face._aulPoints[1] = triangle.v[1];
-            face._aulPoints[2] = triangle.v[2];
-            new_facets.push_back(face);
-        }
-    }
+bool MeshSimplify::isConcurrent() const
+{
+    return myConcurrent;
+}
 
-    myKernel.Adopt(new_points, new_facets, true);
+void MeshSimplify::simplify(float tolerance, float reduction)
+{
+    std::size_t numFacets = myKernel.CountFacets();
+    int target_count = static_cast<int>(static_cast<float>(numFacets) * (1.0F - reduction));
+    simplifyMesh(target_count, tolerance);
 }
 
 void MeshSimplify::simplify(int targetSize)
+{
+    simplifyMesh(targetSize, std::numeric_limits<float>::max());
+}
+
+void MeshSimplify::simplifyMesh(int targetSize, double tolerance)
 {
     Simplify alg;
+    alg.threads = myThreads;
+    alg.concurrent = myConcurrent;
 
     const MeshPointArray& points = myKernel.GetPoints();
+    alg.vertices.reserve(points.size());
     for (std::size_t i = 0; i < points.size(); i++) {
         Simplify::Vertex v;
         v.tstart = 0;
@@ -111,6 +90,7 @@ void MeshSimplify::simplify(int targetSize)
     }
 
     const MeshFacetArray& facets = myKernel.GetFacets();
+    alg.triangles.reserve(facets.size());
     for (std::size_t i = 0; i < facets.size(); i++) {
         Simplify::Triangle t;
         t.deleted = 0;
@@ -124,8 +104,19 @@ void MeshSimplify::simplify(int targetSize)
         alg.triangles.push_back(t);
     }
 
+    // The progress is measured by the number of removed triangles. If the operation
+    // gets aborted an exception is thrown and the kernel is left unchanged.
+    int startCount = static_cast<int>(facets.size());
+    int removeCount = std::max(startCount - targetSize, 1);
+    Base::SequencerLauncher seq("Simplifying mesh...", static_cast<size_t>(removeCount));
+    alg.progress = [&seq, startCount, removeCount](int count, int) {
+        int removed = std::min(startCount - count, removeCount);
+        seq.setProgress(static_cast<size_t>(std::max(removed, 0)));
+        seq.next(true);
+    };
+
     // Simplification starts
-    alg.simplify_mesh(targetSize, std::numeric_limits<float>::max());
+    alg.simplify_mesh(targetSize, tolerance);
 
     // Simplification done
     MeshPointArray new_points;
@@ -35,11 +35,22 @@ class MeshExport MeshSimplify
 {
 public:
     explicit MeshSimplify(MeshKernel&);
+    /// Sets the number of threads used by the decimation. Default is the number of cores.
+    void setThreads(int);
+    int getThreads() const;
+    /// Collapses independent edges concurrently. The result differs from the serial collapse.
+    void setConcurrent(bool);
+    bool isConcurrent() const;
     void simplify(float tolerance, float reduction);
     void simplify(int targetSize);
 
+private:
+    void simplifyMesh(int targetSize, double tolerance);
+
 private:
     MeshKernel& myKernel;
+    int myThreads;
+    bool myConcurrent {false};
 };
 
 }  // namespace MeshCore
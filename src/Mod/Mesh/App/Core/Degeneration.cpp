@@ -26,11 +26,13 @@
 #include <algorithm>
 #include <map>
 #include <queue>
+#include <thread>
 
 
 #include <boost/math/special_functions/fpclassify.hpp>
 
 #include "Degeneration.h"
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "TopoAlgorithm.h"
@@ -123,21 +125,41 @@ struct Vertex_Less
     }
 };
 
-}  // namespace MeshCore
-
-bool MeshEvalDuplicatePoints::Evaluate()
+// Sorts the vertices in ascending order by their (x,y,z) coordinates. Vertices
+// with equal coordinates are ordered by their index so that the result doesn't
+// depend on the number of threads used for sorting.
+static std::vector<VertexIterator> SortedVertices(const MeshPointArray& rPoints)
 {
-    // get an const iterator to each vertex and sort them in ascending order by
-    // their (x,y,z) coordinates
-    const MeshPointArray& rPoints = _rclMesh.GetPoints();
     std::vector<VertexIterator> vertices;
     vertices.reserve(rPoints.size());
     for (auto it = rPoints.begin(); it != rPoints.end(); ++it) {
         vertices.push_back(it);
     }
 
+    auto less = [](const VertexIterator& x, const VertexIterator& y) {
+        if ((*x) < (*y)) {
+            return true;
+        }
+        if ((*y) < (*x)) {
+            return false;
+        }
+        return x < y;
+    };
+
+    int threads = int(std::thread::hardware_concurrency());
+    MeshCore::parallel_sort(vertices.begin(), vertices.end(), less, threads);
+    return vertices;
+}
+
+}  // namespace MeshCore
+
+bool MeshEvalDuplicatePoints::Evaluate()
+{
+    // get an const iterator to each vertex and sort them in ascending order by
+    // their (x,y,z) coordinates
+    std::vector<VertexIterator> vertices = SortedVertices(_rclMesh.GetPoints());
+
     // if there are two adjacent vertices which have the same coordinates
-    std::sort(vertices.begin(), vertices.end(), Vertex_Less());
     return (std::adjacent_find(vertices.begin(), vertices.end(), Vertex_EqualTo()) == vertices.end());
 }
 
@@ -147,16 +169,11 @@ std::vector<PointIndex> MeshEvalDuplicatePoints::GetIndices() const
     // the sort algorithms deliver different results compared to std::sort of
     // a vector.
     const MeshPointArray& rPoints = _rclMesh.GetPoints();
-    std::vector<VertexIterator> vertices;
-    vertices.reserve(rPoints.size());
-    for (auto it = rPoints.begin(); it != rPoints.end(); ++it) {
-        vertices.push_back(it);
-    }
+    std::vector<VertexIterator> vertices = SortedVertices(rPoints);
 
     // if there are two adjacent vertices which have the same coordinates
     std::vector<PointIndex> aInds;
     Vertex_EqualTo pred;
-    std::sort(vertices.begin(), vertices.end(), Vertex_Less());
 
     std::vector<VertexIterator>::iterator vt = vertices.begin();
     while (vt < vertices.end()) {
@@ -177,14 +194,9 @@ bool MeshFixDuplicatePoints::Fixup()
     // the sort algorithms deliver different results compared to std::sort of
     // a vector.
     const MeshPointArray& rPoints = _rclMesh.GetPoints();
-    std::vector<VertexIterator> vertices;
-    vertices.reserve(rPoints.size());
-    for (auto it = rPoints.begin(); it != rPoints.end(); ++it) {
-        vertices.push_back(it);
-    }
 
     // get the indices of adjacent vertices which have the same coordinates
-    std::sort(vertices.begin(), vertices.end(), Vertex_Less());
+    std::vector<VertexIterator> vertices = SortedVertices(rPoints);
 
     Vertex_EqualTo pred;
     std::vector<VertexIterator>::iterator next = vertices.begin();
@@ -24,6 +24,8 @@
 
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include <vector>
 
 
@@ -600,81 +602,30 @@ bool MeshFixSingleFacet::Fixup()
 
 // ----------------------------------------------------------------
 
-bool MeshEvalSelfIntersection::Evaluate()
+namespace
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next();
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        // abort after the first detected self-intersection
-                        return false;
-                    }
-                }
+// If the facets share a common vertex we do not check for self-intersections
+// because they could but usually do not intersect each other and the algorithm
+// would detect false-positives, otherwise
+bool ShareCommonVertex(const MeshFacet& rFace1, const MeshFacet& rFace2)
+{
+    for (PointIndex p1 : rFace1._aulPoints) {
+        for (PointIndex p2 : rFace2._aulPoints) {
+            if (p1 == p2) {
+                return true;
             }
         }
     }
+    return false;
+}
+}  // namespace
 
-    return true;
+bool MeshEvalSelfIntersection::Evaluate()
+{
+    // abort after the first detected self-intersection
+    std::vector<std::pair<FacetIndex, FacetIndex>> intersection;
+    CollectIntersections(intersection, true);
+    return intersection.empty();
 }
 
 void MeshEvalSelfIntersection::GetIntersections(
@@ -707,76 +658,99 @@ void MeshEvalSelfIntersection::GetIntersections(
     std::vector<std::pair<FacetIndex, FacetIndex>>& intersection
 ) const
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-    // intersection.clear();
+    CollectIntersections(intersection, false);
+}
 
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
+void MeshEvalSelfIntersection::CollectIntersections(
+    std::vector<std::pair<FacetIndex, FacetIndex>>& intersection,
+    bool firstOnly
+) const
+{
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
 
+    // Contains bounding boxes for every facet
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(rFaces.size());
     MeshFacetIterator cMFI(_rclMesh);
     for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
         boxes.push_back((*cMFI).GetBoundBox());
     }
 
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
+    // Collect the grid elements with at least two facets so that they can be
+    // distributed over several threads
+    // Splits the mesh using grid for speeding up the calculation
+    MeshFacetGrid cMeshFacetGrid(_rclMesh);
+    std::vector<std::vector<FacetIndex>> cells;
+    MeshGridIterator clGridIter(cMeshFacetGrid);
     for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next(true);
-        if (aulGridElements.empty()) {
-            continue;
+        if (clGridIter.GetCtElements() > 1) {
+            cells.emplace_back();
+            clGridIter.GetElements(cells.back());
         }
+    }
+
+    // Every thread writes the result of a grid element into its own slot, this
+    // keeps the order of the output identical to the serial algorithm
+    std::vector<std::vector<std::pair<FacetIndex, FacetIndex>>> results(cells.size());
+    std::atomic<bool> found(false);
 
+    auto checkCells = [&](std::size_t begin, std::size_t end) {
         MeshGeomFacet facet1, facet2;
         Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
+        for (std::size_t index = begin; index < end; index++) {
+            if (firstOnly && found) {
+                return;
+            }
+
+            const std::vector<FacetIndex>& aulGridElements = cells[index];
+            for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
+                const Base::BoundBox3f& box1 = boxes[*it];
+                facet1 = _rclMesh.GetFacet(*it);
+                const MeshFacet& rface1 = rFaces[*it];
+                for (auto jt = it + 1; jt != aulGridElements.end(); ++jt) {
+                    const MeshFacet& rface2 = rFaces[*jt];
+                    if (ShareCommonVertex(rface1, rface2)) {
+                        continue;  // ignore facets sharing a common vertex
+                    }
 
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        intersection.emplace_back(*it, *jt);
+                    const Base::BoundBox3f& box2 = boxes[*jt];
+                    if (box1 && box2) {
+                        facet2 = _rclMesh.GetFacet(*jt);
+                        int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
+                        if (ret == 2) {
+                            results[index].emplace_back(*it, *jt);
+                            if (firstOnly) {
+                                found = true;
+                                return;
+                            }
+                        }
                     }
                 }
             }
         }
+    };
+
+    // Calculates the intersections. The grid elements are handled in batches so that the
+    // progress is updated and an abort is checked for in between.
+    int threads = std::max(1, int(std::thread::hardware_concurrency()));
+    std::size_t batchSize = std::max<std::size_t>(64 * std::size_t(threads), cells.size() / 100);
+    std::size_t numBatches = (cells.size() + batchSize - 1) / batchSize;
+    Base::SequencerLauncher seq("Checking for self-intersections...", numBatches);
+    for (std::size_t start = 0; start < cells.size(); start += batchSize) {
+        std::size_t count = std::min(batchSize, cells.size() - start);
+        MeshCore::parallel_for(
+            count,
+            [&](std::size_t begin, std::size_t end) { checkCells(start + begin, start + end); },
+            threads
+        );
+        if (firstOnly && found) {
+            break;
+        }
+        seq.next(!firstOnly);
+    }
+
+    for (const auto& it : results) {
+        intersection.insert(intersection.end(), it.begin(), it.end());
     }
 }
 
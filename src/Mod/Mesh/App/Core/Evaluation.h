@@ -330,7 +330,7 @@ public:
     explicit MeshEvalSelfIntersection(const MeshKernel& rclB)
         : MeshEvaluation(rclB)
     {}
-    /// Evaluate the mesh and return if true if there are self intersections
+    /// Evaluate the mesh and return false if there are self intersections
     bool Evaluate() override;
     /// collect all intersection lines
     void GetIntersections(
@@ -339,6 +339,15 @@ public:
     ) const;
     /// collect the index of all facets with self intersections
     void GetIntersections(std::vector<std::pair<FacetIndex, FacetIndex>>&) const;
+
+private:
+    /** The grid elements are checked in parallel. If \a firstOnly is true the search stops
+     * after the first intersecting pair of facets has been found.
+     */
+    void CollectIntersections(
+        std::vector<std::pair<FacetIndex, FacetIndex>>&,
+        bool firstOnly
+    ) const;
 };
 
 /**
@@ -0,0 +1,1062 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cmath>
+#include <deque>
+#include <map>
+#include <numeric>
+#include <set>
+#include <tuple>
+#include <numbers>
+#include <thread>
+#include <unordered_map>
+
+#include "ExactSetOperations.h"
+#include "FacetTree.h"
+#include "Functional.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// The predicates below use floating-point expansions as described by J. R. Shewchuk in
+// "Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric Predicates".
+// An expansion is a sum of non-overlapping doubles sorted by increasing magnitude.
+using Expansion = std::vector<double>;
+
+inline void TwoSum(double a, double b, double& x, double& y)
+{
+    x = a + b;
+    double bv = x - a;
+    double av = x - bv;
+    y = (a - av) + (b - bv);
+}
+
+// adds a double to an expansion and drops zero components
+Expansion Grow(const Expansion& e, double b)
+{
+    Expansion h;
+    h.reserve(e.size() + 1);
+    double q = b;
+    for (double it : e) {
+        double sum {};
+        double err {};
+        TwoSum(q, it, sum, err);
+        if (err != 0.0) {
+            h.push_back(err);
+        }
+        q = sum;
+    }
+    if (q != 0.0 || h.empty()) {
+        h.push_back(q);
+    }
+    return h;
+}
+
+Expansion Sum(const Expansion& e, const Expansion& f)
+{
+    Expansion h = e;
+    for (double it : f) {
+        h = Grow(h, it);
+    }
+    return h;
+}
+
+Expansion Negate(Expansion e)
+{
+    for (double& it : e) {
+        it = -it;
+    }
+    return e;
+}
+
+Expansion Product(const Expansion& e, const Expansion& f)
+{
+    Expansion h {0.0};
+    for (double a : e) {
+        for (double b : f) {
+            double x = a * b;
+            h = Grow(h, std::fma(a, b, -x));
+            h = Grow(h, x);
+        }
+    }
+    return h;
+}
+
+// the exact difference a - b
+Expansion Difference(double a, double b)
+{
+    return Grow(Expansion {a}, -b);
+}
+
+int Sign(const Expansion& e)
+{
+    double last = e.back();
+    return last > 0.0 ? 1 : (last < 0.0 ? -1 : 0);
+}
+
+// the exact sign of a * d - b * c
+int SignOfDet2(const Expansion& a, const Expansion& b, const Expansion& c, const Expansion& d)
+{
+    return Sign(Sum(Product(a, d), Negate(Product(b, c))));
+}
+
+// the sign of the determinant |b-a, c-a, d-a|, i.e. positive if d lies on the side of the plane
+// through a, b and c its normal (b-a) x (c-a) points to
+int Orient3d(
+    const Base::Vector3d& a,
+    const Base::Vector3d& b,
+    const Base::Vector3d& c,
+    const Base::Vector3d& d
+)
+{
+    double ux = b.x - a.x;
+    double uy = b.y - a.y;
+    double uz = b.z - a.z;
+    double vx = c.x - a.x;
+    double vy = c.y - a.y;
+    double vz = c.z - a.z;
+    double wx = d.x - a.x;
+    double wy = d.y - a.y;
+    double wz = d.z - a.z;
+    double det = ux * (vy * wz - vz * wy) + uy * (vz * wx - vx * wz) + uz * (vx * wy - vy * wx);
+    double permanent = std::fabs(ux) * (std::fabs(vy * wz) + std::fabs(vz * wy))
+        + std::fabs(uy) * (std::fabs(vz * wx) + std::fabs(vx * wz))
+        + std::fabs(uz) * (std::fabs(vx * wy) + std::fabs(vy * wx));
+    double bound = 1e-15 * permanent;
+    if (det > bound) {
+        return 1;
+    }
+    if (det < -bound) {
+        return -1;
+    }
+
+    Expansion eux = Difference(b.x, a.x);
+    Expansion euy = Difference(b.y, a.y);
+    Expansion euz = Difference(b.z, a.z);
+    Expansion evx = Difference(c.x, a.x);
+    Expansion evy = Difference(c.y, a.y);
+    Expansion evz = Difference(c.z, a.z);
+    Expansion ewx = Difference(d.x, a.x);
+    Expansion ewy = Difference(d.y, a.y);
+    Expansion ewz = Difference(d.z, a.z);
+    Expansion mx = Sum(Product(evy, ewz), Negate(Product(evz, ewy)));
+    Expansion my = Sum(Product(evz, ewx), Negate(Product(evx, ewz)));
+    Expansion mz = Sum(Product(evx, ewy), Negate(Product(evy, ewx)));
+    return Sign(Sum(Sum(Product(eux, mx), Product(euy, my)), Product(euz, mz)));
+}
+
+// the sign of the first non-zero component of (p1 - p0) x (q1 - q0)
+int CrossSign(
+    const Base::Vector3d& p0,
+    const Base::Vector3d& p1,
+    const Base::Vector3d& q0,
+    const Base::Vector3d& q1
+)
+{
+    Expansion ux = Difference(p1.x, p0.x);
+    Expansion uy = Difference(p1.y, p0.y);
+    Expansion uz = Difference(p1.z, p0.z);
+    Expansion vx = Difference(q1.x, q0.x);
+    Expansion vy = Difference(q1.y, q0.y);
+    Expansion vz = Difference(q1.z, q0.z);
+    if (int sign = SignOfDet2(uy, uz, vy, vz)) {
+        return sign;
+    }
+    if (int sign = SignOfDet2(uz, ux, vz, vx)) {
+        return sign;
+    }
+    return SignOfDet2(ux, uy, vx, vy);
+}
+
+struct Point2d
+{
+    double x;
+    double y;
+};
+
+// the sign of the determinant |b-a, c-a|, positive if a, b and c are counter-clockwise
+int Orient2d(const Point2d& a, const Point2d& b, const Point2d& c)
+{
+    double l = (b.x - a.x) * (c.y - a.y);
+    double r = (b.y - a.y) * (c.x - a.x);
+    double det = l - r;
+    double bound = 1e-15 * (std::fabs(l) + std::fabs(r));
+    if (det > bound) {
+        return 1;
+    }
+    if (det < -bound) {
+        return -1;
+    }
+    return SignOfDet2(
+        Difference(b.x, a.x),
+        Difference(b.y, a.y),
+        Difference(c.x, a.x),
+        Difference(c.y, a.y)
+    );
+}
+
+// ------------------------------------------------------------------------------------------------
+
+using Triangle = std::array<Base::Vector3d, 3>;
+
+/* The second mesh is moved by the infinitesimal vector (e, e^2, e^3). A point of one mesh then
+ * never lies on the plane of a facet of the other mesh, and the edges of the two meshes are
+ * never coplanar. The sign of the perturbed determinant is the sign of the first non-zero term
+ * of its expansion in e.
+ */
+
+// the side of the point \a p of one mesh relative to the triangle \a t of the mesh \a side
+int PlaneSide(const Triangle& t, const Base::Vector3d& p, int side)
+{
+    int sign = Orient3d(t[0], t[1], t[2], p);
+    if (sign == 0) {
+        // the determinant grows by n * delta for a point of the second mesh and shrinks by it
+        // for a triangle of the second mesh
+        sign = CrossSign(t[0], t[1], t[0], t[2]);
+        if (side == 1) {
+            sign = -sign;
+        }
+    }
+    return sign != 0 ? sign : 1;
+}
+
+// the orientation of the edge a0-a1 of the first mesh and the edge b0-b1 of the second mesh
+int EdgeOrder(
+    const Base::Vector3d& a0,
+    const Base::Vector3d& a1,
+    const Base::Vector3d& b0,
+    const Base::Vector3d& b1
+)
+{
+    int sign = Orient3d(a0, a1, b0, b1);
+    if (sign == 0) {
+        sign = CrossSign(a0, a1, b1, b0);
+    }
+    return sign != 0 ? sign : 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+
+/* A point where an edge of one mesh crosses a facet of the other mesh. The edge is stored as it
+ * is oriented from the negative to the positive side of the facet. Two crossings are the same
+ * point if they have the same key.
+ */
+struct Crossing
+{
+    int side;
+    PointIndex from;
+    PointIndex to;
+    FacetIndex facet;
+};
+
+// A vertex of the result. Original points have no facet and lo == hi.
+struct VertexKey
+{
+    int side;
+    PointIndex lo;
+    PointIndex hi;
+    FacetIndex facet;
+
+    bool operator<(const VertexKey& other) const
+    {
+        return std::tie(side, lo, hi, facet)
+            < std::tie(other.side, other.lo, other.hi, other.facet);
+    }
+};
+
+VertexKey KeyOf(const Crossing& c)
+{
+    return {c.side, std::min(c.from, c.to), std::max(c.from, c.to), c.facet};
+}
+
+VertexKey KeyOf(int side, PointIndex point)
+{
+    return {side, point, point, FACET_INDEX_MAX};
+}
+
+// the intersection of a facet of the first and a facet of the second mesh
+struct Segment
+{
+    FacetIndex facet1;
+    FacetIndex facet2;
+    Crossing start;
+    Crossing end;
+};
+
+// the sub-triangles of a facet that was cut
+using SubTriangles = std::vector<std::array<VertexKey, 3>>;
+
+/* A constrained triangulation of a facet in its parameter space. New points are inserted into
+ * the triangle that contains them, and constraints are recovered by edge flips.
+ */
+class FacetTriangulation
+{
+public:
+    FacetTriangulation()
+    {
+        points = {{0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}};
+        AddTriangle(0, 1, 2);
+    }
+
+    // inserts the point and returns its index, or the index of an existing point at the same
+    // position, or -1 if the point is outside
+    int Insert(const Point2d& p)
+    {
+        int index = int(points.size());
+        points.push_back(p);
+        for (std::size_t t = 0; t < triangles.size(); t++) {
+            if (!alive[t]) {
+                continue;
+            }
+            auto [a, b, c] = triangles[t];
+            std::array<int, 3> side {Orient2d(points[a], points[b], p),
+                                     Orient2d(points[b], points[c], p),
+                                     Orient2d(points[c], points[a], p)};
+            if (side[0] < 0 || side[1] < 0 || side[2] < 0) {
+                continue;
+            }
+            int zeros = int(std::count(side.begin(), side.end(), 0));
+            if (zeros == 0) {
+                RemoveTriangle(t);
+                AddTriangle(a, b, index);
+                AddTriangle(b, c, index);
+                AddTriangle(c, a, index);
+                return index;
+            }
+            if (zeros == 1) {
+                int x = side[0] == 0 ? a : (side[1] == 0 ? b : c);
+                int y = side[0] == 0 ? b : (side[1] == 0 ? c : a);
+                int z = side[0] == 0 ? c : (side[1] == 0 ? a : b);
+                auto it = edges.find(EdgeKey(y, x));
+                RemoveTriangle(t);
+                AddTriangle(x, index, z);
+                AddTriangle(index, y, z);
+                if (it != edges.end()) {
+                    std::size_t u = it->second;
+                    int w = Opposite(u, y, x);
+                    RemoveTriangle(u);
+                    AddTriangle(y, index, w);
+                    AddTriangle(index, x, w);
+                }
+                return index;
+            }
+
+            points.pop_back();
+            if (side[0] != 0) {
+                return c;
+            }
+            return side[1] != 0 ? a : b;
+        }
+
+        points.pop_back();
+        return -1;
+    }
+
+    // makes the segment a-b an edge of the triangulation
+    bool Recover(int a, int b)
+    {
+        if (HasEdge(a, b)) {
+            return true;
+        }
+
+        std::deque<std::pair<int, int>> queue;
+        for (std::size_t t = 0; t < triangles.size(); t++) {
+            if (!alive[t]) {
+                continue;
+            }
+            for (int i = 0; i < 3; i++) {
+                int x = triangles[t][i];
+                int y = triangles[t][(i + 1) % 3];
+                if (x < y && Crosses(a, b, x, y)) {
+                    queue.emplace_back(x, y);
+                }
+            }
+        }
+
+        // flipping the crossing edges in turn terminates, the guard is only a safety net
+        std::size_t limit = 100 * (queue.size() + 1) * (queue.size() + 1);
+        for (std::size_t iter = 0; !queue.empty() && iter < limit; iter++) {
+            auto [x, y] = queue.front();
+            queue.pop_front();
+            auto it1 = edges.find(EdgeKey(x, y));
+            auto it2 = edges.find(EdgeKey(y, x));
+            if (it1 == edges.end() || it2 == edges.end()) {
+                continue;
+            }
+            std::size_t t1 = it1->second;
+            std::size_t t2 = it2->second;
+            int z1 = Opposite(t1, x, y);
+            int z2 = Opposite(t2, x, y);
+            if (Orient2d(points[z1], points[z2], points[x])
+                    * Orient2d(points[z1], points[z2], points[y])
+                >= 0) {
+                // the quad is not convex, retry after the other edges are flipped
+                queue.emplace_back(x, y);
+                continue;
+            }
+            RemoveTriangle(t1);
+            RemoveTriangle(t2);
+            AddTriangle(x, z2, z1);
+            AddTriangle(y, z1, z2);
+            if (Crosses(a, b, z1, z2)) {
+                queue.emplace_back(z1, z2);
+            }
+        }
+
+        return HasEdge(a, b);
+    }
+
+    std::vector<std::array<int, 3>> GetTriangles() const
+    {
+        std::vector<std::array<int, 3>> result;
+        for (std::size_t t = 0; t < triangles.size(); t++) {
+            if (alive[t]) {
+                result.push_back(triangles[t]);
+            }
+        }
+        return result;
+    }
+
+private:
+    static std::uint64_t EdgeKey(int a, int b)
+    {
+        return (std::uint64_t(a) << 32) | std::uint32_t(b);
+    }
+
+    bool HasEdge(int a, int b) const
+    {
+        return edges.find(EdgeKey(a, b)) != edges.end() || edges.find(EdgeKey(b, a)) != edges.end();
+    }
+
+    // true if the segments a-b and x-y properly cross each other
+    bool Crosses(int a, int b, int x, int y) const
+    {
+        return Orient2d(points[a], points[b], points[x]) * Orient2d(points[a], points[b], points[y])
+            < 0
+            && Orient2d(points[x], points[y], points[a]) * Orient2d(points[x], points[y], points[b])
+            < 0;
+    }
+
+    int Opposite(std::size_t t, int x, int y) const
+    {
+        for (int v : triangles[t]) {
+            if (v != x && v != y) {
+                return v;
+            }
+        }
+        return x;
+    }
+
+    void AddTriangle(int a, int b, int c)
+    {
+        std::size_t index = triangles.size();
+        triangles.push_back({a, b, c});
+        alive.push_back(true);
+        edges[EdgeKey(a, b)] = index;
+        edges[EdgeKey(b, c)] = index;
+        edges[EdgeKey(c, a)] = index;
+    }
+
+    void RemoveTriangle(std::size_t t)
+    {
+        alive[t] = false;
+        for (int i = 0; i < 3; i++) {
+            auto it = edges.find(EdgeKey(triangles[t][i], triangles[t][(i + 1) % 3]));
+            if (it != edges.end() && it->second == t) {
+                edges.erase(it);
+            }
+        }
+    }
+
+    std::vector<Point2d> points;
+    std::vector<std::array<int, 3>> triangles;
+    std::vector<bool> alive;
+    std::unordered_map<std::uint64_t, std::size_t> edges;
+};
+
+// ------------------------------------------------------------------------------------------------
+
+class Intersector
+{
+public:
+    Intersector(const MeshKernel& mesh1, const MeshKernel& mesh2, const Base::Vector3d& offset)
+        : meshes {&mesh1, &mesh2}
+    {
+        for (int side = 0; side < 2; side++) {
+            const MeshPointArray& pts = meshes[side]->GetPoints();
+            points[side].reserve(pts.size());
+            for (const auto& it : pts) {
+                points[side].push_back(Base::Vector3d(it.x, it.y, it.z) + offset * side);
+            }
+        }
+    }
+
+    const Base::Vector3d& GetPoint(int side, PointIndex index) const
+    {
+        return points[side][index];
+    }
+
+    const MeshFacetArray& GetFacets(int side) const
+    {
+        return meshes[side]->GetFacets();
+    }
+
+    const MeshFacet& GetFacet(int side, FacetIndex index) const
+    {
+        return meshes[side]->GetFacets()[index];
+    }
+
+    Triangle GetTriangle(int side, FacetIndex index) const
+    {
+        const MeshFacet& facet = GetFacet(side, index);
+        return {points[side][facet._aulPoints[0]],
+                points[side][facet._aulPoints[1]],
+                points[side][facet._aulPoints[2]]};
+    }
+
+    // computes the segment where the two facets cut each other
+    bool Intersect(FacetIndex index1, FacetIndex index2, Segment& segment) const
+    {
+        Triangle t1 = GetTriangle(0, index1);
+        Triangle t2 = GetTriangle(1, index2);
+        std::array<int, 3> side1 {};
+        std::array<int, 3> side2 {};
+        for (int i = 0; i < 3; i++) {
+            side1[i] = PlaneSide(t2, t1[i], 1);
+        }
+        if (side1[0] == side1[1] && side1[1] == side1[2]) {
+            return false;
+        }
+        for (int i = 0; i < 3; i++) {
+            side2[i] = PlaneSide(t1, t2[i], 0);
+        }
+        if (side2[0] == side2[1] && side2[1] == side2[2]) {
+            return false;
+        }
+
+        // Both facets cross the intersection line of the two planes between the points where
+        // two of their edges cross the plane of the other facet. The points are sorted along
+        // the direction n1 x n2 of the line.
+        Crossing start1 {};
+        Crossing end1 {};
+        Crossing start2 {};
+        Crossing end2 {};
+        CrossingEdges(0, index1, side1, index2, start1, end1);
+        CrossingEdges(1, index2, side2, index1, start2, end2);
+
+        Crossing start = Before(start1, start2) ? start2 : start1;
+        Crossing end = Before(end1, end2) ? end1 : end2;
+        if (start.side != end.side && !Before(start, end)) {
+            return false;
+        }
+
+        segment.facet1 = index1;
+        segment.facet2 = index2;
+        segment.start = start;
+        segment.end = end;
+        return true;
+    }
+
+    // computes the position of a crossing and its parameter on the edge from lo to hi
+    Base::Vector3d GetPosition(const Crossing& c, double& param) const
+    {
+        PointIndex lo = std::min(c.from, c.to);
+        PointIndex hi = std::max(c.from, c.to);
+        const Base::Vector3d& p = points[c.side][lo];
+        const Base::Vector3d& q = points[c.side][hi];
+        Triangle t = GetTriangle(1 - c.side, c.facet);
+        Base::Vector3d normal = (t[1] - t[0]) % (t[2] - t[0]);
+        double dp = normal * (p - t[0]);
+        double dq = normal * (q - t[0]);
+        param = dp != dq ? dp / (dp - dq) : 0.5;
+        param = std::clamp(param, 0.0, 1.0);
+        return p + (q - p) * param;
+    }
+
+private:
+    void CrossingEdges(
+        int side,
+        FacetIndex index,
+        const std::array<int, 3>& signs,
+        FacetIndex other,
+        Crossing& start,
+        Crossing& end
+    ) const
+    {
+        const MeshFacet& facet = GetFacet(side, index);
+        int lone = signs[0] != signs[1] ? (signs[0] != signs[2] ? 0 : 1) : 2;
+        PointIndex p = facet._aulPoints[lone];
+        PointIndex next = facet._aulPoints[(lone + 1) % 3];
+        PointIndex prev = facet._aulPoints[(lone + 2) % 3];
+        bool positive = signs[lone] > 0;
+        Crossing onNext {side, positive ? next : p, positive ? p : next, other};
+        Crossing onPrev {side, positive ? prev : p, positive ? p : prev, other};
+
+        // on the facet of the first mesh the crossing on the edge to the next point follows the
+        // one on the edge to the previous point if the lone point is on the positive side, and
+        // on the facet of the second mesh it is the other way round
+        bool nextFirst = (side == 0) != positive;
+        start = nextFirst ? onNext : onPrev;
+        end = nextFirst ? onPrev : onNext;
+    }
+
+    // true if the crossing \a a comes before \a b along the intersection line
+    bool Before(const Crossing& a, const Crossing& b) const
+    {
+        if (a.side == b.side) {
+            // both crossings lie on the same facet and are never compared to each other
+            return false;
+        }
+        if (a.side == 0) {
+            return EdgeOrder(
+                       points[0][a.from],
+                       points[0][a.to],
+                       points[1][b.from],
+                       points[1][b.to]
+                   )
+                > 0;
+        }
+        return EdgeOrder(points[0][b.from], points[0][b.to], points[1][a.from], points[1][a.to])
+            < 0;
+    }
+
+    std::array<const MeshKernel*, 2> meshes;
+    std::array<std::vector<Base::Vector3d>, 2> points;
+};
+
+// ------------------------------------------------------------------------------------------------
+
+// triangulates a facet that is cut by the given segments
+SubTriangles TriangulateFacet(
+    const Intersector& intersector,
+    int side,
+    FacetIndex index,
+    const std::vector<const Segment*>& segments
+)
+{
+    // the parameters of a point strictly inside the facet or one of its edges
+    const double border = 1e-12;
+    const MeshFacet& facet = intersector.GetFacet(side, index);
+    Triangle tria = intersector.GetTriangle(side, index);
+
+    FacetTriangulation triangulation;
+    std::vector<VertexKey> keys {
+        KeyOf(side, facet._aulPoints[0]),
+        KeyOf(side, facet._aulPoints[1]),
+        KeyOf(side, facet._aulPoints[2])
+    };
+    std::map<VertexKey, int> local;
+
+    auto parameters = [&](const Crossing& c) {
+        double t {};
+        Base::Vector3d pos = intersector.GetPosition(c, t);
+        if (c.side == side) {
+            // the crossing lies on an edge of this facet
+            PointIndex lo = std::min(c.from, c.to);
+            for (int i = 0; i < 3; i++) {
+                PointIndex p = facet._aulPoints[i];
+                PointIndex q = facet._aulPoints[(i + 1) % 3];
+                if ((p == c.from && q == c.to) || (p == c.to && q == c.from)) {
+                    double s = std::clamp(p == lo ? t : 1.0 - t, border, 1.0 - border);
+                    if (i == 0) {
+                        return Point2d {s, 0.0};
+                    }
+                    if (i == 2) {
+                        return Point2d {0.0, 1.0 - s};
+                    }
+                    // make sure that both parameters add up to exactly one
+                    double u = 1.0 - s;
+                    if (s < 0.5) {
+                        s = 1.0 - u;
+                    }
+                    return Point2d {u, s};
+                }
+            }
+        }
+
+        // the crossing lies inside this facet
+        Base::Vector3d e1 = tria[1] - tria[0];
+        Base::Vector3d e2 = tria[2] - tria[0];
+        Base::Vector3d w = pos - tria[0];
+        Base::Vector3d n = e1 % e2;
+        double nx = std::fabs(n.x);
+        double ny = std::fabs(n.y);
+        double nz = std::fabs(n.z);
+        auto project = [&](const Base::Vector3d& v) {
+            if (nx >= ny && nx >= nz) {
+                return Point2d {v.y, v.z};
+            }
+            if (ny >= nz) {
+                return Point2d {v.z, v.x};
+            }
+            return Point2d {v.x, v.y};
+        };
+        Point2d a = project(e1);
+        Point2d b = project(e2);
+        Point2d c2 = project(w);
+        double det = a.x * b.y - a.y * b.x;
+        double u = 1.0 / 3.0;
+        double v = 1.0 / 3.0;
+        if (det != 0.0) {
+            u = (c2.x * b.y - c2.y * b.x) / det;
+            v = (a.x * c2.y - a.y * c2.x) / det;
+        }
+        u = std::max(u, border);
+        v = std::max(v, border);
+        if (u + v > 1.0 - border) {
+            double scale = (1.0 - 2.0 * border) / (u + v);
+            u *= scale;
+            v *= scale;
+        }
+        return Point2d {u, v};
+    };
+
+    auto insert = [&](const Crossing& c) {
+        VertexKey key = KeyOf(c);
+        auto it = local.find(key);
+        if (it != local.end()) {
+            return it->second;
+        }
+        int index = triangulation.Insert(parameters(c));
+        if (index == int(keys.size())) {
+            keys.push_back(key);
+        }
+        local[key] = index;
+        return index;
+    };
+
+    // insert the points on the border first so that they never split an inner edge
+    for (bool onBorder : {true, false}) {
+        for (const Segment* it : segments) {
+            for (const Crossing* c : {&it->start, &it->end}) {
+                if ((c->side == side) == onBorder) {
+                    insert(*c);
+                }
+            }
+        }
+    }
+    for (const Segment* it : segments) {
+        int a = local[KeyOf(it->start)];
+        int b = local[KeyOf(it->end)];
+        if (a >= 0 && b >= 0 && a != b) {
+            triangulation.Recover(a, b);
+        }
+    }
+
+    SubTriangles result;
+    for (const auto& it : triangulation.GetTriangles()) {
+        result.push_back({keys[it[0]], keys[it[1]], keys[it[2]]});
+    }
+    return result;
+}
+
+// the generalized winding number of the closed mesh around the point
+double WindingNumber(const Intersector& intersector, int side, const Base::Vector3d& p, int threads)
+{
+    const MeshFacetArray& facets = intersector.GetFacets(side);
+    std::size_t blocks = std::max(1, threads);
+    std::size_t step = (facets.size() + blocks - 1) / blocks;
+    std::vector<double> angles(blocks, 0.0);
+    MeshCore::parallel_for(
+        blocks,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t block = begin; block < end; block++) {
+                std::size_t last = std::min(facets.size(), (block + 1) * step);
+                for (std::size_t f = block * step; f < last; f++) {
+                    Triangle t = intersector.GetTriangle(side, f);
+                    Base::Vector3d a = t[0] - p;
+                    Base::Vector3d b = t[1] - p;
+                    Base::Vector3d c = t[2] - p;
+                    double la = a.Length();
+                    double lb = b.Length();
+                    double lc = c.Length();
+                    double num = a * (b % c);
+                    double den = la * lb * lc + (a * b) * lc + (b * c) * la + (c * a) * lb;
+                    angles[block] += 2.0 * std::atan2(num, den);
+                }
+            }
+        },
+        threads
+    );
+
+    double sum = 0.0;
+    for (double it : angles) {
+        sum += it;
+    }
+    return sum / (4.0 * std::numbers::pi);
+}
+
+}  // namespace
+
+ExactSetOperations::ExactSetOperations(
+    const MeshKernel& mesh1,
+    const MeshKernel& mesh2,
+    MeshKernel& result,
+    SetOperations::OperationType opType
+)
+    : mesh1(mesh1)
+    , mesh2(mesh2)
+    , result(result)
+    , operationType(opType)
+    , threads(int(std::thread::hardware_concurrency()))
+{}
+
+void ExactSetOperations::Do()
+{
+    // Points that are only shifted by the symbolic perturbation cannot be told apart when the
+    // facets are triangulated. So the second mesh is also moved by a small real amount far below
+    // the precision of the float coordinates, which keeps coplanar facets apart in doubles.
+    Base::BoundBox3f box = mesh1.GetBoundBox();
+    box.Add(mesh2.GetBoundBox());
+    Base::Vector3d offset(1.0, 0.7548776662466927, 0.5698402909980532);
+    offset *= 1e-9 * box.CalcDiagonalLength();
+    Intersector intersector(mesh1, mesh2, offset);
+    std::array<std::size_t, 2> countFacets {mesh1.CountFacets(), mesh2.CountFacets()};
+
+    // cut all pairs of facets whose bounding boxes overlap
+    std::vector<std::vector<Segment>> cuts(countFacets[0]);
+    MeshFacetTree tree(mesh2);
+    tree.SetThreads(threads);
+    MeshCore::parallel_for(
+        countFacets[0],
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<FacetIndex> candidates;
+            for (std::size_t i = begin; i < end; i++) {
+                candidates.clear();
+                tree.FindOverlapping(mesh1.GetFacet(i).GetBoundBox(), candidates);
+                std::sort(candidates.begin(), candidates.end());
+                Segment segment {};
+                for (FacetIndex j : candidates) {
+                    if (intersector.Intersect(i, j, segment)) {
+                        cuts[i].push_back(segment);
+                    }
+                }
+            }
+        },
+        threads
+    );
+
+    std::array<std::vector<std::vector<const Segment*>>, 2> segments;
+    segments[0].resize(countFacets[0]);
+    segments[1].resize(countFacets[1]);
+    std::array<std::vector<FacetIndex>, 2> cutFacets;
+    for (FacetIndex i = 0; i < countFacets[0]; i++) {
+        for (const Segment& it : cuts[i]) {
+            segments[0][i].push_back(&it);
+            segments[1][it.facet2].push_back(&it);
+        }
+    }
+    for (int side = 0; side < 2; side++) {
+        for (FacetIndex i = 0; i < countFacets[side]; i++) {
+            if (!segments[side][i].empty()) {
+                cutFacets[side].push_back(i);
+            }
+        }
+    }
+
+    // triangulate the cut facets
+    std::array<std::vector<SubTriangles>, 2> subTriangles;
+    for (int side = 0; side < 2; side++) {
+        const auto& facets = cutFacets[side];
+        subTriangles[side].resize(facets.size());
+        MeshCore::parallel_for(
+            facets.size(),
+            [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) {
+                    subTriangles[side][i] =
+                        TriangulateFacet(intersector, side, facets[i], segments[side][facets[i]]);
+                }
+            },
+            threads
+        );
+    }
+
+    // collect the points and triangles of both meshes
+    std::map<VertexKey, PointIndex> crossingIndices;
+    std::vector<Base::Vector3d> points;
+    auto indexOf = [&](const VertexKey& key) -> PointIndex {
+        if (key.facet == FACET_INDEX_MAX) {
+            return key.side == 0 ? key.lo : mesh1.CountPoints() + key.lo;
+        }
+        auto it = crossingIndices.find(key);
+        if (it != crossingIndices.end()) {
+            return it->second;
+        }
+        PointIndex index = mesh1.CountPoints() + mesh2.CountPoints() + points.size();
+        double param {};
+        points.push_back(intersector.GetPosition({key.side, key.lo, key.hi, key.facet}, param));
+        crossingIndices[key] = index;
+        return index;
+    };
+
+    std::vector<std::array<PointIndex, 3>> triangles;
+    std::vector<int> sides;
+    for (int side = 0; side < 2; side++) {
+        std::size_t next = 0;
+        for (FacetIndex i = 0; i < countFacets[side]; i++) {
+            if (next < cutFacets[side].size() && cutFacets[side][next] == i) {
+                for (const auto& it : subTriangles[side][next]) {
+                    triangles.push_back({indexOf(it[0]), indexOf(it[1]), indexOf(it[2])});
+                    sides.push_back(side);
+                }
+                next++;
+            }
+            else {
+                const MeshFacet& facet = intersector.GetFacet(side, i);
+                triangles.push_back(
+                    {indexOf(KeyOf(side, facet._aulPoints[0])),
+                     indexOf(KeyOf(side, facet._aulPoints[1])),
+                     indexOf(KeyOf(side, facet._aulPoints[2]))}
+                );
+                sides.push_back(side);
+            }
+        }
+    }
+
+    auto edgeKey = [](PointIndex a, PointIndex b) {
+        return std::make_pair(std::min(a, b), std::max(a, b));
+    };
+    std::set<std::pair<PointIndex, PointIndex>> intersection;
+    for (const auto& it : cuts) {
+        for (const Segment& segment : it) {
+            PointIndex start = indexOf(KeyOf(segment.start));
+            PointIndex end = indexOf(KeyOf(segment.end));
+            intersection.insert(edgeKey(start, end));
+        }
+    }
+
+    // group the triangles into patches that are bounded by the intersection curves
+    std::vector<std::size_t> parent(triangles.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&](std::size_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    std::array<std::map<std::pair<PointIndex, PointIndex>, std::size_t>, 2> edges;
+    for (std::size_t i = 0; i < triangles.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            auto key = edgeKey(triangles[i][j], triangles[i][(j + 1) % 3]);
+            if (intersection.count(key) > 0) {
+                continue;
+            }
+            auto [it, inserted] = edges[sides[i]].emplace(key, i);
+            if (!inserted) {
+                std::size_t a = find(it->second);
+                std::size_t b = find(i);
+                parent[std::max(a, b)] = std::min(a, b);
+            }
+        }
+    }
+
+    // classify every patch by the winding number of the center of its largest triangle
+    auto position = [&](PointIndex i) -> Base::Vector3d {
+        if (i < mesh1.CountPoints()) {
+            return intersector.GetPoint(0, i);
+        }
+        if (i < mesh1.CountPoints() + mesh2.CountPoints()) {
+            return intersector.GetPoint(1, i - mesh1.CountPoints());
+        }
+        return points[i - mesh1.CountPoints() - mesh2.CountPoints()];
+    };
+    std::map<std::size_t, std::pair<std::size_t, double>> patches;
+    for (std::size_t i = 0; i < triangles.size(); i++) {
+        Base::Vector3d p0 = position(triangles[i][0]);
+        Base::Vector3d p1 = position(triangles[i][1]);
+        Base::Vector3d p2 = position(triangles[i][2]);
+        double area = ((p1 - p0) % (p2 - p0)).Length();
+        auto [it, inserted] = patches.emplace(find(i), std::make_pair(i, area));
+        if (!inserted && area > it->second.second) {
+            it->second = std::make_pair(i, area);
+        }
+    }
+
+    std::map<std::size_t, bool> inside;
+    for (const auto& [root, largest] : patches) {
+        const auto& tria = triangles[largest.first];
+        int side = sides[largest.first];
+        Base::Vector3d center =
+            (position(tria[0]) + position(tria[1]) + position(tria[2])) / 3.0;
+        inside[root] = WindingNumber(intersector, 1 - side, center, threads) > 0.5;
+    }
+
+    // keep the wanted patches
+    auto keep = [this](int side, bool inner) {
+        switch (operationType) {
+            case SetOperations::Union:
+                return !inner;
+            case SetOperations::Intersect:
+                return inner;
+            case SetOperations::Difference:
+                return side == 0 ? !inner : inner;
+            case SetOperations::Inner:
+                return side == 0 && inner;
+            case SetOperations::Outer:
+                return side == 0 && !inner;
+            default:
+                return false;
+        }
+    };
+
+    MeshPointArray resultPoints;
+    MeshFacetArray resultFacets;
+    std::vector<PointIndex> used(mesh1.CountPoints() + mesh2.CountPoints() + points.size(),
+                                 POINT_INDEX_MAX);
+    for (std::size_t i = 0; i < triangles.size(); i++) {
+        int side = sides[i];
+        if (!keep(side, inside[find(i)])) {
+            continue;
+        }
+        std::array<PointIndex, 3> tria = triangles[i];
+        if (side == 1 && operationType == SetOperations::Difference) {
+            std::swap(tria[1], tria[2]);
+        }
+        for (PointIndex& it : tria) {
+            if (used[it] == POINT_INDEX_MAX) {
+                used[it] = resultPoints.size();
+                if (it < mesh1.CountPoints()) {
+                    resultPoints.push_back(mesh1.GetPoint(it));
+                }
+                else if (it < mesh1.CountPoints() + mesh2.CountPoints()) {
+                    resultPoints.push_back(mesh2.GetPoint(it - mesh1.CountPoints()));
+                }
+                else {
+                    Base::Vector3d p = position(it);
+                    resultPoints.emplace_back(Base::Vector3f(float(p.x), float(p.y), float(p.z)));
+                }
+            }
+            it = used[it];
+        }
+        resultFacets.emplace_back(tria[0], tria[1], tria[2]);
+    }
+
+    result.Adopt(resultPoints, resultFacets, true);
+}
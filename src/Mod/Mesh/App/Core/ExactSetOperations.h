@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include "SetOperations.h"
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The ExactSetOperations class computes the same boolean operations as SetOperations but
+ * decides every intersection with exact orientation predicates instead of distance tolerances.
+ * Two facets are cut along a segment whose end points are identified by the edge and the facet
+ * they come from, so both facets are split along the same points and the result is closed if
+ * both input meshes are closed. The parts are then kept or dropped by their winding number with
+ * respect to the other mesh.
+ * Points of the second mesh that lie exactly on a facet of the first mesh are handled by moving
+ * the second mesh by an amount far below the float precision of its points, and the cases that
+ * are still degenerate after this are resolved by a symbolic perturbation. Therefore coplanar
+ * facets never intersect but leave slivers of zero thickness, and touching meshes are kept apart.
+ */
+class MeshExport ExactSetOperations
+{
+public:
+    ExactSetOperations(
+        const MeshKernel& mesh1,
+        const MeshKernel& mesh2,
+        MeshKernel& result,
+        SetOperations::OperationType opType
+    );
+
+    /// Sets the number of threads used to intersect the facets and to classify the parts
+    void SetThreads(int num)
+    {
+        threads = num;
+    }
+    /// Computes the result mesh
+    void Do();
+
+private:
+    const MeshKernel& mesh1;
+    const MeshKernel& mesh2;
+    MeshKernel& result;
+    SetOperations::OperationType operationType;
+    int threads;
+};
+
+}  // namespace MeshCore
@@ -0,0 +1,373 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <numeric>
+#include <thread>
+
+#include "FacetTree.h"
+#include "Functional.h"
+#include "Iterator.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// ranges up to this size are not split any further but scanned linearly
+const std::size_t LeafSize = 4;
+// ranges smaller than this are built on the current thread
+const std::size_t MinParallelSize = 10000;
+
+inline float SqrDistance(const Base::BoundBox3f& box, const Base::Vector3f& p)
+{
+    float dx = std::max(std::max(box.MinX - p.x, p.x - box.MaxX), 0.0F);
+    float dy = std::max(std::max(box.MinY - p.y, p.y - box.MaxY), 0.0F);
+    float dz = std::max(std::max(box.MinZ - p.z, p.z - box.MaxZ), 0.0F);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// unlike BoundBox3f::Intersect() boxes that only touch each other count as overlapping
+inline bool Touches(const Base::BoundBox3f& box1, const Base::BoundBox3f& box2)
+{
+    return box1.MinX <= box2.MaxX && box2.MinX <= box1.MaxX && box1.MinY <= box2.MaxY
+        && box2.MinY <= box1.MaxY && box1.MinZ <= box2.MaxZ && box2.MinZ <= box1.MaxZ;
+}
+}  // namespace
+
+/*
+ * Keeps the nearest facet found so far. Facets with equal distance are ordered by their
+ * original index so that the result doesn't depend on the tree layout.
+ */
+class MeshFacetTree::Nearest
+{
+public:
+    Nearest(const MeshFacetTree& owner, float max_dist)
+        : tree(owner)
+        , sqrBound(max_dist * max_dist)
+    {}
+
+    void Test(std::size_t pos, const Base::Vector3f& p)
+    {
+        Base::Vector3f pnt;
+        float dist = tree.facets[pos].DistanceToPoint(p, pnt);
+        float sqrDist = dist * dist;
+        if (sqrDist > sqrBound) {
+            return;
+        }
+        if (found && sqrDist == sqrBound && tree.indices[pos] > tree.indices[slot]) {
+            return;
+        }
+
+        found = true;
+        sqrBound = sqrDist;
+        slot = pos;
+        nearest = pnt;
+    }
+    float Bound() const
+    {
+        return sqrBound;
+    }
+
+    const MeshFacetTree& tree;
+    float sqrBound;
+    bool found {false};
+    std::size_t slot {0};
+    Base::Vector3f nearest;
+};
+
+MeshFacetTree::MeshFacetTree()
+    : threads(int(std::thread::hardware_concurrency()))
+{}
+
+MeshFacetTree::MeshFacetTree(const MeshKernel& kernel)
+    : threads(int(std::thread::hardware_concurrency()))
+{
+    Build(kernel);
+}
+
+MeshFacetTree::MeshFacetTree(const std::vector<MeshGeomFacet>& triangles)
+    : threads(int(std::thread::hardware_concurrency()))
+{
+    Build(triangles);
+}
+
+void MeshFacetTree::Build(const MeshKernel& kernel)
+{
+    facets.clear();
+    facets.reserve(kernel.CountFacets());
+    MeshFacetIterator it(kernel);
+    for (it.Init(); it.More(); it.Next()) {
+        facets.push_back(*it);
+    }
+
+    BuildTree();
+}
+
+void MeshFacetTree::Build(const std::vector<MeshGeomFacet>& triangles)
+{
+    facets = triangles;
+    BuildTree();
+}
+
+void MeshFacetTree::Clear()
+{
+    facets.clear();
+    indices.clear();
+    positions.clear();
+    boxes.clear();
+}
+
+void MeshFacetTree::BuildTree()
+{
+    std::size_t count = facets.size();
+    std::vector<Base::Vector3f> centers(count);
+    for (std::size_t i = 0; i < count; i++) {
+        // the normal is computed lazily, so do it now to make concurrent queries safe
+        facets[i].CalcNormal();
+        centers[i] = facets[i].GetGravityPoint();
+    }
+
+    indices.resize(count);
+    std::iota(indices.begin(), indices.end(), FacetIndex(0));
+
+    // the right child always gets the larger half, so its path is the deepest one
+    std::size_t last = 0;
+    for (std::size_t size = count; size > LeafSize; size -= size / 2) {
+        last = 2 * last + 2;
+    }
+    boxes.assign(count > 0 ? last + 1 : 0, Base::BoundBox3f());
+
+    if (count > 0) {
+        BuildRange(0, 0, count, centers, threads);
+    }
+
+    std::vector<MeshGeomFacet> sorted;
+    sorted.reserve(count);
+    positions.resize(count);
+    for (std::size_t i = 0; i < count; i++) {
+        sorted.push_back(facets[indices[i]]);
+        positions[indices[i]] = i;
+    }
+    facets.swap(sorted);
+}
+
+void MeshFacetTree::BuildRange(
+    std::size_t node,
+    std::size_t lo,
+    std::size_t hi,
+    const std::vector<Base::Vector3f>& centers,
+    int tasks
+)
+{
+    Base::BoundBox3f box;
+    Base::BoundBox3f centerBox;
+    for (std::size_t i = lo; i < hi; i++) {
+        const MeshGeomFacet& facet = facets[indices[i]];
+        box.Add(facet._aclPoints[0]);
+        box.Add(facet._aclPoints[1]);
+        box.Add(facet._aclPoints[2]);
+        centerBox.Add(centers[indices[i]]);
+    }
+    boxes[node] = box;
+
+    if (hi - lo <= LeafSize) {
+        return;
+    }
+
+    // split the range at the median of the facet centers along the largest extent
+    unsigned short axis = 0;
+    if (centerBox.LengthY() > centerBox.LengthX()) {
+        axis = 1;
+    }
+    if (centerBox.LengthZ() > std::max(centerBox.LengthX(), centerBox.LengthY())) {
+        axis = 2;
+    }
+
+    std::size_t mid = lo + (hi - lo) / 2;
+    auto first = indices.begin();
+    std::nth_element(
+        first + std::ptrdiff_t(lo),
+        first + std::ptrdiff_t(mid),
+        first + std::ptrdiff_t(hi),
+        [axis, &centers](FacetIndex f1, FacetIndex f2) {
+            return centers[f1][axis] < centers[f2][axis];
+        }
+    );
+
+    // both halves are disjoint and can be built independently
+    if (tasks > 1 && hi - lo > MinParallelSize) {
+        std::future<void> left = std::async(
+            std::launch::async,
+            &MeshFacetTree::BuildRange,
+            this,
+            2 * node + 1,
+            lo,
+            mid,
+            std::cref(centers),
+            tasks / 2
+        );
+        BuildRange(2 * node + 2, mid, hi, centers, tasks - tasks / 2);
+        left.get();
+    }
+    else {
+        BuildRange(2 * node + 1, lo, mid, centers, 1);
+        BuildRange(2 * node + 2, mid, hi, centers, 1);
+    }
+}
+
+Base::BoundBox3f MeshFacetTree::GetBoundBox() const
+{
+    return boxes.empty() ? Base::BoundBox3f() : boxes.front();
+}
+
+void MeshFacetTree::SearchNearest(
+    std::size_t node,
+    std::size_t lo,
+    std::size_t hi,
+    const Base::Vector3f& p,
+    Nearest& result
+) const
+{
+    if (hi - lo <= LeafSize) {
+        for (std::size_t i = lo; i < hi; i++) {
+            result.Test(i, p);
+        }
+        return;
+    }
+
+    // descend into the nearer child first to shrink the bound as early as possible
+    std::size_t mid = lo + (hi - lo) / 2;
+    std::size_t left = 2 * node + 1;
+    std::size_t right = 2 * node + 2;
+    float sqrLeft = SqrDistance(boxes[left], p);
+    float sqrRight = SqrDistance(boxes[right], p);
+    if (sqrLeft <= sqrRight) {
+        if (sqrLeft <= result.Bound()) {
+            SearchNearest(left, lo, mid, p, result);
+        }
+        if (sqrRight <= result.Bound()) {
+            SearchNearest(right, mid, hi, p, result);
+        }
+    }
+    else {
+        if (sqrRight <= result.Bound()) {
+            SearchNearest(right, mid, hi, p, result);
+        }
+        if (sqrLeft <= result.Bound()) {
+            SearchNearest(left, lo, mid, p, result);
+        }
+    }
+}
+
+void MeshFacetTree::SearchOverlapping(
+    std::size_t node,
+    std::size_t lo,
+    std::size_t hi,
+    const Base::BoundBox3f& box,
+    std::vector<FacetIndex>& result
+) const
+{
+    if (!Touches(boxes[node], box)) {
+        return;
+    }
+
+    if (hi - lo <= LeafSize) {
+        for (std::size_t i = lo; i < hi; i++) {
+            if (Touches(facets[i].GetBoundBox(), box)) {
+                result.push_back(indices[i]);
+            }
+        }
+        return;
+    }
+
+    std::size_t mid = lo + (hi - lo) / 2;
+    SearchOverlapping(2 * node + 1, lo, mid, box, result);
+    SearchOverlapping(2 * node + 2, mid, hi, box, result);
+}
+
+void MeshFacetTree::FindOverlapping(
+    const Base::BoundBox3f& box,
+    std::vector<FacetIndex>& result
+) const
+{
+    if (!facets.empty()) {
+        SearchOverlapping(0, 0, facets.size(), box, result);
+    }
+}
+
+FacetIndex MeshFacetTree::FindNearest(
+    const Base::Vector3f& p,
+    float max_dist,
+    Base::Vector3f& nearest,
+    float& dist
+) const
+{
+    if (facets.empty() || SqrDistance(boxes.front(), p) > max_dist * max_dist) {
+        return FACET_INDEX_MAX;
+    }
+
+    Nearest result(*this, max_dist);
+    SearchNearest(0, 0, facets.size(), p, result);
+    if (!result.found) {
+        return FACET_INDEX_MAX;
+    }
+
+    nearest = result.nearest;
+    dist = std::sqrt(result.sqrBound);
+    return indices[result.slot];
+}
+
+void MeshFacetTree::FindNearest(
+    const std::vector<Base::Vector3f>& queries,
+    float max_dist,
+    std::vector<FacetIndex>& facetIndices,
+    std::vector<float>& dists
+) const
+{
+    std::size_t count = queries.size();
+    facetIndices.assign(count, FACET_INDEX_MAX);
+    dists.assign(count, std::numeric_limits<float>::max());
+    if (facets.empty()) {
+        return;
+    }
+
+    MeshCore::parallel_for(
+        count,
+        [&](std::size_t begin, std::size_t end) {
+            Base::Vector3f nearest;
+            for (std::size_t i = begin; i < end; i++) {
+                float dist {};
+                FacetIndex index = FindNearest(queries[i], max_dist, nearest, dist);
+                if (index != FACET_INDEX_MAX) {
+                    facetIndices[i] = index;
+                    dists[i] = dist;
+                }
+            }
+        },
+        threads
+    );
+}
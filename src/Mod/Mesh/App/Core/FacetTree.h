@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include <Base/BoundBox.h>
+
+#include "Elements.h"
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The MeshFacetTree class is a bounding volume hierarchy over the facets of a mesh that answers
+ * closest-point queries. The tree keeps its own copy of the facets, so it stays valid if the mesh
+ * it was built from is changed or destroyed. Like MeshStaticKDTree it is built once, and the
+ * construction as well as the batched queries run in parallel.
+ * All query methods are const and may be called concurrently from several threads.
+ */
+class MeshExport MeshFacetTree
+{
+public:
+    MeshFacetTree();
+    explicit MeshFacetTree(const MeshKernel& kernel);
+    explicit MeshFacetTree(const std::vector<MeshGeomFacet>& triangles);
+
+    /// Sets the number of threads used for construction and batched queries
+    void SetThreads(int num)
+    {
+        threads = num;
+    }
+    int GetThreads() const
+    {
+        return threads;
+    }
+
+    void Build(const MeshKernel& kernel);
+    void Build(const std::vector<MeshGeomFacet>& triangles);
+
+    bool IsEmpty() const
+    {
+        return facets.empty();
+    }
+    std::size_t Size() const
+    {
+        return facets.size();
+    }
+    void Clear();
+
+    /// Returns the bounding box of all facets
+    Base::BoundBox3f GetBoundBox() const;
+    /// Returns the facet with the index \a index it had when the tree was built
+    const MeshGeomFacet& GetFacet(FacetIndex index) const
+    {
+        return facets[positions[index]];
+    }
+
+    /** @name Single queries */
+    //@{
+    /** Searches for the facet nearest to \a p within \a max_dist. The closest point on the facet
+     * is written to \a nearest and its distance to \a dist.
+     * Returns FACET_INDEX_MAX if there is no facet within \a max_dist.
+     */
+    FacetIndex FindNearest(
+        const Base::Vector3f& p,
+        float max_dist,
+        Base::Vector3f& nearest,
+        float& dist
+    ) const;
+    //@}
+
+    /** @name Batched queries */
+    //@{
+    /** Searches for the nearest facet of every query point within \a max_dist. The results of
+     * the i-th query are stored at \a facetIndices[i] and \a dists[i]. Queries without a facet in
+     * range get FACET_INDEX_MAX and the maximum float value.
+     */
+    void FindNearest(
+        const std::vector<Base::Vector3f>& queries,
+        float max_dist,
+        std::vector<FacetIndex>& facetIndices,
+        std::vector<float>& dists
+    ) const;
+    //@}
+
+    /** @name Box queries */
+    //@{
+    /** Appends the indices of all facets whose bounding box touches or overlaps \a box to
+     * \a result.
+     */
+    void FindOverlapping(const Base::BoundBox3f& box, std::vector<FacetIndex>& result) const;
+    //@}
+
+private:
+    class Nearest;
+
+    void BuildTree();
+    void BuildRange(
+        std::size_t node,
+        std::size_t lo,
+        std::size_t hi,
+        const std::vector<Base::Vector3f>& centers,
+        int tasks
+    );
+    void SearchNearest(
+        std::size_t node,
+        std::size_t lo,
+        std::size_t hi,
+        const Base::Vector3f& p,
+        Nearest& result
+    ) const;
+    void SearchOverlapping(
+        std::size_t node,
+        std::size_t lo,
+        std::size_t hi,
+        const Base::BoundBox3f& box,
+        std::vector<FacetIndex>& result
+    ) const;
+
+private:
+    // the facets and their original indices in the order of the tree leaves
+    std::vector<MeshGeomFacet> facets;
+    std::vector<FacetIndex> indices;
+    // maps an original facet index to its position in the tree
+    std::vector<std::size_t> positions;
+    // the boxes of an implicit binary tree, the children of node i are 2i+1 and 2i+2
+    std::vector<Base::BoundBox3f> boxes;
+    int threads;
+};
+
+}  // namespace MeshCore
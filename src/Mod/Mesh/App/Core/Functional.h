@@ -25,7 +25,9 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <future>
+#include <vector>
 
 
 namespace MeshCore
@@ -61,4 +63,33 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/**
+ * Splits the index range [0, count) into up to \a threads contiguous blocks and
+ * calls \a func(begin, end) for each block concurrently. The blocks are disjoint
+ * so that \a func may write to per-index output without further locking.
+ */
+template<class Func>
+static void parallel_for(std::size_t count, Func func, int threads)
+{
+    if (threads < 2 || count < 2) {
+        func(std::size_t(0), count);
+        return;
+    }
+
+    std::size_t blocks = std::min<std::size_t>(std::size_t(threads), count);
+    std::size_t step = (count + blocks - 1) / blocks;
+    std::vector<std::future<void>> futures;
+    futures.reserve(blocks);
+    for (std::size_t begin = step; begin < count; begin += step) {
+        std::size_t end = std::min(begin + step, count);
+        futures.push_back(std::async(std::launch::async, func, begin, end));
+    }
+
+    // the calling thread processes the first block
+    func(std::size_t(0), std::min(step, count));
+    for (auto& it : futures) {
+        it.get();
+    }
+}
+
 }  // namespace MeshCore
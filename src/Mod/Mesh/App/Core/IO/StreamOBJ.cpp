@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <algorithm>
+#include <istream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "StreamOBJ.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// returns the keyword of the line and leaves the stream behind it
+std::string Keyword(std::istringstream& str)
+{
+    std::string kw;
+    str >> kw;
+    return kw;
+}
+}  // namespace
+
+StreamReaderOBJ::StreamReaderOBJ(std::istream& str, std::size_t blockSize)
+    : _str(str)
+    , _blockSize(std::max<std::size_t>(blockSize, 1))
+{
+    if (!_str || _str.bad()) {
+        return;
+    }
+
+    // The first pass only keeps the vertices and counts the triangles. The faces
+    // are read again by ReadBlock().
+    _start = _str.tellg();
+    std::string line;
+    while (std::getline(_str, line)) {
+        std::istringstream lineStr(line);
+        std::string kw = Keyword(lineStr);
+        if (kw == "v") {
+            Base::Vector3f pnt;
+            lineStr >> pnt.x >> pnt.y >> pnt.z;
+            if (lineStr.fail()) {
+                return;
+            }
+            _points.push_back(pnt);
+        }
+        else if (kw == "f") {
+            std::size_t corners = 0;
+            std::string token;
+            while (lineStr >> token) {
+                corners++;
+            }
+            if (corners > 2) {
+                _numFacets += corners - 2;
+            }
+        }
+    }
+
+    _valid = !_points.empty();
+    Rewind();
+}
+
+bool StreamReaderOBJ::IsValid() const
+{
+    return _valid;
+}
+
+std::size_t StreamReaderOBJ::CountFacets() const
+{
+    return _numFacets;
+}
+
+std::size_t StreamReaderOBJ::CountPoints() const
+{
+    return _points.size();
+}
+
+void StreamReaderOBJ::Rewind()
+{
+    _str.clear();
+    _str.seekg(_start, std::ios::beg);
+    _numVertexes = 0;
+}
+
+bool StreamReaderOBJ::ReadBlock(std::vector<MeshGeomFacet>& facets)
+{
+    facets.clear();
+    if (!_valid) {
+        return false;
+    }
+
+    std::string line;
+    while (facets.size() < _blockSize && std::getline(_str, line)) {
+        std::istringstream lineStr(line);
+        std::string kw = Keyword(lineStr);
+        if (kw == "v") {
+            // needed to resolve relative indices
+            _numVertexes++;
+        }
+        else if (kw == "f") {
+            ReadFace(lineStr, facets);
+        }
+    }
+
+    return !facets.empty();
+}
+
+bool StreamReaderOBJ::ReadFace(std::istream& str, std::vector<MeshGeomFacet>& facets)
+{
+    // a corner is given as v, v/vt, v//vn or v/vt/vn
+    _indices.clear();
+    std::string token;
+    while (str >> token) {
+        long index {};
+        try {
+            index = std::stol(token.substr(0, token.find('/')));
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+
+        if (index < 0) {
+            index += static_cast<long>(_numVertexes);
+        }
+        else {
+            index -= 1;
+        }
+        if (index < 0 || index >= static_cast<long>(_points.size())) {
+            return false;
+        }
+        _indices.push_back(index);
+    }
+
+    for (std::size_t i = 2; i < _indices.size(); i++) {
+        MeshGeomFacet facet(_points[_indices[0]], _points[_indices[i - 1]], _points[_indices[i]]);
+        facets.push_back(facet);
+    }
+
+    return true;
+}
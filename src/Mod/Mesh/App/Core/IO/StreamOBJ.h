@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <iosfwd>
+#include <vector>
+
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/MeshGlobal.h>
+
+#include "StreamReader.h"
+
+
+namespace MeshCore
+{
+
+/** Reads the faces of an OBJ file in blocks.
+ * Only the vertices are kept in memory, the faces are read line by line when they are
+ * requested. Polygons are split into a fan of triangles and negative (relative) indices
+ * are supported. Texture coordinates, normals, groups and materials are ignored.
+ */
+class MeshExport StreamReaderOBJ: public StreamReader
+{
+public:
+    /*!
+     * \brief StreamReaderOBJ
+     * \param str The input stream must be seekable.
+     * \param blockSize The number of facets after which ReadBlock() returns. As a polygon
+     * is never split across two blocks a block may contain a few more facets.
+     */
+    explicit StreamReaderOBJ(std::istream& str, std::size_t blockSize = 65536);
+    bool IsValid() const override;
+    /*!
+     * \brief Returns the number of triangles of all faces of the file.
+     */
+    std::size_t CountFacets() const override;
+    /*!
+     * \brief Returns the number of vertices of the file.
+     */
+    std::size_t CountPoints() const;
+    bool ReadBlock(std::vector<MeshGeomFacet>& facets) override;
+    void Rewind() override;
+
+private:
+    bool ReadFace(std::istream& str, std::vector<MeshGeomFacet>& facets);
+
+private:
+    std::istream& _str;
+    std::size_t _blockSize;
+    std::size_t _numFacets = 0;
+    std::size_t _numVertexes = 0;
+    std::streamoff _start = 0;
+    std::vector<Base::Vector3f> _points;
+    std::vector<long> _indices;
+    bool _valid = false;
+};
+
+}  // namespace MeshCore
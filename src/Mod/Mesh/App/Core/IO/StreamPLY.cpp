@@ -0,0 +1,370 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <istream>
+#include <sstream>
+
+#include <Base/Stream.h>
+
+#include "StreamPLY.h"
+
+
+using namespace MeshCore;
+
+StreamReaderPLY::StreamReaderPLY(std::istream& str, std::size_t blockSize)
+    : _str(str)
+    , _blockSize(std::max<std::size_t>(blockSize, 1))
+{
+    if (!_str || _str.bad() || !ReadHeader()) {
+        return;
+    }
+
+    // Only the vertices are read now. The begin of the faces is remembered for ReadBlock().
+    bool hasVertexes = false;
+    for (std::size_t i = 0; i < _elements.size(); i++) {
+        const Element& element = _elements[i];
+        if (element.name == "vertex") {
+            if (!ReadVertexes(element)) {
+                return;
+            }
+            hasVertexes = true;
+        }
+        else if (element.name == "face" && _faceIndexProperty >= 0) {
+            _faceElement = static_cast<int>(i);
+            _numFaces = element.count;
+            _start = _str.tellg();
+            if (!hasVertexes && !SkipElement(element)) {
+                return;
+            }
+        }
+        else if (!SkipElement(element)) {
+            return;
+        }
+
+        if (hasVertexes && _faceElement >= 0) {
+            break;
+        }
+    }
+
+    _valid = hasVertexes && _faceElement >= 0;
+    Rewind();
+}
+
+StreamReaderPLY::~StreamReaderPLY() = default;
+
+bool StreamReaderPLY::ReadHeader()
+{
+    std::string line;
+    if (!std::getline(_str, line) || line.compare(0, 3, "ply") != 0) {
+        return false;
+    }
+
+    bool hasFormat = false;
+    while (std::getline(_str, line)) {
+        std::istringstream lineStr(line);
+        std::string kw;
+        lineStr >> kw;
+        if (kw == "format") {
+            std::string format;
+            std::string version;
+            lineStr >> format >> version;
+            if (format == "ascii") {
+                _ascii = true;
+            }
+            else if (format == "binary_little_endian" || format == "binary_big_endian") {
+                _binary = std::make_unique<Base::InputStream>(_str);
+                _binary->setByteOrder(
+                    format == "binary_little_endian" ? Base::Stream::LittleEndian
+                                                     : Base::Stream::BigEndian
+                );
+            }
+            else {
+                return false;
+            }
+            hasFormat = (version == "1.0");
+        }
+        else if (kw == "element") {
+            Element element;
+            lineStr >> element.name >> element.count;
+            if (lineStr.fail()) {
+                return false;
+            }
+            _elements.push_back(element);
+        }
+        else if (kw == "property") {
+            if (_elements.empty()) {
+                return false;
+            }
+
+            static const std::array<const char*, 8> names32 = {
+                "int8", "uint8", "int16", "uint16", "int32", "uint32", "float32", "float64"
+            };
+            static const std::array<const char*, 8> names = {
+                "char", "uchar", "short", "ushort", "int", "uint", "float", "double"
+            };
+            auto toNumber = [](const std::string& type, Number& number) {
+                for (std::size_t i = 0; i < names.size(); i++) {
+                    if (type == names[i] || type == names32[i]) {
+                        number = static_cast<Number>(i);
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            Property prop;
+            std::string type;
+            lineStr >> type;
+            if (type == "list") {
+                std::string countType;
+                lineStr >> countType >> type;
+                if (!toNumber(countType, prop.countType)) {
+                    return false;
+                }
+                prop.list = true;
+            }
+            lineStr >> prop.name;
+            if (!toNumber(type, prop.type) || lineStr.fail()) {
+                return false;
+            }
+
+            Element& element = _elements.back();
+            if (element.name == "face" && prop.list
+                && (prop.name == "vertex_indices" || prop.name == "vertex_index")) {
+                _faceIndexProperty = static_cast<int>(element.properties.size());
+            }
+            element.properties.push_back(prop);
+        }
+        else if (kw == "end_header") {
+            return hasFormat;
+        }
+    }
+
+    return false;
+}
+
+bool StreamReaderPLY::IsValid() const
+{
+    return _valid;
+}
+
+std::size_t StreamReaderPLY::CountFacets() const
+{
+    return _numFaces;
+}
+
+std::size_t StreamReaderPLY::CountPoints() const
+{
+    return _points.size();
+}
+
+void StreamReaderPLY::Rewind()
+{
+    _str.clear();
+    _str.seekg(_start, std::ios::beg);
+    _readFaces = 0;
+}
+
+bool StreamReaderPLY::ReadBinaryValue(Number type, double& value)
+{
+    Base::InputStream& is = *_binary;
+    switch (type) {
+        case int8: {
+            int8_t vt {};
+            is >> vt;
+            value = vt;
+        } break;
+        case uint8: {
+            uint8_t vt {};
+            is >> vt;
+            value = vt;
+        } break;
+        case int16: {
+            int16_t vt {};
+            is >> vt;
+            value = vt;
+        } break;
+        case uint16: {
+            uint16_t vt {};
+            is >> vt;
+            value = vt;
+        } break;
+        case int32: {
+            int32_t vt {};
+            is >> vt;
+            value = vt;
+        } break;
+        case uint32: {
+            uint32_t vt {};
+            is >> vt;
+            value = vt;
+        } break;
+        case float32: {
+            float vt {};
+            is >> vt;
+            value = vt;
+        } break;
+        case float64: {
+            is >> value;
+        } break;
+    }
+
+    return !_str.fail();
+}
+
+bool StreamReaderPLY::ReadItem(const Element& element)
+{
+    // all values of an item are stored one after another, a list starts with its length
+    _values.clear();
+    _offsets.clear();
+
+    if (_ascii) {
+        std::string line;
+        if (!std::getline(_str, line)) {
+            return false;
+        }
+        std::istringstream lineStr(line);
+        for (const auto& prop : element.properties) {
+            _offsets.push_back(_values.size());
+            std::size_t count = 1;
+            if (prop.list) {
+                lineStr >> count;
+                _values.push_back(double(count));
+            }
+            for (std::size_t i = 0; i < count; i++) {
+                double value {};
+                lineStr >> value;
+                _values.push_back(value);
+            }
+        }
+        return !lineStr.fail();
+    }
+
+    for (const auto& prop : element.properties) {
+        _offsets.push_back(_values.size());
+        std::size_t count = 1;
+        if (prop.list) {
+            double value {};
+            if (!ReadBinaryValue(prop.countType, value) || value < 0.0) {
+                return false;
+            }
+            count = static_cast<std::size_t>(value);
+            _values.push_back(value);
+        }
+        for (std::size_t i = 0; i < count; i++) {
+            double value {};
+            if (!ReadBinaryValue(prop.type, value)) {
+                return false;
+            }
+            _values.push_back(value);
+        }
+    }
+
+    return true;
+}
+
+bool StreamReaderPLY::ReadVertexes(const Element& element)
+{
+    std::array<int, 3> coords = {-1, -1, -1};
+    for (std::size_t i = 0; i < element.properties.size(); i++) {
+        const Property& prop = element.properties[i];
+        if (!prop.list && prop.name.size() == 1 && prop.name[0] >= 'x' && prop.name[0] <= 'z') {
+            coords[prop.name[0] - 'x'] = static_cast<int>(i);
+        }
+    }
+    if (std::find(coords.begin(), coords.end(), -1) != coords.end()) {
+        return false;
+    }
+
+    _points.reserve(element.count);
+    for (std::size_t i = 0; i < element.count; i++) {
+        if (!ReadItem(element)) {
+            return false;
+        }
+        _points.emplace_back(
+            static_cast<float>(_values[_offsets[coords[0]]]),
+            static_cast<float>(_values[_offsets[coords[1]]]),
+            static_cast<float>(_values[_offsets[coords[2]]])
+        );
+    }
+
+    return true;
+}
+
+bool StreamReaderPLY::SkipElement(const Element& element)
+{
+    for (std::size_t i = 0; i < element.count; i++) {
+        if (!ReadItem(element)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool StreamReaderPLY::ReadBlock(std::vector<MeshGeomFacet>& facets)
+{
+    facets.clear();
+    if (!_valid) {
+        return false;
+    }
+
+    while (facets.size() < _blockSize && _readFaces < _numFaces) {
+        if (!ReadFace(facets)) {
+            // a truncated file ends the reading
+            _readFaces = _numFaces;
+            break;
+        }
+        _readFaces++;
+    }
+
+    return !facets.empty();
+}
+
+bool StreamReaderPLY::ReadFace(std::vector<MeshGeomFacet>& facets)
+{
+    if (!ReadItem(_elements[_faceElement])) {
+        return false;
+    }
+
+    std::size_t offset = _offsets[_faceIndexProperty];
+    auto count = static_cast<std::size_t>(_values[offset]);
+    _indices.clear();
+    for (std::size_t i = 1; i <= count; i++) {
+        auto index = static_cast<long>(_values[offset + i]);
+        if (index < 0 || index >= static_cast<long>(_points.size())) {
+            // skip invalid faces
+            return true;
+        }
+        _indices.push_back(index);
+    }
+
+    for (std::size_t i = 2; i < _indices.size(); i++) {
+        MeshGeomFacet facet(_points[_indices[0]], _points[_indices[i - 1]], _points[_indices[i]]);
+        facets.push_back(facet);
+    }
+
+    return true;
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/MeshGlobal.h>
+
+#include "StreamReader.h"
+
+namespace Base
+{
+class InputStream;
+}
+
+namespace MeshCore
+{
+
+/** Reads the faces of an ASCII or binary PLY file in blocks.
+ * Only the vertices are kept in memory, the faces are read when they are requested.
+ * Polygons are split into a fan of triangles, unknown elements and properties are
+ * skipped. If the face element comes before the vertex element the faces are skipped
+ * once to get the vertices.
+ */
+class MeshExport StreamReaderPLY: public StreamReader
+{
+public:
+    /*!
+     * \brief StreamReaderPLY
+     * \param str The input stream must be seekable and opened in binary mode.
+     * \param blockSize The number of facets after which ReadBlock() returns. As a polygon
+     * is never split across two blocks a block may contain a few more facets.
+     */
+    explicit StreamReaderPLY(std::istream& str, std::size_t blockSize = 65536);
+    ~StreamReaderPLY() override;
+    bool IsValid() const override;
+    /*!
+     * \brief Returns the number of faces given in the header. Polygons with more than
+     * three corners result into more facets.
+     */
+    std::size_t CountFacets() const override;
+    /*!
+     * \brief Returns the number of vertices of the file.
+     */
+    std::size_t CountPoints() const;
+    bool ReadBlock(std::vector<MeshGeomFacet>& facets) override;
+    void Rewind() override;
+
+private:
+    enum Number
+    {
+        int8,
+        uint8,
+        int16,
+        uint16,
+        int32,
+        uint32,
+        float32,
+        float64
+    };
+
+    struct Property
+    {
+        std::string name;
+        Number type = float32;
+        Number countType = uint8;
+        bool list = false;
+    };
+
+    struct Element
+    {
+        std::string name;
+        std::size_t count = 0;
+        std::vector<Property> properties;
+    };
+
+    bool ReadHeader();
+    bool ReadBinaryValue(Number type, double& value);
+    bool ReadItem(const Element& element);
+    bool ReadVertexes(const Element& element);
+    bool SkipElement(const Element& element);
+    bool ReadFace(std::vector<MeshGeomFacet>& facets);
+
+private:
+    std::istream& _str;
+    std::unique_ptr<Base::InputStream> _binary;
+    std::size_t _blockSize;
+    std::size_t _numFaces = 0;
+    std::size_t _readFaces = 0;
+    std::streamoff _start = 0;
+    std::vector<Element> _elements;
+    std::vector<Base::Vector3f> _points;
+    std::vector<double> _values;
+    std::vector<std::size_t> _offsets;
+    std::vector<long> _indices;
+    int _faceElement = -1;
+    int _faceIndexProperty = -1;
+    bool _ascii = false;
+    bool _valid = false;
+};
+
+}  // namespace MeshCore
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/MeshGlobal.h>
+
+
+namespace MeshCore
+{
+
+/** Interface of the readers that return the facets of a mesh file in blocks.
+ * The memory consumption of an implementation must not depend on the number of
+ * facets so that files can be processed that don't fit into memory as a MeshKernel.
+ */
+class MeshExport StreamReader
+{
+public:
+    StreamReader() = default;
+    virtual ~StreamReader() = default;
+    /*!
+     * \brief Returns true if the header could be read.
+     */
+    virtual bool IsValid() const = 0;
+    /*!
+     * \brief Returns the number of facets if it's known in advance and 0 otherwise.
+     */
+    virtual std::size_t CountFacets() const = 0;
+    /*!
+     * \brief Reads the next block of facets. The passed vector is cleared first.
+     * \return false if there are no more facets to read.
+     */
+    virtual bool ReadBlock(std::vector<MeshGeomFacet>& facets) = 0;
+    /*!
+     * \brief Starts reading from the first facet again.
+     */
+    virtual void Rewind() = 0;
+
+    StreamReader(const StreamReader&) = delete;
+    StreamReader(StreamReader&&) = delete;
+    StreamReader& operator=(const StreamReader&) = delete;
+    StreamReader& operator=(StreamReader&&) = delete;
+};
+
+}  // namespace MeshCore
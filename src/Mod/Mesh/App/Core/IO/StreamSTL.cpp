@@ -0,0 +1,265 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <boost/algorithm/string.hpp>
+
+
+#include "Core/MeshIO.h"
+
+#include "StreamSTL.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// normal, three points and two bytes attribute
+constexpr std::size_t FacetSize = 12 * sizeof(float) + sizeof(uint16_t);
+constexpr std::size_t HeaderSize = 80;
+}  // namespace
+
+StreamReaderSTL::StreamReaderSTL(std::istream& str, std::size_t blockSize)
+    : _str(str)
+    , _blockSize(std::max<std::size_t>(blockSize, 1))
+{
+    if (!_str || _str.bad()) {
+        return;
+    }
+
+    std::streambuf* buf = _str.rdbuf();
+    if (!buf) {
+        return;
+    }
+
+    _start = buf->pubseekoff(0, std::ios::cur, std::ios::in);
+    std::streamoff end = buf->pubseekoff(0, std::ios::end, std::ios::in);
+    std::streamoff size = end - _start;
+    if (size < std::streamoff(HeaderSize + sizeof(uint32_t))) {
+        // too small for binary but it might be a (nearly empty) ASCII file
+        buf->pubseekoff(_start, std::ios::beg, std::ios::in);
+        _ascii = true;
+        _valid = size > 0;
+        return;
+    }
+
+    // Same check as in MeshInput::LoadSTL(): skip the first 80 bytes and check
+    // the following bytes for keywords of the ASCII format
+    buf->pubseekoff(_start + std::streamoff(HeaderSize), std::ios::beg, std::ios::in);
+    uint32_t count {};
+    _str.read(reinterpret_cast<char*>(&count), sizeof(count));
+    std::size_t bytes = count > 1 ? 100 : 50;
+    char szBuf[101] {};
+    _str.read(szBuf, static_cast<std::streamsize>(bytes));
+    szBuf[_str.gcount()] = 0;
+    _str.clear();
+    boost::algorithm::to_upper(szBuf);
+
+    if (!strstr(szBuf, "SOLID") && !strstr(szBuf, "FACET") && !strstr(szBuf, "NORMAL")
+        && !strstr(szBuf, "VERTEX") && !strstr(szBuf, "ENDFACET") && !strstr(szBuf, "ENDLOOP")) {
+        std::size_t maxFacets = (size - HeaderSize - sizeof(uint32_t)) / FacetSize;
+        if (count <= maxFacets) {
+            _numFacets = count;
+            _valid = true;
+        }
+    }
+    else {
+        _ascii = true;
+        _valid = true;
+    }
+
+    Rewind();
+}
+
+bool StreamReaderSTL::IsValid() const
+{
+    return _valid;
+}
+
+bool StreamReaderSTL::IsAscii() const
+{
+    return _ascii;
+}
+
+std::size_t StreamReaderSTL::CountFacets() const
+{
+    return _numFacets;
+}
+
+void StreamReaderSTL::Rewind()
+{
+    _str.clear();
+    _readFacets = 0;
+    std::streamoff pos = _start;
+    if (!_ascii) {
+        pos += std::streamoff(HeaderSize + sizeof(uint32_t));
+    }
+    _str.rdbuf()->pubseekoff(pos, std::ios::beg, std::ios::in);
+}
+
+bool StreamReaderSTL::ReadBlock(std::vector<MeshGeomFacet>& facets)
+{
+    facets.clear();
+    if (!_valid) {
+        return false;
+    }
+
+    return _ascii ? ReadAsciiBlock(facets) : ReadBinaryBlock(facets);
+}
+
+bool StreamReaderSTL::ReadBinaryBlock(std::vector<MeshGeomFacet>& facets)
+{
+    std::size_t count = std::min(_blockSize, _numFacets - _readFacets);
+    if (count == 0) {
+        return false;
+    }
+
+    // read the whole block at once and decode it afterwards
+    std::vector<char> data(count * FacetSize);
+    _str.read(data.data(), static_cast<std::streamsize>(data.size()));
+    count = static_cast<std::size_t>(_str.gcount()) / FacetSize;
+    if (count == 0) {
+        return false;
+    }
+
+    facets.resize(count);
+    float values[12];
+    for (std::size_t i = 0; i < count; i++) {
+        std::memcpy(values, data.data() + i * FacetSize, sizeof(values));
+        MeshGeomFacet& facet = facets[i];
+        facet._aclPoints[0].Set(values[3], values[4], values[5]);
+        facet._aclPoints[1].Set(values[6], values[7], values[8]);
+        facet._aclPoints[2].Set(values[9], values[10], values[11]);
+        facet.SetNormal(Base::Vector3f(values[0], values[1], values[2]));
+    }
+
+    _readFacets += count;
+    return true;
+}
+
+bool StreamReaderSTL::ReadAsciiBlock(std::vector<MeshGeomFacet>& facets)
+{
+    std::string line;
+    MeshGeomFacet facet;
+    Base::Vector3f normal;
+    bool hasNormal = false;
+    int numVertexes = 0;
+    while (facets.size() < _blockSize && std::getline(_str, line)) {
+        boost::algorithm::trim(line);
+        boost::algorithm::to_upper(line);
+        if (boost::algorithm::starts_with(line, "FACET")) {
+            // the normal is optional, if it's missing it's computed from the points
+            std::size_t pos = line.find("NORMAL");
+            hasNormal = pos != std::string::npos;
+            if (hasNormal) {
+                std::istringstream str(line.substr(pos + 6));
+                str >> normal.x >> normal.y >> normal.z;
+                hasNormal = !str.fail();
+            }
+            numVertexes = 0;
+        }
+        else if (boost::algorithm::starts_with(line, "VERTEX")) {
+            std::istringstream str(line.substr(6));
+            Base::Vector3f pnt;
+            str >> pnt.x >> pnt.y >> pnt.z;
+            if (numVertexes < 3) {
+                facet._aclPoints[numVertexes++] = pnt;
+            }
+            if (numVertexes == 3) {
+                if (hasNormal) {
+                    facet.SetNormal(normal);
+                }
+                else {
+                    facet.CalcNormal();
+                }
+                facets.push_back(facet);
+                numVertexes = 0;
+            }
+        }
+        else if (boost::algorithm::starts_with(line, "ENDSOLID")) {
+            break;
+        }
+    }
+
+    _readFacets += facets.size();
+    return !facets.empty();
+}
+
+// ----------------------------------------------------------------------------
+
+StreamWriterSTL::StreamWriterSTL(std::ostream& str)
+    : _str(str)
+{
+    std::string header = MeshOutput::GetSTLHeaderData();
+    header.resize(HeaderSize, ' ');
+    _str.write(header.c_str(), static_cast<std::streamsize>(HeaderSize));
+    _countPos = _str.tellp();
+    uint32_t count = 0;
+    _str.write(reinterpret_cast<const char*>(&count), sizeof(count));
+}
+
+bool StreamWriterSTL::WriteBlock(const std::vector<MeshGeomFacet>& facets)
+{
+    if (!_str || _str.bad()) {
+        return false;
+    }
+
+    std::vector<char> data(facets.size() * FacetSize, 0);
+    float values[12];
+    for (std::size_t i = 0; i < facets.size(); i++) {
+        const MeshGeomFacet& facet = facets[i];
+        Base::Vector3f normal = facet.GetNormal();
+        values[0] = normal.x;
+        values[1] = normal.y;
+        values[2] = normal.z;
+        for (int j = 0; j < 3; j++) {
+            values[3 * j + 3] = facet._aclPoints[j].x;
+            values[3 * j + 4] = facet._aclPoints[j].y;
+            values[3 * j + 5] = facet._aclPoints[j].z;
+        }
+        std::memcpy(data.data() + i * FacetSize, values, sizeof(values));
+    }
+
+    _str.write(data.data(), static_cast<std::streamsize>(data.size()));
+    _numFacets += facets.size();
+    return !_str.bad();
+}
+
+bool StreamWriterSTL::Finish()
+{
+    if (!_str || _str.bad()) {
+        return false;
+    }
+
+    std::streamoff end = _str.tellp();
+    uint32_t count = static_cast<uint32_t>(_numFacets);
+    _str.seekp(_countPos);
+    _str.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    _str.seekp(end);
+    _str.flush();
+    return !_str.bad();
+}
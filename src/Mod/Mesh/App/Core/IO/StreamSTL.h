@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/MeshGlobal.h>
+
+#include "StreamReader.h"
+
+
+namespace MeshCore
+{
+
+/** Reads the facets of a binary or ASCII STL file in blocks.
+ * Unlike MeshInput::LoadSTL() no MeshKernel is built, so that the memory
+ * consumption only depends on the block size and not on the file size.
+ */
+class MeshExport StreamReaderSTL: public StreamReader
+{
+public:
+    /*!
+     * \brief StreamReaderSTL
+     * \param str The input stream must be seekable and opened in binary mode.
+     * \param blockSize The maximum number of facets returned by ReadBlock().
+     */
+    explicit StreamReaderSTL(std::istream& str, std::size_t blockSize = 65536);
+    bool IsValid() const override;
+    /*!
+     * \brief Returns true if the file is an ASCII STL.
+     */
+    bool IsAscii() const;
+    /*!
+     * \brief Returns the number of facets stored in the header of a binary STL.
+     * For ASCII files 0 is returned as the number is not known in advance.
+     */
+    std::size_t CountFacets() const override;
+    bool ReadBlock(std::vector<MeshGeomFacet>& facets) override;
+    void Rewind() override;
+
+private:
+    bool ReadBinaryBlock(std::vector<MeshGeomFacet>& facets);
+    bool ReadAsciiBlock(std::vector<MeshGeomFacet>& facets);
+
+private:
+    std::istream& _str;
+    std::size_t _blockSize;
+    std::size_t _numFacets = 0;
+    std::size_t _readFacets = 0;
+    std::streamoff _start = 0;
+    bool _valid = false;
+    bool _ascii = false;
+};
+
+/** Writes facets blockwise to a binary STL file.
+ * The number of facets is written as placeholder and corrected by Finish().
+ */
+class MeshExport StreamWriterSTL
+{
+public:
+    /*!
+     * \brief StreamWriterSTL
+     * \param str The output stream must be seekable and opened in binary mode.
+     */
+    explicit StreamWriterSTL(std::ostream& str);
+    /*!
+     * \brief Appends the facets to the file.
+     */
+    bool WriteBlock(const std::vector<MeshGeomFacet>& facets);
+    /*!
+     * \brief Writes the final number of facets into the header.
+     */
+    bool Finish();
+    /*!
+     * \brief Returns the number of written facets.
+     */
+    std::size_t CountFacets() const
+    {
+        return _numFacets;
+    }
+
+private:
+    std::ostream& _str;
+    std::streamoff _countPos = 0;
+    std::size_t _numFacets = 0;
+};
+
+}  // namespace MeshCore
@@ -26,6 +26,14 @@
 # pragma warning(disable : 4396)
 #endif
 
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <thread>
+
+#include <Base/BoundBox.h>
+
+#include "Functional.h"
 #include "KDTree.h"
 #include <kdtree++/kdtree.hpp>
 
@@ -201,3 +209,395 @@ void MeshKDTree::FindInRange(const Base::Vector3f& p, float range, std::vector<P
         indices.push_back(it.i);
     }
 }
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+// ranges up to this size are not split any further but scanned linearly
+const std::size_t LeafSize = 8;
+// ranges smaller than this are built on the current thread
+const std::size_t MinParallelSize = 10000;
+
+inline float SqrDistance(const Base::Vector3f& p, const Base::Vector3f& q)
+{
+    float dx = p.x - q.x;
+    float dy = p.y - q.y;
+    float dz = p.z - q.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+}  // namespace
+
+/*
+ * Keeps the k nearest nodes sorted by their squared distance. Nodes with equal distance are
+ * sorted by their point index so that the result doesn't depend on the tree layout.
+ */
+class MeshStaticKDTree::Nearest
+{
+public:
+    Nearest(const Node* nodes, std::size_t k, float max_dist, PointIndex* slots, float* sqrDists)
+        : nodes(nodes)
+        , k(k)
+        , sqrMax(max_dist * max_dist)
+        , slots(slots)
+        , sqrDists(sqrDists)
+    {}
+
+    float Bound() const
+    {
+        return count < k ? sqrMax : sqrDists[count - 1];
+    }
+
+    void Insert(float sqrDist, std::size_t pos)
+    {
+        if (sqrDist > Bound()) {
+            return;
+        }
+
+        PointIndex index = nodes[pos].index;
+        std::size_t i = count;
+        if (count < k) {
+            count++;
+        }
+        else if (!IsLess(sqrDist, index, k - 1)) {
+            return;
+        }
+        else {
+            i = k - 1;
+        }
+
+        while (i > 0 && IsLess(sqrDist, index, i - 1)) {
+            slots[i] = slots[i - 1];
+            sqrDists[i] = sqrDists[i - 1];
+            i--;
+        }
+
+        slots[i] = PointIndex(pos);
+        sqrDists[i] = sqrDist;
+    }
+
+    std::size_t Count() const
+    {
+        return count;
+    }
+
+    // converts the node positions into point indices and the squared distances into distances
+    std::size_t Finish()
+    {
+        for (std::size_t i = 0; i < count; i++) {
+            slots[i] = nodes[slots[i]].index;
+            sqrDists[i] = std::sqrt(sqrDists[i]);
+        }
+        return count;
+    }
+
+private:
+    bool IsLess(float sqrDist, PointIndex index, std::size_t i) const
+    {
+        if (sqrDist != sqrDists[i]) {
+            return sqrDist < sqrDists[i];
+        }
+        return index < nodes[slots[i]].index;
+    }
+
+private:
+    const Node* nodes;
+    std::size_t k;
+    std::size_t count {0};
+    float sqrMax;
+    PointIndex* slots;
+    float* sqrDists;
+};
+
+MeshStaticKDTree::MeshStaticKDTree()
+    : threads(int(std::thread::hardware_concurrency()))
+{}
+
+MeshStaticKDTree::MeshStaticKDTree(const std::vector<Base::Vector3f>& points)
+    : threads(int(std::thread::hardware_concurrency()))
+{
+    Build(points);
+}
+
+MeshStaticKDTree::MeshStaticKDTree(const MeshPointArray& points)
+    : threads(int(std::thread::hardware_concurrency()))
+{
+    Build(points);
+}
+
+void MeshStaticKDTree::Build(const std::vector<Base::Vector3f>& points)
+{
+    nodes.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        nodes[i].point = points[i];
+        nodes[i].index = PointIndex(i);
+    }
+
+    axes.assign(nodes.size(), 0);
+    BuildRange(0, nodes.size(), threads);
+}
+
+void MeshStaticKDTree::Build(const MeshPointArray& points)
+{
+    nodes.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        nodes[i].point = points[i];
+        nodes[i].index = PointIndex(i);
+    }
+
+    axes.assign(nodes.size(), 0);
+    BuildRange(0, nodes.size(), threads);
+}
+
+void MeshStaticKDTree::Clear()
+{
+    nodes.clear();
+    axes.clear();
+}
+
+void MeshStaticKDTree::BuildRange(std::size_t lo, std::size_t hi, int tasks)
+{
+    if (hi - lo <= LeafSize) {
+        return;
+    }
+
+    // split the range at the median along the largest extent
+    Base::BoundBox3f box;
+    for (std::size_t i = lo; i < hi; i++) {
+        box.Add(nodes[i].point);
+    }
+
+    unsigned short axis = 0;
+    if (box.LengthY() > box.LengthX()) {
+        axis = 1;
+    }
+    if (box.LengthZ() > std::max(box.LengthX(), box.LengthY())) {
+        axis = 2;
+    }
+
+    std::size_t mid = lo + (hi - lo) / 2;
+    auto first = nodes.begin();
+    std::nth_element(
+        first + std::ptrdiff_t(lo),
+        first + std::ptrdiff_t(mid),
+        first + std::ptrdiff_t(hi),
+        [axis](const Node& n1, const Node& n2) { return n1.point[axis] < n2.point[axis]; }
+    );
+    axes[mid] = static_cast<unsigned char>(axis);
+
+    // both halves are disjoint and can be built independently
+    if (tasks > 1 && hi - lo > MinParallelSize) {
+        std::future<void> left
+            = std::async(std::launch::async, &MeshStaticKDTree::BuildRange, this, lo, mid, tasks / 2);
+        BuildRange(mid + 1, hi, tasks - tasks / 2);
+        left.get();
+    }
+    else {
+        BuildRange(lo, mid, 1);
+        BuildRange(mid + 1, hi, 1);
+    }
+}
+
+void MeshStaticKDTree::SearchNearest(
+    std::size_t lo,
+    std::size_t hi,
+    const Base::Vector3f& p,
+    Nearest& result
+) const
+{
+    if (hi - lo <= LeafSize) {
+        for (std::size_t i = lo; i < hi; i++) {
+            result.Insert(SqrDistance(p, nodes[i].point), i);
+        }
+        return;
+    }
+
+    std::size_t mid = lo + (hi - lo) / 2;
+    unsigned short axis = axes[mid];
+    result.Insert(SqrDistance(p, nodes[mid].point), mid);
+
+    float diff = p[axis] - nodes[mid].point[axis];
+    if (diff < 0.0F) {
+        SearchNearest(lo, mid, p, result);
+        if (diff * diff <= result.Bound()) {
+            SearchNearest(mid + 1, hi, p, result);
+        }
+    }
+    else {
+        SearchNearest(mid + 1, hi, p, result);
+        if (diff * diff <= result.Bound()) {
+            SearchNearest(lo, mid, p, result);
+        }
+    }
+}
+
+void MeshStaticKDTree::SearchRange(
+    std::size_t lo,
+    std::size_t hi,
+    const Base::Vector3f& p,
+    float sqrRange,
+    std::vector<PointIndex>& indices
+) const
+{
+    if (hi - lo <= LeafSize) {
+        for (std::size_t i = lo; i < hi; i++) {
+            if (SqrDistance(p, nodes[i].point) <= sqrRange) {
+                indices.push_back(nodes[i].index);
+            }
+        }
+        return;
+    }
+
+    std::size_t mid = lo + (hi - lo) / 2;
+    unsigned short axis = axes[mid];
+    if (SqrDistance(p, nodes[mid].point) <= sqrRange) {
+        indices.push_back(nodes[mid].index);
+    }
+
+    float diff = p[axis] - nodes[mid].point[axis];
+    if (diff <= 0.0F || diff * diff <= sqrRange) {
+        SearchRange(lo, mid, p, sqrRange, indices);
+    }
+    if (diff >= 0.0F || diff * diff <= sqrRange) {
+        SearchRange(mid + 1, hi, p, sqrRange, indices);
+    }
+}
+
+PointIndex MeshStaticKDTree::FindNearest(const Base::Vector3f& p, Base::Vector3f& n, float& dist) const
+{
+    return FindNearest(p, std::numeric_limits<float>::max(), n, dist);
+}
+
+PointIndex MeshStaticKDTree::FindNearest(
+    const Base::Vector3f& p,
+    float max_dist,
+    Base::Vector3f& n,
+    float& dist
+) const
+{
+    if (nodes.empty()) {
+        return POINT_INDEX_MAX;
+    }
+
+    PointIndex index = POINT_INDEX_MAX;
+    Nearest result(nodes.data(), 1, max_dist, &index, &dist);
+    SearchNearest(0, nodes.size(), p, result);
+    if (result.Count() == 0) {
+        return POINT_INDEX_MAX;
+    }
+
+    n = nodes[index].point;
+    result.Finish();
+    return index;
+}
+
+PointIndex MeshStaticKDTree::FindExact(const Base::Vector3f& p) const
+{
+    PointIndex index = POINT_INDEX_MAX;
+    float dist {};
+    FindNearest(p, 1, 0.0F, &index, &dist);
+    return index;
+}
+
+std::size_t MeshStaticKDTree::FindNearest(
+    const Base::Vector3f& p,
+    std::size_t k,
+    float max_dist,
+    PointIndex* indices,
+    float* dists
+) const
+{
+    if (k == 0 || nodes.empty()) {
+        return 0;
+    }
+
+    Nearest result(nodes.data(), k, max_dist, indices, dists);
+    SearchNearest(0, nodes.size(), p, result);
+    return result.Finish();
+}
+
+void MeshStaticKDTree::FindInRange(
+    const Base::Vector3f& p,
+    float range,
+    std::vector<PointIndex>& indices
+) const
+{
+    indices.clear();
+    if (!nodes.empty()) {
+        SearchRange(0, nodes.size(), p, range * range, indices);
+        std::sort(indices.begin(), indices.end());
+    }
+}
+
+void MeshStaticKDTree::FindNearest(
+    const std::vector<Base::Vector3f>& queries,
+    std::size_t k,
+    float max_dist,
+    std::vector<PointIndex>& indices,
+    std::vector<float>& dists
+) const
+{
+    std::size_t count = queries.size();
+    indices.assign(count * k, POINT_INDEX_MAX);
+    dists.assign(count * k, std::numeric_limits<float>::max());
+    if (k == 0 || nodes.empty()) {
+        return;
+    }
+
+    MeshCore::parallel_for(
+        count,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                FindNearest(queries[i], k, max_dist, &indices[i * k], &dists[i * k]);
+            }
+        },
+        threads
+    );
+}
+
+void MeshStaticKDTree::FindInRange(
+    const std::vector<Base::Vector3f>& queries,
+    float range,
+    std::vector<std::size_t>& offsets,
+    std::vector<PointIndex>& indices
+) const
+{
+    std::size_t count = queries.size();
+    offsets.assign(count + 1, 0);
+    indices.clear();
+    if (nodes.empty()) {
+        return;
+    }
+
+    // the results of each chunk of queries are collected separately and concatenated afterwards
+    std::size_t numChunks = std::max<std::size_t>(std::size_t(std::max(threads, 1)) * 4, 1);
+    std::size_t chunkSize = (count + numChunks - 1) / numChunks;
+    std::vector<std::vector<PointIndex>> chunks(numChunks);
+
+    MeshCore::parallel_for(
+        numChunks,
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<PointIndex> found;
+            for (std::size_t c = begin; c < end; c++) {
+                std::size_t last = std::min((c + 1) * chunkSize, count);
+                for (std::size_t i = c * chunkSize; i < last; i++) {
+                    found.clear();
+                    SearchRange(0, nodes.size(), queries[i], range * range, found);
+                    std::sort(found.begin(), found.end());
+                    chunks[c].insert(chunks[c].end(), found.begin(), found.end());
+                    offsets[i + 1] = found.size();
+                }
+            }
+        },
+        threads
+    );
+
+    for (std::size_t i = 0; i < count; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    indices.reserve(offsets[count]);
+    for (const auto& it : chunks) {
+        indices.insert(indices.end(), it.begin(), it.end());
+    }
+}
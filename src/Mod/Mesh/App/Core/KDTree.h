@@ -25,6 +25,9 @@
 
 #pragma once
 
+#include <limits>
+#include <vector>
+
 #include "Elements.h"
 
 namespace MeshCore
@@ -61,4 +64,109 @@ private:
     Private* d;
 };
 
+/**
+ * The MeshStaticKDTree class is an implicit kd-tree that is stored in a single array.
+ * Unlike MeshKDTree it is built once from a point set and cannot be modified afterwards.
+ * The construction and the batched queries run in parallel and the batched queries write
+ * their results into arrays that can be reused by the caller.
+ * Distances passed to and returned by the queries are Euclidean distances.
+ */
+class MeshExport MeshStaticKDTree
+{
+public:
+    MeshStaticKDTree();
+    explicit MeshStaticKDTree(const std::vector<Base::Vector3f>& points);
+    explicit MeshStaticKDTree(const MeshPointArray& points);
+
+    /// Sets the number of threads used for construction and batched queries
+    void SetThreads(int num)
+    {
+        threads = num;
+    }
+    int GetThreads() const
+    {
+        return threads;
+    }
+
+    void Build(const std::vector<Base::Vector3f>& points);
+    void Build(const MeshPointArray& points);
+
+    bool IsEmpty() const
+    {
+        return nodes.empty();
+    }
+    std::size_t Size() const
+    {
+        return nodes.size();
+    }
+    void Clear();
+
+    /** @name Single queries */
+    //@{
+    PointIndex FindNearest(const Base::Vector3f& p, Base::Vector3f& n, float& dist) const;
+    PointIndex FindNearest(const Base::Vector3f& p, float max_dist, Base::Vector3f& n, float& dist) const;
+    PointIndex FindExact(const Base::Vector3f& p) const;
+    /** Searches for the \a k nearest points of \a p within \a max_dist. The results are sorted
+     * by distance and written to \a indices and \a dists which must have room for \a k elements.
+     * Returns the number of found points.
+     */
+    std::size_t FindNearest(
+        const Base::Vector3f& p,
+        std::size_t k,
+        float max_dist,
+        PointIndex* indices,
+        float* dists
+    ) const;
+    /// Returns the indices of all points within the sphere around \a p with radius \a range
+    void FindInRange(const Base::Vector3f& p, float range, std::vector<PointIndex>& indices) const;
+    //@}
+
+    /** @name Batched queries */
+    //@{
+    /** Searches for the \a k nearest points of every query point. The results of the i-th query
+     * are stored at [i*k, (i+1)*k) of \a indices and \a dists. Unused slots are set to
+     * POINT_INDEX_MAX.
+     */
+    void FindNearest(
+        const std::vector<Base::Vector3f>& queries,
+        std::size_t k,
+        float max_dist,
+        std::vector<PointIndex>& indices,
+        std::vector<float>& dists
+    ) const;
+    /** Searches for all points within \a range of every query point. The results of the i-th
+     * query are stored at [offsets[i], offsets[i+1]) of \a indices.
+     */
+    void FindInRange(
+        const std::vector<Base::Vector3f>& queries,
+        float range,
+        std::vector<std::size_t>& offsets,
+        std::vector<PointIndex>& indices
+    ) const;
+    //@}
+
+private:
+    struct Node
+    {
+        Base::Vector3f point;
+        PointIndex index;
+    };
+    class Nearest;
+
+    void BuildRange(std::size_t lo, std::size_t hi, int tasks);
+    void SearchNearest(std::size_t lo, std::size_t hi, const Base::Vector3f& p, Nearest& result) const;
+    void SearchRange(
+        std::size_t lo,
+        std::size_t hi,
+        const Base::Vector3f& p,
+        float sqrRange,
+        std::vector<PointIndex>& indices
+    ) const;
+
+private:
+    std::vector<Node> nodes;
+    std::vector<unsigned char> axes;
+    int threads;
+};
+
 }  // namespace MeshCore
@@ -197,6 +197,8 @@ public:
      * automatically filled up with spaces.
      */
     static void SetSTLHeaderData(const std::string&);
+    /// Returns the 80 characters that are written as header of a binary STL file.
+    static const std::string& GetSTLHeaderData();
     /**
      * Change the image size of the asymptote output.
      */
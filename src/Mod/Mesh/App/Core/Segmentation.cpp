@@ -25,9 +25,11 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <thread>
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "Functional.h"
 #include "Segmentation.h"
 
 using namespace MeshCore;
@@ -70,29 +72,34 @@ MeshDistancePlanarSegment::MeshDistancePlanarSegment(
 )
     : MeshDistanceSurfaceSegment(mesh, minFacets, tol)
     , fitter(new PlaneFit)
+    , moments(new PointMoments)
 {}
 
 MeshDistancePlanarSegment::~MeshDistancePlanarSegment()
 {
     delete fitter;
+    delete moments;
 }
 
 void MeshDistancePlanarSegment::Initialize(FacetIndex index)
 {
     fitter->Clear();
+    moments->Clear();
 
     MeshGeomFacet triangle = kernel.GetFacet(index);
     basepoint = triangle.GetGravityPoint();
     normal = triangle.GetNormal();
-    fitter->AddPoint(triangle._aclPoints[0]);
-    fitter->AddPoint(triangle._aclPoints[1]);
-    fitter->AddPoint(triangle._aclPoints[2]);
+    for (const auto& pnt : triangle._aclPoints) {
+        fitter->AddPoint(pnt);
+        moments->Add(pnt);
+    }
 }
 
 bool MeshDistancePlanarSegment::TestFacet(const MeshFacet& face) const
 {
+    // refit incrementally instead of iterating over all points again
     if (!fitter->Done()) {
-        fitter->Fit();
+        fitter->Fit(*moments);
     }
     MeshGeomFacet triangle = kernel.GetFacet(face);
     for (auto pnt : triangle._aclPoints) {
@@ -107,24 +114,29 @@ bool MeshDistancePlanarSegment::TestFacet(const MeshFacet& face) const
 void MeshDistancePlanarSegment::AddFacet(const MeshFacet& face)
 {
     MeshGeomFacet triangle = kernel.GetFacet(face);
-    fitter->AddPoint(triangle.GetGravityPoint());
+    Base::Vector3f center = triangle.GetGravityPoint();
+    fitter->AddPoint(center);
+    moments->Add(center);
 }
 
 // --------------------------------------------------------
 
 PlaneSurfaceFit::PlaneSurfaceFit()
     : fitter(new PlaneFit)
+    , moments(new PointMoments)
 {}
 
 PlaneSurfaceFit::PlaneSurfaceFit(const Base::Vector3f& b, const Base::Vector3f& n)
     : basepoint(b)
     , normal(n)
     , fitter(nullptr)
+    , moments(nullptr)
 {}
 
 PlaneSurfaceFit::~PlaneSurfaceFit()
 {
     delete fitter;
+    delete moments;
 }
 
 void PlaneSurfaceFit::Initialize(const MeshCore::MeshGeomFacet& tria)
@@ -134,11 +146,13 @@ void PlaneSurfaceFit::Initialize(const MeshCore::MeshGeomFacet& tria)
         normal = tria.GetNormal();
 
         fitter->Clear();
+        moments->Clear();
 
-        fitter->AddPoint(tria._aclPoints[0]);
-        fitter->AddPoint(tria._aclPoints[1]);
-        fitter->AddPoint(tria._aclPoints[2]);
-        fitter->Fit();
+        for (const auto& pnt : tria._aclPoints) {
+            fitter->AddPoint(pnt);
+            moments->Add(pnt);
+        }
+        fitter->Fit(*moments);
     }
 }
 
@@ -150,7 +164,9 @@ bool PlaneSurfaceFit::TestTriangle(const MeshGeomFacet&) const
 void PlaneSurfaceFit::AddTriangle(const MeshCore::MeshGeomFacet& tria)
 {
     if (fitter) {
-        fitter->AddPoint(tria.GetGravityPoint());
+        Base::Vector3f center = tria.GetGravityPoint();
+        fitter->AddPoint(center);
+        moments->Add(center);
     }
 }
 
@@ -169,7 +185,7 @@ float PlaneSurfaceFit::Fit()
         return 0;
     }
 
-    return fitter->Fit();
+    return fitter->Fit(*moments);
 }
 
 float PlaneSurfaceFit::GetDistanceToSurface(const Base::Vector3f& pnt) const
@@ -556,6 +572,84 @@ bool MeshSurfaceVisitor::Visit(const MeshFacet& face, const MeshFacet&, FacetInd
 
 // --------------------------------------------------------
 
+MeshSegmentAlgorithm::MeshSegmentAlgorithm(const MeshKernel& kernel)
+    : myKernel(kernel)
+    , myThreads(int(std::thread::hardware_concurrency()))
+{}
+
+/*!
+ * \brief MeshSegmentAlgorithm::FindStatelessSegments
+ * Grows the segments of a stateless segment type. Its facet test is evaluated for all facets in
+ * parallel before the regions are grown. The result is the same as with the sequential region
+ * growing of FindSegments(), including the order of the facets of a segment.
+ */
+void MeshSegmentAlgorithm::FindStatelessSegments(
+    MeshSurfaceSegment& segm,
+    std::vector<FacetIndex>& resetVisited
+)
+{
+    const MeshFacetArray& facets = myKernel.GetFacets();
+    std::size_t count = facets.size();
+
+    // test all facets that are not part of a segment yet
+    std::vector<char> visited(count);
+    std::vector<char> accepted(count);
+    MeshCore::parallel_for(
+        count,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t index = begin; index < end; index++) {
+                visited[index] = facets[index].IsFlag(MeshFacet::VISIT) ? 1 : 0;
+                accepted[index] = !visited[index] && segm.TestFacet(facets[index]) ? 1 : 0;
+            }
+        },
+        myThreads
+    );
+
+    // Grow the regions in the same breadth-first order as MeshKernel::VisitNeighbourFacets(),
+    // which is cheap now that the facet tests are done
+    std::vector<FacetIndex> newVisited;
+    std::vector<FacetIndex> indices;
+    std::vector<FacetIndex> front;
+    for (std::size_t start = 0; start < count; start++) {
+        if (visited[start]) {
+            continue;
+        }
+
+        indices.clear();
+        segm.Initialize(start);
+        if (segm.TestInitialFacet(start)) {
+            indices.push_back(start);
+        }
+        visited[start] = 1;
+        newVisited.push_back(start);
+
+        front.clear();
+        front.push_back(start);
+        for (std::size_t pos = 0; pos < front.size(); pos++) {
+            for (FacetIndex nb : facets[front[pos]]._aulNeighbours) {
+                if (nb < count && accepted[nb] && !visited[nb]) {
+                    visited[nb] = 1;
+                    newVisited.push_back(nb);
+                    front.push_back(nb);
+                    indices.push_back(nb);
+                    segm.AddFacet(facets[nb]);
+                }
+            }
+        }
+
+        // add or discard the segment
+        if (indices.size() <= 1) {
+            resetVisited.push_back(start);
+        }
+        else {
+            segm.AddSegment(indices);
+        }
+    }
+
+    MeshCore::MeshAlgorithm cAlgo(myKernel);
+    cAlgo.SetFacetsFlag(newVisited, MeshCore::MeshFacet::VISIT);
+}
+
 void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm)
 {
     // reset VISIT flags
@@ -576,6 +670,11 @@ void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm
         cAlgo.ResetFacetsFlag(resetVisited, MeshCore::MeshFacet::VISIT);
         resetVisited.clear();
 
+        if (it->IsStateless()) {
+            FindStatelessSegments(*it, resetVisited);
+            continue;
+        }
+
         MeshCore::MeshIsNotFlag<MeshCore::MeshFacet> flag;
         iCur = std::find_if(iBeg, iEnd, [flag](const MeshFacet& f) {
             return flag(f, MeshFacet::VISIT);
@@ -36,6 +36,7 @@ namespace MeshCore
 {
 
 class PlaneFit;
+struct PointMoments;
 class CylinderFit;
 class SphereFit;
 class MeshFacet;
@@ -55,6 +56,14 @@ public:
     MeshSurfaceSegment& operator=(MeshSurfaceSegment&&) = delete;
 
     virtual bool TestFacet(const MeshFacet& rclFacet) const = 0;
+    /**
+     * Returns true if the result of TestFacet() only depends on the facet itself and not on the
+     * facets that have been added so far. Such segments can be tested in parallel.
+     */
+    virtual bool IsStateless() const
+    {
+        return false;
+    }
     virtual const char* GetType() const = 0;
     virtual void Initialize(FacetIndex);
     virtual bool TestInitialFacet(FacetIndex) const;
@@ -74,6 +83,11 @@ using MeshSurfaceSegmentPtr = std::shared_ptr<MeshSurfaceSegment>;
 
 // --------------------------------------------------------
 
+/**
+ * Base class of the segments that grow by the distance of the facets to a fitted surface. The
+ * surface is refitted after each added facet, so the test of a facet depends on the facets that
+ * have been added before. These segments are therefore grown sequentially.
+ */
 class MeshExport MeshDistanceSurfaceSegment: public MeshSurfaceSegment
 {
 public:
@@ -113,6 +127,7 @@ private:
     Base::Vector3f basepoint;
     Base::Vector3f normal;
     PlaneFit* fitter;
+    PointMoments* moments;
 };
 
 class MeshExport AbstractSurfaceFit
@@ -164,6 +179,7 @@ private:
     Base::Vector3f basepoint;
     Base::Vector3f normal;
     PlaneFit* fitter;
+    PointMoments* moments;
 };
 
 class MeshExport CylinderSurfaceFit: public AbstractSurfaceFit
@@ -273,6 +289,10 @@ public:
     {
         return info.at(pos);
     }
+    bool IsStateless() const override
+    {
+        return true;
+    }
 
 private:
     const std::vector<CurvatureInfo>& info;
@@ -396,13 +416,20 @@ private:
 class MeshExport MeshSegmentAlgorithm
 {
 public:
-    explicit MeshSegmentAlgorithm(const MeshKernel& kernel)
-        : myKernel(kernel)
-    {}
+    explicit MeshSegmentAlgorithm(const MeshKernel& kernel);
+    /// Sets the number of threads used to grow stateless segments
+    void SetThreads(int num)
+    {
+        myThreads = num;
+    }
     void FindSegments(std::vector<MeshSurfaceSegmentPtr>&);
 
+private:
+    void FindStatelessSegments(MeshSurfaceSegment&, std::vector<FacetIndex>& resetVisited);
+
 private:
     const MeshKernel& myKernel;
+    int myThreads;
 };
 
 }  // namespace MeshCore
@@ -23,8 +23,11 @@
  ***************************************************************************/
 
 
+#include <array>
 #include <fstream>
+#include <future>
 #include <ios>
+#include <thread>
 
 
 #include <Base/Builder3D.h>
@@ -34,6 +37,7 @@
 #include "Builder.h"
 #include "Definitions.h"
 #include "Elements.h"
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "SetOperations.h"
@@ -110,11 +114,13 @@ void SetOperations::Do()
         }
     }
 
-    // Base::Sequencer().next();
+    // Both sides only read the cut points and write to their own slot of the
+    // edge information, so they can be triangulated concurrently
+    auto future = std::async(std::launch::async, [this]() {
+        TriangulateMesh(_cutMesh1, 1);
+    });
     TriangulateMesh(_cutMesh0, 0);
-
-    // Base::Sequencer().next();
-    TriangulateMesh(_cutMesh1, 1);
+    future.get();
 
     float mult0 {}, mult1 {};
     switch (_operationType) {
@@ -173,6 +179,18 @@ void SetOperations::Do()
     MeshDefinitions::SetMinPointDistance(saveMinMeshDistance);
 }
 
+namespace
+{
+// Intersection of two facets of the two meshes
+struct CutSegment
+{
+    FacetIndex fidx1;
+    FacetIndex fidx2;
+    MeshPoint mp0;
+    MeshPoint mp1;
+};
+}  // namespace
+
 void SetOperations::Cut(std::set<FacetIndex>& facetsCuttingEdge0, std::set<FacetIndex>& facetsCuttingEdge1)
 {
     MeshFacetGrid grid1(_cutMesh0, 20);
@@ -181,112 +199,127 @@ void SetOperations::Cut(std::set<FacetIndex>& facetsCuttingEdge0, std::set<Facet
     unsigned long ctGx1 {}, ctGy1 {}, ctGz1 {};
     grid1.GetCtGrids(ctGx1, ctGy1, ctGz1);
 
+    std::vector<std::array<unsigned long, 3>> cells;
     for (auto gx1 = 0UL; gx1 < ctGx1; gx1++) {
         for (auto gy1 = 0UL; gy1 < ctGy1; gy1++) {
             for (auto gz1 = 0UL; gz1 < ctGz1; gz1++) {
                 if (grid1.GetCtElements(gx1, gy1, gz1) > 0) {
-                    std::vector<FacetIndex> vecFacets2;
-                    grid2.Inside(grid1.GetBoundBox(gx1, gy1, gz1), vecFacets2);
-
-                    if (!vecFacets2.empty()) {
-                        std::set<FacetIndex> vecFacets1;
-                        grid1.GetElements(gx1, gy1, gz1, vecFacets1);
-
-                        std::set<FacetIndex>::iterator it1;
-                        for (it1 = vecFacets1.begin(); it1 != vecFacets1.end(); ++it1) {
-                            FacetIndex fidx1 = *it1;
-                            MeshGeomFacet f1 = _cutMesh0.GetFacet(*it1);
-
-                            std::vector<FacetIndex>::iterator it2;
-                            for (it2 = vecFacets2.begin(); it2 != vecFacets2.end(); ++it2) {
-                                FacetIndex fidx2 = *it2;
-                                MeshGeomFacet f2 = _cutMesh1.GetFacet(fidx2);
-
-                                MeshPoint p0, p1;
-
-                                int isect = f1.IntersectWithFacet(f2, p0, p1);
-                                if (isect > 0) {
-                                    // optimize cut line if distance to nearest point is too small
-                                    float minDist1 = _minDistanceToPoint,
-                                          minDist2 = _minDistanceToPoint;
-                                    MeshPoint np0 = p0, np1 = p1;
-                                    for (int i = 0; i < 3; i++)  // NOLINT
-                                    {
-                                        float d1 = (f1._aclPoints[i] - p0).Length();
-                                        float d2 = (f1._aclPoints[i] - p1).Length();
-                                        if (d1 < minDist1) {
-                                            minDist1 = d1;
-                                            np0 = f1._aclPoints[i];
-                                        }
-                                        if (d2 < minDist2) {
-                                            minDist2 = d2;
-                                            p1 = f1._aclPoints[i];
-                                        }
-                                    }  // for (int i = 0; i < 3; i++)
-
-                                    // optimize cut line if distance to nearest point is too small
-                                    for (int i = 0; i < 3; i++)  // NOLINT
-                                    {
-                                        float d1 = (f2._aclPoints[i] - p0).Length();
-                                        float d2 = (f2._aclPoints[i] - p1).Length();
-                                        if (d1 < minDist1) {
-                                            minDist1 = d1;
-                                            np0 = f2._aclPoints[i];
-                                        }
-                                        if (d2 < minDist2) {
-                                            minDist2 = d2;
-                                            np1 = f2._aclPoints[i];
-                                        }
-                                    }  // for (int i = 0; i < 3; i++)
-
-                                    MeshPoint mp0 = np0;
-                                    MeshPoint mp1 = np1;
-
-                                    if (mp0 != mp1) {
-                                        facetsCuttingEdge0.insert(fidx1);
-                                        facetsCuttingEdge1.insert(fidx2);
-
-                                        _cutPoints.insert(mp0);
-                                        _cutPoints.insert(mp1);
-
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit0
-                                            = _cutPoints.insert(mp0);
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit1
-                                            = _cutPoints.insert(mp1);
-
-                                        _edges[Edge(mp0, mp1)] = EdgeInfo();
-
-                                        _facet2points[0][fidx1].push_back(pit0.first);
-                                        _facet2points[0][fidx1].push_back(pit1.first);
-                                        _facet2points[1][fidx2].push_back(pit0.first);
-                                        _facet2points[1][fidx2].push_back(pit1.first);
-                                    }
-                                    else {
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit
-                                            = _cutPoints.insert(mp0);
-
-                                        // do not insert a facet when only one corner point cuts the
-                                        // edge if (!((mp0 == f1._aclPoints[0]) || (mp0 ==
-                                        // f1._aclPoints[1]) || (mp0 == f1._aclPoints[2])))
-                                        {
-                                            facetsCuttingEdge0.insert(fidx1);
-                                            _facet2points[0][fidx1].push_back(pit.first);
-                                        }
-
-                                        // if (!((mp0 == f2._aclPoints[0]) || (mp0 ==
-                                        // f2._aclPoints[1]) || (mp0 == f2._aclPoints[2])))
-                                        {
-                                            facetsCuttingEdge1.insert(fidx2);
-                                            _facet2points[1][fidx2].push_back(pit.first);
-                                        }
-                                    }
+                    cells.push_back({gx1, gy1, gz1});
+                }
+            }
+        }
+    }
+
+    // The grid elements are intersected in parallel. Afterwards the results are merged in the
+    // order of the grid elements so that the cut points and edges are the same as in serial mode.
+    std::vector<std::vector<CutSegment>> segments(cells.size());
+    auto cutCells = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            const auto& cell = cells[index];
+            std::vector<FacetIndex> vecFacets2;
+            grid2.Inside(grid1.GetBoundBox(cell[0], cell[1], cell[2]), vecFacets2);
+
+            if (!vecFacets2.empty()) {
+                std::set<FacetIndex> vecFacets1;
+                grid1.GetElements(cell[0], cell[1], cell[2], vecFacets1);
+
+                std::set<FacetIndex>::iterator it1;
+                for (it1 = vecFacets1.begin(); it1 != vecFacets1.end(); ++it1) {
+                    FacetIndex fidx1 = *it1;
+                    MeshGeomFacet f1 = _cutMesh0.GetFacet(*it1);
+
+                    std::vector<FacetIndex>::iterator it2;
+                    for (it2 = vecFacets2.begin(); it2 != vecFacets2.end(); ++it2) {
+                        FacetIndex fidx2 = *it2;
+                        MeshGeomFacet f2 = _cutMesh1.GetFacet(fidx2);
+
+                        MeshPoint p0, p1;
+
+                        int isect = f1.IntersectWithFacet(f2, p0, p1);
+                        if (isect > 0) {
+                            // optimize cut line if distance to nearest point is too small
+                            float minDist1 = _minDistanceToPoint, minDist2 = _minDistanceToPoint;
+                            MeshPoint np0 = p0, np1 = p1;
+                            for (int i = 0; i < 3; i++)  // NOLINT
+                            {
+                                float d1 = (f1._aclPoints[i] - p0).Length();
+                                float d2 = (f1._aclPoints[i] - p1).Length();
+                                if (d1 < minDist1) {
+                                    minDist1 = d1;
+                                    np0 = f1._aclPoints[i];
+                                }
+                                if (d2 < minDist2) {
+                                    minDist2 = d2;
+                                    p1 = f1._aclPoints[i];
+                                }
+                            }  // for (int i = 0; i < 3; i++)
+
+                            // optimize cut line if distance to nearest point is too small
+                            for (int i = 0; i < 3; i++)  // NOLINT
+                            {
+                                float d1 = (f2._aclPoints[i] - p0).Length();
+                                float d2 = (f2._aclPoints[i] - p1).Length();
+                                if (d1 < minDist1) {
+                                    minDist1 = d1;
+                                    np0 = f2._aclPoints[i];
+                                }
+                                if (d2 < minDist2) {
+                                    minDist2 = d2;
+                                    np1 = f2._aclPoints[i];
                                 }
-                            }
+                            }  // for (int i = 0; i < 3; i++)
+
+                            segments[index].push_back({fidx1, fidx2, np0, np1});
                         }
                     }
                 }
             }
         }
+    };
+
+    int threads = int(std::thread::hardware_concurrency());
+    MeshCore::parallel_for(cells.size(), cutCells, threads);
+
+    for (const auto& cell : segments) {
+        for (const auto& segment : cell) {
+            FacetIndex fidx1 = segment.fidx1;
+            FacetIndex fidx2 = segment.fidx2;
+            const MeshPoint& mp0 = segment.mp0;
+            const MeshPoint& mp1 = segment.mp1;
+
+            if (mp0 != mp1) {
+                facetsCuttingEdge0.insert(fidx1);
+                facetsCuttingEdge1.insert(fidx2);
+
+                std::pair<std::set<MeshPoint>::iterator, bool> pit0 = _cutPoints.insert(mp0);
+                std::pair<std::set<MeshPoint>::iterator, bool> pit1 = _cutPoints.insert(mp1);
+
+                _edges[Edge(mp0, mp1)] = EdgeInfo();
+
+                _facet2points[0][fidx1].push_back(pit0.first);
+                _facet2points[0][fidx1].push_back(pit1.first);
+                _facet2points[1][fidx2].push_back(pit0.first);
+                _facet2points[1][fidx2].push_back(pit1.first);
+            }
+            else {
+                std::pair<std::set<MeshPoint>::iterator, bool> pit = _cutPoints.insert(mp0);
+
+                // do not insert a facet when only one corner point cuts the
+                // edge if (!((mp0 == f1._aclPoints[0]) || (mp0 ==
+                // f1._aclPoints[1]) || (mp0 == f1._aclPoints[2])))
+                {
+                    facetsCuttingEdge0.insert(fidx1);
+                    _facet2points[0][fidx1].push_back(pit.first);
+                }
+
+                // if (!((mp0 == f2._aclPoints[0]) || (mp0 ==
+                // f2._aclPoints[1]) || (mp0 == f2._aclPoints[2])))
+                {
+                    facetsCuttingEdge1.insert(fidx2);
+                    _facet2points[1][fidx2].push_back(pit.first);
+                }
+            }
+        }
     }
 }
 
@@ -12,9 +12,15 @@
 // * Comment out printf statements
 // * Fix compiler warnings
 // * Remove macros loop,i,j,k
+// * Initialize quadrics, edge errors and borders in parallel
+// * Add a per-iteration progress callback
+// * Optionally collapse an independent set of edges concurrently
 
+#include <functional>
 #include <vector>
 
+#include "Functional.h"
+
 using vec3f = Base::Vector3f;
 
 class SymmetricMatrix {
@@ -87,6 +93,12 @@ public:
     std::vector<Triangle> triangles;
     std::vector<Vertex> vertices;
     std::vector<Ref> refs;
+    // number of threads used for the initialization of the mesh
+    int threads = 1;
+    // called once per iteration with the current and the target number of triangles
+    std::function<void(int,int)> progress;
+    // collapse the edges of an iteration concurrently instead of one after another
+    bool concurrent = false;
 
     void simplify_mesh(int target_count, double tolerance, double aggressiveness=7);
 
@@ -97,6 +109,8 @@ private:
     double calculate_error(int id_v1, int id_v2, vec3f &p_result);
     bool flipped(vec3f p,int i0,int i1,Vertex &v0,Vertex &v1,std::vector<int> &deleted);
     void update_triangles(int i0,Vertex &v,std::vector<int> &deleted,int &deleted_triangles);
+    void update_triangles(int i0,Vertex &v,std::vector<int> &deleted,int &deleted_triangles,int &tend);
+    void collapse_independent(double threshold,int removable,int &deleted_triangles);
     void update_mesh(int iteration);
     void compact_mesh();
 };
@@ -136,6 +150,9 @@ void Simplify::simplify_mesh(int target_count, double tolerance, double aggressi
         if (triangle_count-deleted_triangles<=target_count)
             break;
 
+        if (progress)
+            progress(triangle_count-deleted_triangles, target_count);
+
         // update mesh once in a while
         if (iteration%5==0)
         {
@@ -174,6 +191,12 @@ void Simplify::simplify_mesh(int target_count, double tolerance, double aggressi
                 break;
         }
 
+        if (concurrent)
+        {
+            collapse_independent(threshold,triangle_count-deleted_triangles-target_count,deleted_triangles);
+            continue;
+        }
+
         // remove vertices & mark deleted triangles
         for (std::size_t i=0;i<triangles.size();++i)
         {
@@ -318,6 +341,209 @@ void Simplify::update_triangles(int i0,Vertex &v,std::vector<int> &deleted,int &
     }
 }
 
+// Same as above but writes the references to a reserved range starting at tend
+
+void Simplify::update_triangles(int i0,Vertex &v,std::vector<int> &deleted,int &deleted_triangles,int &tend)
+{
+    vec3f p;
+    for (int k=0;k<v.tcount;++k)
+    {
+        Ref r=refs[v.tstart+k];
+        Triangle &t=triangles[r.tid];
+        if (t.deleted)
+            continue;
+        if (deleted[k])
+        {
+            t.deleted=1;
+            deleted_triangles++;
+            continue;
+        }
+        t.v[r.tvertex]=i0;
+        t.dirty=1;
+        t.err[0]=calculate_error(t.v[0],t.v[1],p);
+        t.err[1]=calculate_error(t.v[1],t.v[2],p);
+        t.err[2]=calculate_error(t.v[2],t.v[0],p);
+        t.err[3]=std::min(t.err[0],std::min(t.err[1],t.err[2]));
+        refs[tend++]=r;
+    }
+}
+
+// Collapse sets of independent edges
+//
+// The collapse candidates of the triangles are searched in parallel. Then they are
+// selected in triangle order, skipping every candidate with an end point in the
+// one-ring of an already selected edge. So no two selected collapses share a triangle
+// and none of them moves a vertex that another one reads, and they run in parallel.
+// The skipped triangles are searched again on the changed mesh unless they became
+// dirty. The result doesn't depend on the number of threads but differs from the
+// serial collapse.
+//
+// removable : number of triangles that may be removed before the target is reached
+
+void Simplify::collapse_independent(double threshold,int removable,int &deleted_triangles)
+{
+    struct Collapse { int i0,i1,removed,tstart; vec3f p; };
+    std::vector<int> pending;
+    for (std::size_t i=0;i<triangles.size();++i)
+    {
+        const Triangle &t=triangles[i];
+        if (t.err[3]<=threshold && !t.deleted)
+            pending.push_back(int(i));
+    }
+
+    std::vector<Collapse> candidates;
+    std::vector<Collapse> selected;
+    std::vector<int> skipped;
+    std::vector<char> locked(vertices.size(),0);
+    std::vector<int> lockedIds;
+    auto lock=[this,&locked,&lockedIds](int id)
+    {
+        const Vertex &v=vertices[id];
+        for (int k=0;k<v.tcount;++k)
+        {
+            const Triangle &t=triangles[refs[v.tstart+k].tid];
+            if (t.deleted)
+                continue;
+            for (int j=0;j<3;++j)
+            {
+                if (!locked[t.v[j]])
+                {
+                    locked[t.v[j]]=1;
+                    lockedIds.push_back(t.v[j]);
+                }
+            }
+        }
+    };
+
+    int removed=0;
+    while (!pending.empty() && removed<removable)
+    {
+        candidates.resize(pending.size());
+        MeshCore::parallel_for(pending.size(), [this,threshold,&pending,&candidates](std::size_t begin, std::size_t end) {
+            std::vector<int> deleted0,deleted1;
+            for (std::size_t i=begin;i<end;++i)
+            {
+                Collapse &c=candidates[i];
+                c.i0=-1;
+                Triangle &t=triangles[pending[i]];
+                if (t.deleted)
+                    continue;
+                if (t.dirty)
+                    continue;
+
+                for (std::size_t j=0;j<3;++j)
+                {
+                    if (t.err[j]<threshold)
+                    {
+                        int i0=t.v[ j     ]; Vertex &v0 = vertices[i0];
+                        int i1=t.v[(j+1)%3]; Vertex &v1 = vertices[i1];
+
+                        // Border check
+                        if (v0.border != v1.border)
+                            continue;
+
+                        // Compute vertex to collapse to
+                        vec3f p;
+                        calculate_error(i0,i1,p);
+
+                        deleted0.resize(v0.tcount);
+                        deleted1.resize(v1.tcount);
+
+                        // don't remove if flipped
+                        if (flipped(p,i0,i1,v0,v1,deleted0))
+                            continue;
+                        if (flipped(p,i1,i0,v1,v0,deleted1))
+                            continue;
+
+                        c.i0=i0;
+                        c.i1=i1;
+                        c.p=p;
+                        c.removed=0;
+                        for (int k=0;k<v0.tcount;++k)
+                        {
+                            if (deleted0[k] && !triangles[refs[v0.tstart+k].tid].deleted)
+                                c.removed++;
+                        }
+                        break;
+                    }
+                }
+            }
+        }, threads);
+
+        // select the candidates whose edges are outside the one-rings of the selected ones
+        selected.clear();
+        skipped.clear();
+        int tend=refs.size();
+        for (std::size_t i=0;i<pending.size();++i)
+        {
+            Collapse &c=candidates[i];
+            if (removed>=removable)
+                break;
+            if (c.i0<0)
+                continue;
+            if (locked[c.i0] || locked[c.i1])
+            {
+                skipped.push_back(pending[i]);
+                continue;
+            }
+            lock(c.i0);
+            lock(c.i1);
+            c.tstart=tend;
+            tend+=vertices[c.i0].tcount+vertices[c.i1].tcount;
+            removed+=c.removed;
+            selected.push_back(c);
+        }
+
+        refs.resize(tend);
+        MeshCore::parallel_for(selected.size(), [this,&selected](std::size_t begin, std::size_t end) {
+            std::vector<int> deleted0,deleted1;
+            int count=0;
+            for (std::size_t i=begin;i<end;++i)
+            {
+                const Collapse &c=selected[i];
+                Vertex &v0=vertices[c.i0];
+                Vertex &v1=vertices[c.i1];
+
+                // the mesh around the edge is unchanged, so this restores the flags of the search
+                deleted0.resize(v0.tcount);
+                deleted1.resize(v1.tcount);
+                flipped(c.p,c.i0,c.i1,v0,v1,deleted0);
+                flipped(c.p,c.i1,c.i0,v1,v0,deleted1);
+
+                v0.p=c.p;
+                v0.q=v1.q+v0.q;
+                int rend=c.tstart;
+
+                update_triangles(c.i0,v0,deleted0,count,rend);
+                update_triangles(c.i0,v1,deleted1,count,rend);
+
+                int tcount=rend-c.tstart;
+
+                if (tcount<=v0.tcount)
+                {
+                    // save ram
+                    if (tcount)
+                        memcpy(&refs[v0.tstart],&refs[c.tstart],tcount*sizeof(Ref));
+                }
+                else
+                {
+                    // append
+                    v0.tstart=c.tstart;
+                }
+
+                v0.tcount=tcount;
+            }
+        }, threads);
+
+        for (int id : lockedIds)
+            locked[id]=0;
+        lockedIds.clear();
+        pending.swap(skipped);
+    }
+
+    deleted_triangles+=removed;
+}
+
 // compact triangles, compute edge error and build reference list
 
 void Simplify::update_mesh(int iteration)
@@ -334,40 +560,6 @@ void Simplify::update_mesh(int iteration)
         }
         triangles.resize(dst);
     }
-    //
-    // Init Quadrics by Plane & Edge Errors
-    //
-    // required at the beginning ( iteration == 0 )
-    // recomputing during the simplification is not required,
-    // but mostly improves the result for closed meshes
-    //
-    if (iteration == 0)
-    {
-        for (std::size_t i=0;i<vertices.size();++i)
-            vertices[i].q=SymmetricMatrix(0.0);
-
-        for (std::size_t i=0;i<triangles.size();++i)
-        {
-            Triangle &t=triangles[i];
-            vec3f n,p[3];
-            for (std::size_t j=0;j<3;++j)
-                p[j]=vertices[t.v[j]].p;
-            n = (p[1]-p[0]).Cross(p[2]-p[0]);
-            n.Normalize();
-            t.n=n;
-            for (std::size_t j=0;j<3;++j)
-                vertices[t.v[j]].q = vertices[t.v[j]].q+SymmetricMatrix(n.x,n.y,n.z,-n.Dot(p[0]));
-        }
-        for (std::size_t i=0;i<triangles.size();++i)
-        {
-            // Calc Edge Error
-            Triangle &t=triangles[i];vec3f p;
-            for (std::size_t j=0;j<3;++j)
-                t.err[j] = calculate_error(t.v[j],t.v[(j+1)%3],p);
-            t.err[3]=std::min(t.err[0],std::min(t.err[1],t.err[2]));
-        }
-    }
-
     // Init Reference ID list
     for (std::size_t i=0;i<vertices.size();++i)
     {
@@ -403,48 +595,103 @@ void Simplify::update_mesh(int iteration)
         }
     }
 
-    // Identify boundary : vertices[].border=0,1
+    //
+    // Init Quadrics by Plane & Edge Errors
+    //
+    // required at the beginning ( iteration == 0 )
+    // recomputing during the simplification is not required,
+    // but mostly improves the result for closed meshes
+    //
+    // The reference list is already built so that every vertex can
+    // gather the quadrics of its triangles. As the references are
+    // sorted by triangle index the sums are the same as in serial mode.
+    //
     if (iteration == 0)
     {
-        std::vector<int> vcount,vids;
-
-        for (std::size_t i=0;i<vertices.size();++i)
-            vertices[i].border=0;
+        MeshCore::parallel_for(triangles.size(), [this](std::size_t begin, std::size_t end) {
+            for (std::size_t i=begin;i<end;++i)
+            {
+                Triangle &t=triangles[i];
+                vec3f n,p[3];
+                for (std::size_t j=0;j<3;++j)
+                    p[j]=vertices[t.v[j]].p;
+                n = (p[1]-p[0]).Cross(p[2]-p[0]);
+                n.Normalize();
+                t.n=n;
+            }
+        }, threads);
+        MeshCore::parallel_for(vertices.size(), [this](std::size_t begin, std::size_t end) {
+            for (std::size_t i=begin;i<end;++i)
+            {
+                Vertex &v=vertices[i];
+                v.q=SymmetricMatrix(0.0);
+                for (int k=0;k<v.tcount;++k)
+                {
+                    const Triangle &t=triangles[refs[v.tstart+k].tid];
+                    const vec3f &n=t.n;
+                    v.q = v.q+SymmetricMatrix(n.x,n.y,n.z,-n.Dot(vertices[t.v[0]].p));
+                }
+            }
+        }, threads);
+        MeshCore::parallel_for(triangles.size(), [this](std::size_t begin, std::size_t end) {
+            for (std::size_t i=begin;i<end;++i)
+            {
+                // Calc Edge Error
+                Triangle &t=triangles[i];vec3f p;
+                for (std::size_t j=0;j<3;++j)
+                    t.err[j] = calculate_error(t.v[j],t.v[(j+1)%3],p);
+                t.err[3]=std::min(t.err[0],std::min(t.err[1],t.err[2]));
+            }
+        }, threads);
+    }
 
-        for (std::size_t i=0;i<vertices.size();++i)
-        {
-            Vertex &v=vertices[i];
-            vcount.clear();
-            vids.clear();
-            for (int j=0; j<v.tcount; ++j)
+    // Identify boundary : vertices[].border=0,1
+    //
+    // A neighbour that shares only one triangle with a vertex spans a border
+    // edge with it. This relation is symmetric, so every vertex only has to
+    // decide about itself and the vertices can be handled independently.
+    if (iteration == 0)
+    {
+        MeshCore::parallel_for(vertices.size(), [this](std::size_t begin, std::size_t end) {
+            std::vector<int> vcount,vids;
+            for (std::size_t i=begin;i<end;++i)
             {
-                int k=refs[v.tstart+j].tid;
-                Triangle &t=triangles[k];
-                for (int k=0;k<3;++k)
+                Vertex &v=vertices[i];
+                v.border=0;
+                vcount.clear();
+                vids.clear();
+                for (int j=0; j<v.tcount; ++j)
                 {
-                    std::size_t ofs=0; int id=t.v[k];
-                    while(ofs<vcount.size())
-                    {
-                        if (vids[ofs]==id)
-                            break;
-                        ofs++;
-                    }
-                    if(ofs==vcount.size())
+                    int k=refs[v.tstart+j].tid;
+                    Triangle &t=triangles[k];
+                    for (int k=0;k<3;++k)
                     {
-                        vcount.push_back(1);
-                        vids.push_back(id);
+                        std::size_t ofs=0; int id=t.v[k];
+                        while(ofs<vcount.size())
+                        {
+                            if (vids[ofs]==id)
+                                break;
+                            ofs++;
+                        }
+                        if(ofs==vcount.size())
+                        {
+                            vcount.push_back(1);
+                            vids.push_back(id);
+                        }
+                        else
+                        {
+                            vcount[ofs]++;
+                        }
                     }
-                    else
-                    {
-                        vcount[ofs]++;
+                }
+                for (std::size_t j=0;j<vcount.size();++j) {
+                    if (vcount[j]==1) {
+                        v.border=1;
+                        break;
                     }
                 }
             }
-            for (std::size_t j=0;j<vcount.size();++j) {
-                if (vcount[j]==1)
-                    vertices[vids[j]].border=1;
-            }
-        }
+        }, threads);
     }
 }
 
@@ -22,13 +22,15 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <cmath>
-
+#include <thread>
 
 #include <Base/Tools.h>
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
 #include "Smoothing.h"
@@ -36,6 +38,42 @@
 
 using namespace MeshCore;
 
+namespace
+{
+int numThreads()
+{
+    return int(std::thread::hardware_concurrency());
+}
+
+Base::Vector3f umbrellaOperator(
+    const MeshPointArray& points,
+    const MeshPointNeighbourhood& nb,
+    PointIndex pos,
+    double stepsize
+)
+{
+    const MeshPoint& pnt = points[pos];
+    std::size_t n_count = nb.CountNeighbours(pos);
+    if (n_count < 3 || nb.IsBorder(pos)) {
+        // do nothing for border points
+        return pnt;
+    }
+
+    double delx = 0.0, dely = 0.0, delz = 0.0;
+    for (const PointIndex* it = nb.begin(pos); it != nb.end(pos); ++it) {
+        const MeshPoint& neighbour = points[*it];
+        delx += static_cast<double>(neighbour.x - pnt.x);
+        dely += static_cast<double>(neighbour.y - pnt.y);
+        delz += static_cast<double>(neighbour.z - pnt.z);
+    }
+
+    double w = stepsize / double(n_count);
+    float x = static_cast<float>(static_cast<double>(pnt.x) + w * delx);
+    float y = static_cast<float>(static_cast<double>(pnt.y) + w * dely);
+    float z = static_cast<float>(static_cast<double>(pnt.z) + w * delz);
+    return Base::Vector3f(x, y, z);
+}
+}  // namespace
 
 AbstractSmoothing::AbstractSmoothing(MeshKernel& m)
     : kernel(m)
@@ -49,118 +87,103 @@ void AbstractSmoothing::initialize(Component comp, Continuity cont)
     this->continuity = cont;
 }
 
+void AbstractSmoothing::notifyProgress(unsigned int done, unsigned int total) const
+{
+    if (progress) {
+        progress(done, total);
+    }
+}
+
 PlaneFitSmoothing::PlaneFitSmoothing(MeshKernel& m)
     : AbstractSmoothing(m)
 {}
 
-void PlaneFitSmoothing::Smooth(unsigned int iterations)
+Base::Vector3f PlaneFitSmoothing::FitPoint(const MeshPointNeighbourhood& nb, PointIndex pos) const
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
+    const MeshPointArray& points = kernel.GetPoints();
+    const MeshPoint& pnt = points[pos];
+    std::size_t n_count = nb.CountNeighbours(pos);
+    if (n_count < 3) {
+        return pnt;
+    }
 
-    MeshCore::MeshPointIterator v_it(kernel);
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
+    MeshCore::PlaneFit pf;
+    pf.AddPoint(pnt);
+    Base::Vector3f center = pnt;
+    for (const PointIndex* it = nb.begin(pos); it != nb.end(pos); ++it) {
+        pf.AddPoint(points[*it]);
+        center += points[*it];
+    }
 
-    for (unsigned int i = 0; i < iterations; i++) {
-        Base::Vector3f N, L;
-        for (v_it.Begin(); v_it.More(); v_it.Next()) {
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<PointIndex>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3) {
-                continue;
-            }
+    float scale = 1.0F / (static_cast<float>(n_count) + 1.0F);
+    center.Scale(scale, scale, scale);
 
-            std::set<PointIndex>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
+    // get the mean plane of the current vertex with the surrounding vertices
+    pf.Fit();
+    Base::Vector3f N = pf.GetNormal();
+    N.Normalize();
 
-            float scale = 1.0F / (static_cast<float>(cv.size()) + 1.0F);
-            center.Scale(scale, scale, scale);
+    // look in which direction we should move the vertex
+    Base::Vector3f L(pnt.x - center.x, pnt.y - center.y, pnt.z - center.z);
+    if (N * L < 0.0F) {
+        N.Scale(-1.0, -1.0, -1.0);
+    }
 
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
+    // maximum value to move is distance to mean plane
+    float d = std::min<float>(std::fabs(this->maximum), fabs(N * L));
+    N.Scale(d, d, d);
 
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N * L < 0.0F) {
-                N.Scale(-1.0, -1.0, -1.0);
-            }
+    return Base::Vector3f(pnt.x - N.x, pnt.y - N.y, pnt.z - N.z);
+}
 
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(std::fabs(this->maximum), fabs(N * L));
-            N.Scale(d, d, d);
+void PlaneFitSmoothing::Smooth(unsigned int iterations)
+{
+    MeshCore::MeshPointNeighbourhood nb(kernel);
+    std::vector<Base::Vector3f> moved(kernel.CountPoints());
 
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
+    for (unsigned int i = 0; i < iterations; i++) {
+        MeshCore::parallel_for(
+            moved.size(),
+            [&](std::size_t begin, std::size_t end) {
+                for (std::size_t pos = begin; pos < end; pos++) {
+                    moved[pos] = FitPoint(nb, PointIndex(pos));
+                }
+            },
+            numThreads()
+        );
 
         // assign values without affecting iterators
         PointIndex count = kernel.CountPoints();
         for (PointIndex idx = 0; idx < count; idx++) {
-            kernel.SetPoint(idx, PointArray[idx]);
+            kernel.SetPoint(idx, moved[idx]);
         }
+
+        notifyProgress(i + 1, iterations);
     }
 }
 
 void PlaneFitSmoothing::SmoothPoints(unsigned int iterations, const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
-
-    MeshCore::MeshPointIterator v_it(kernel);
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
+    MeshCore::MeshPointNeighbourhood nb(kernel);
+    std::vector<Base::Vector3f> moved(point_indices.size());
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Base::Vector3f N, L;
-        for (PointIndex it : point_indices) {
-            v_it.Set(it);
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<PointIndex>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3) {
-                continue;
-            }
-
-            std::set<PointIndex>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
-
-            float scale = 1.0F / (static_cast<float>(cv.size()) + 1.0F);
-            center.Scale(scale, scale, scale);
-
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
-
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N * L < 0.0F) {
-                N.Scale(-1.0, -1.0, -1.0);
-            }
-
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(std::fabs(this->maximum), fabs(N * L));
-            N.Scale(d, d, d);
-
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
+        MeshCore::parallel_for(
+            moved.size(),
+            [&](std::size_t begin, std::size_t end) {
+                for (std::size_t pos = begin; pos < end; pos++) {
+                    moved[pos] = FitPoint(nb, point_indices[pos]);
+                }
+            },
+            numThreads()
+        );
 
         // assign values without affecting iterators
-        PointIndex count = kernel.CountPoints();
-        for (PointIndex idx = 0; idx < count; idx++) {
-            kernel.SetPoint(idx, PointArray[idx]);
+        for (std::size_t pos = 0; pos < moved.size(); pos++) {
+            kernel.SetPoint(point_indices[pos], moved[pos]);
         }
+
+        notifyProgress(i + 1, iterations);
     }
 }
 
@@ -168,101 +191,68 @@ LaplaceSmoothing::LaplaceSmoothing(MeshKernel& m)
     : AbstractSmoothing(m)
 {}
 
-void LaplaceSmoothing::Umbrella(
-    const MeshRefPointToPoints& vv_it,
-    const MeshRefPointToFacets& vf_it,
-    double stepsize
-)
+void LaplaceSmoothing::Umbrella(const MeshPointNeighbourhood& nb, double stepsize)
 {
     const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_it, v_beg = points.begin(), v_end = points.end();
-
-    PointIndex pos = 0;
-    for (v_it = points.begin(); v_it != v_end; ++v_it, ++pos) {
-        const std::set<PointIndex>& cv = vv_it[pos];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[pos].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
+    std::vector<Base::Vector3f> moved(points.size());
 
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - v_it->x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - v_it->y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - v_it->z);
-        }
+    MeshCore::parallel_for(
+        moved.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t pos = begin; pos < end; pos++) {
+                moved[pos] = umbrellaOperator(points, nb, PointIndex(pos), stepsize);
+            }
+        },
+        numThreads()
+    );
 
-        float x = static_cast<float>(static_cast<double>(v_it->x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>(v_it->y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>(v_it->z) + stepsize * delz);
-        kernel.SetPoint(pos, x, y, z);
+    PointIndex count = kernel.CountPoints();
+    for (PointIndex idx = 0; idx < count; idx++) {
+        kernel.SetPoint(idx, moved[idx]);
     }
 }
 
 void LaplaceSmoothing::Umbrella(
-    const MeshRefPointToPoints& vv_it,
-    const MeshRefPointToFacets& vf_it,
+    const MeshPointNeighbourhood& nb,
     double stepsize,
     const std::vector<PointIndex>& point_indices
 )
 {
     const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_beg = points.begin();
+    std::vector<Base::Vector3f> moved(point_indices.size());
 
-    for (PointIndex it : point_indices) {
-        const std::set<PointIndex>& cv = vv_it[it];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[it].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
-
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - (v_beg[it]).x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - (v_beg[it]).y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - (v_beg[it]).z);
-        }
+    MeshCore::parallel_for(
+        moved.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t pos = begin; pos < end; pos++) {
+                moved[pos] = umbrellaOperator(points, nb, point_indices[pos], stepsize);
+            }
+        },
+        numThreads()
+    );
 
-        float x = static_cast<float>(static_cast<double>((v_beg[it]).x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>((v_beg[it]).y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>((v_beg[it]).z) + stepsize * delz);
-        kernel.SetPoint(it, x, y, z);
+    for (std::size_t pos = 0; pos < moved.size(); pos++) {
+        kernel.SetPoint(point_indices[pos], moved[pos]);
     }
 }
 
 void LaplaceSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshPointNeighbourhood nb(kernel);
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda);
+        Umbrella(nb, lambda);
+        notifyProgress(i + 1, iterations);
     }
 }
 
 void LaplaceSmoothing::SmoothPoints(unsigned int iterations, const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshPointNeighbourhood nb(kernel);
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda, point_indices);
+        Umbrella(nb, lambda, point_indices);
+        notifyProgress(i + 1, iterations);
     }
 }
 
@@ -272,27 +262,27 @@ TaubinSmoothing::TaubinSmoothing(MeshKernel& m)
 
 void TaubinSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshPointNeighbourhood nb(kernel);
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda());
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro));
+        Umbrella(nb, GetLambda());
+        Umbrella(nb, -(GetLambda() + micro));
+        notifyProgress(i + 1, iterations);
     }
 }
 
 void TaubinSmoothing::SmoothPoints(unsigned int iterations, const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshPointNeighbourhood nb(kernel);
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda(), point_indices);
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro), point_indices);
+        Umbrella(nb, GetLambda(), point_indices);
+        Umbrella(nb, -(GetLambda() + micro), point_indices);
+        notifyProgress(i + 1, iterations);
     }
 }
 
@@ -332,6 +322,7 @@ void MedianFilterSmoothing::Smooth(unsigned int iterations)
 
     for (unsigned int i = 0; i < iterations; i++) {
         UpdatePoints(ff_it, vf_it, point_indices);
+        notifyProgress(i + 1, iterations);
     }
 }
 
@@ -345,6 +336,7 @@ void MedianFilterSmoothing::SmoothPoints(
 
     for (unsigned int i = 0; i < iterations; i++) {
         UpdatePoints(ff_it, vf_it, point_indices);
+        notifyProgress(i + 1, iterations);
     }
 }
 
@@ -358,44 +350,55 @@ void MedianFilterSmoothing::UpdatePoints(
     const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
 
     // Initialize the array with the real normals
-    std::vector<Base::Vector3d> faceNormals;
-    faceNormals.reserve(facets.size());
-    MeshCore::MeshFacetIterator iter(kernel);
-    for (iter.Init(); iter.More(); iter.Next()) {
-        faceNormals.emplace_back(Base::toVector<double>(iter->GetNormal()));
-    }
+    std::vector<Base::Vector3d> realNormals(facets.size());
+    MeshCore::parallel_for(
+        facets.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t pos = begin; pos < end; pos++) {
+                realNormals[pos] = Base::toVector<double>(kernel.GetFacet(pos).GetNormal());
+            }
+        },
+        numThreads()
+    );
 
     // Step 1: determine face normals
-    for (FacetIndex pos = 0; pos < facets.size(); pos++) {
-        iter.Set(pos);
-        Base::Vector3d refNormal = Base::toVector<double>(iter->GetNormal());
-        const std::set<FacetIndex>& cv = ff_it[pos];
-        const MeshCore::MeshFacet& facet = facets[pos];
-
-        std::vector<AngleNormal> anglesWithFaces;
-        for (auto fi : cv) {
-            iter.Set(fi);
-            Base::Vector3d faceNormal = Base::toVector<double>(iter->GetNormal());
-            double angle = refNormal.GetAngle(faceNormal);
-
-            int absWeight = std::abs(weights);
-            if (absWeight > 1 && facet.IsNeighbour(fi)) {
-                if (weights < 0) {
-                    angle = -angle;
+    std::vector<Base::Vector3d> faceNormals(facets.size());
+    MeshCore::parallel_for(
+        facets.size(),
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<AngleNormal> anglesWithFaces;
+            for (FacetIndex pos = begin; pos < end; pos++) {
+                const Base::Vector3d& refNormal = realNormals[pos];
+                const std::set<FacetIndex>& cv = ff_it[pos];
+                const MeshCore::MeshFacet& facet = facets[pos];
+
+                anglesWithFaces.clear();
+                for (auto fi : cv) {
+                    const Base::Vector3d& faceNormal = realNormals[fi];
+                    double angle = refNormal.GetAngle(faceNormal);
+
+                    int absWeight = std::abs(weights);
+                    if (absWeight > 1 && facet.IsNeighbour(fi)) {
+                        if (weights < 0) {
+                            angle = -angle;
+                        }
+                        for (int i = 0; i < absWeight; i++) {
+                            anglesWithFaces.emplace_back(angle, faceNormal);
+                        }
+                    }
+                    else {
+                        anglesWithFaces.emplace_back(angle, faceNormal);
+                    }
                 }
-                for (int i = 0; i < absWeight; i++) {
-                    anglesWithFaces.emplace_back(angle, faceNormal);
-                }
-            }
-            else {
-                anglesWithFaces.emplace_back(angle, faceNormal);
-            }
-        }
 
-        faceNormals[pos] = find_median(anglesWithFaces);
-    }
+                faceNormals[pos] = find_median(anglesWithFaces);
+            }
+        },
+        numThreads()
+    );
 
     // Step 2: move vertices
+    MeshCore::MeshFacetIterator iter(kernel);
     for (auto pos : point_indices) {
         Base::Vector3d P = Base::toVector<double>(points[pos]);
         const std::set<FacetIndex>& cv = vf_it[pos];
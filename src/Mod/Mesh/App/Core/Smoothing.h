@@ -24,16 +24,19 @@
 
 #pragma once
 
+#include <functional>
 #include <limits>
 #include <vector>
 
+#include <Base/Vector3D.h>
+
 #include "Definitions.h"
 
 
 namespace MeshCore
 {
 class MeshKernel;
-class MeshRefPointToPoints;
+class MeshPointNeighbourhood;
 class MeshRefPointToFacets;
 class MeshRefFacetToFacets;
 
@@ -68,13 +71,26 @@ public:
     virtual void Smooth(unsigned int) = 0;
     virtual void SmoothPoints(unsigned int, const std::vector<PointIndex>&) = 0;
 
+    /** The callback is invoked after each iteration with the number of finished
+     * and the total number of iterations.
+     */
+    void SetProgressCallback(std::function<void(unsigned int, unsigned int)> func)
+    {
+        progress = std::move(func);
+    }
+
 protected:
+    void notifyProgress(unsigned int done, unsigned int total) const;
+
     // NOLINTBEGIN
     MeshKernel& kernel;
 
     Component component {Normal};
     Continuity continuity {C0};
     // NOLINTEND
+
+private:
+    std::function<void(unsigned int, unsigned int)> progress;
 };
 
 class MeshExport PlaneFitSmoothing: public AbstractSmoothing
@@ -88,10 +104,21 @@ public:
     void Smooth(unsigned int) override;
     void SmoothPoints(unsigned int, const std::vector<PointIndex>&) override;
 
+private:
+    Base::Vector3f FitPoint(const MeshPointNeighbourhood&, PointIndex) const;
+
 private:
     float maximum {std::numeric_limits<float>::max()};
 };
 
+/*!
+ * \brief The LaplaceSmoothing class
+ * Moves every inner point towards the average of its neighbours (umbrella operator).
+ * All points of an iteration are moved at once, so that a new position only depends on
+ * the positions of the previous iteration and not on the order of the points. Before the
+ * points were moved one after the other and later points already used the moved
+ * neighbours, so the results slightly differ from older versions.
+ */
 class MeshExport LaplaceSmoothing: public AbstractSmoothing
 {
 public:
@@ -108,13 +135,8 @@ public:
     }
 
 protected:
-    void Umbrella(const MeshRefPointToPoints&, const MeshRefPointToFacets&, double);
-    void Umbrella(
-        const MeshRefPointToPoints&,
-        const MeshRefPointToFacets&,
-        double,
-        const std::vector<PointIndex>&
-    );
+    void Umbrella(const MeshPointNeighbourhood&, double);
+    void Umbrella(const MeshPointNeighbourhood&, double, const std::vector<PointIndex>&);
 
 private:
     double lambda {0.6307};
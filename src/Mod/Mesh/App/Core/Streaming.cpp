@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <thread>
+
+
+#include <Base/Sequencer.h>
+
+#include "Functional.h"
+#include "IO/StreamReader.h"
+#include "IO/StreamSTL.h"
+#include "MeshKernel.h"
+#include "Streaming.h"
+#include "TrimByPlane.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// the point indices of a facet independent of its orientation
+std::array<PointIndex, 3> SortedKey(const MeshFacet& face)
+{
+    std::array<PointIndex, 3> key = {face._aulPoints[0], face._aulPoints[1], face._aulPoints[2]};
+    std::sort(key.begin(), key.end());
+    return key;
+}
+}  // namespace
+
+MeshStreamPreview::MeshStreamPreview(const Base::BoundBox3f& box, unsigned long resolution)
+    : _box(box)
+{
+    // use cubic cells with the length defined by the longest side of the box
+    resolution = std::max<unsigned long>(resolution, 1);
+    float length = std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+    float cell = length > 0.0F ? length / float(resolution) : 1.0F;
+    _fGridLenX = _fGridLenY = _fGridLenZ = cell;
+    _ulCtGridsX = std::max<unsigned long>(static_cast<unsigned long>(box.LengthX() / cell), 1);
+    _ulCtGridsY = std::max<unsigned long>(static_cast<unsigned long>(box.LengthY() / cell), 1);
+    _ulCtGridsZ = std::max<unsigned long>(static_cast<unsigned long>(box.LengthZ() / cell), 1);
+}
+
+PointIndex MeshStreamPreview::GetCluster(const Base::Vector3f& pnt)
+{
+    auto gridIndex = [](float value, float min, float len, unsigned long count) {
+        float pos = (value - min) / len;
+        if (pos <= 0.0F) {
+            return std::uint64_t(0);
+        }
+        return std::min<std::uint64_t>(static_cast<std::uint64_t>(pos), count - 1);
+    };
+
+    std::uint64_t ulX = gridIndex(pnt.x, _box.MinX, _fGridLenX, _ulCtGridsX);
+    std::uint64_t ulY = gridIndex(pnt.y, _box.MinY, _fGridLenY, _ulCtGridsY);
+    std::uint64_t ulZ = gridIndex(pnt.z, _box.MinZ, _fGridLenZ, _ulCtGridsZ);
+    std::uint64_t key = (ulZ * _ulCtGridsY + ulY) * _ulCtGridsX + ulX;
+
+    auto it = _cells.find(key);
+    PointIndex index {};
+    if (it == _cells.end()) {
+        index = static_cast<PointIndex>(_sums.size());
+        _cells.emplace(key, index);
+        _sums.emplace_back(0.0, 0.0, 0.0);
+        _counts.push_back(0);
+    }
+    else {
+        index = it->second;
+    }
+
+    _sums[index] += Base::Vector3d(pnt.x, pnt.y, pnt.z);
+    _counts[index]++;
+    return index;
+}
+
+void MeshStreamPreview::AddFacets(const std::vector<MeshGeomFacet>& facets)
+{
+    for (const auto& it : facets) {
+        PointIndex p0 = GetCluster(it._aclPoints[0]);
+        PointIndex p1 = GetCluster(it._aclPoints[1]);
+        PointIndex p2 = GetCluster(it._aclPoints[2]);
+        if (p0 != p1 && p1 != p2 && p2 != p0) {
+            _facets.emplace_back(p0, p1, p2);
+        }
+    }
+
+    // Many facets collapse to the same cell triple, so remove duplicates once in a
+    // while to keep the memory bounded
+    if (_facets.size() > 8 * _sums.size() + 65536) {
+        RemoveDuplicatedFacets();
+    }
+}
+
+std::size_t MeshStreamPreview::CountFacets() const
+{
+    std::vector<std::array<PointIndex, 3>> keys;
+    keys.reserve(_facets.size());
+    for (const auto& it : _facets) {
+        keys.push_back(SortedKey(it));
+    }
+    std::sort(keys.begin(), keys.end());
+    auto end = std::unique(keys.begin(), keys.end());
+    return static_cast<std::size_t>(std::distance(keys.begin(), end));
+}
+
+void MeshStreamPreview::RemoveDuplicatedFacets()
+{
+    // remove duplicated facets independent of their orientation
+    auto& facets = _facets;
+    std::stable_sort(facets.begin(), facets.end(), [](const MeshFacet& f1, const MeshFacet& f2) {
+        return SortedKey(f1) < SortedKey(f2);
+    });
+    auto end = std::unique(
+        facets.begin(),
+        facets.end(),
+        [](const MeshFacet& f1, const MeshFacet& f2) {
+            return SortedKey(f1) == SortedKey(f2);
+        }
+    );
+    facets.erase(end, facets.end());
+}
+
+void MeshStreamPreview::Finish(MeshKernel& kernel)
+{
+    RemoveDuplicatedFacets();
+
+    MeshPointArray points;
+    points.reserve(_sums.size());
+    for (std::size_t i = 0; i < _sums.size(); i++) {
+        Base::Vector3d pnt = _sums[i] / double(_counts[i]);
+        points.emplace_back(float(pnt.x), float(pnt.y), float(pnt.z));
+    }
+
+    MeshFacetArray facets;
+    facets.reserve(_facets.size());
+    facets.insert(facets.end(), _facets.begin(), _facets.end());
+
+    _cells.clear();
+    _sums.clear();
+    _counts.clear();
+    _facets.clear();
+
+    kernel.Adopt(points, facets, true);
+}
+
+// ----------------------------------------------------------------------------
+
+MeshStreamPipeline::MeshStreamPipeline()
+    : _threads(int(std::thread::hardware_concurrency()))
+{}
+
+void MeshStreamPipeline::SetTransform(const Base::Matrix4D& mat)
+{
+    _transform = mat;
+    _applyTransform = (mat != Base::Matrix4D());
+}
+
+void MeshStreamPipeline::SetTrimPlane(const Base::Vector3f& base, const Base::Vector3f& normal)
+{
+    _base = base;
+    _normal = normal;
+    _trim = true;
+}
+
+void MeshStreamPipeline::SetPreview(MeshStreamPreview* preview)
+{
+    _preview = preview;
+}
+
+void MeshStreamPipeline::SetThreads(int threads)
+{
+    _threads = std::max(threads, 1);
+}
+
+std::size_t MeshStreamPipeline::CountFacets() const
+{
+    return _numFacets;
+}
+
+void MeshStreamPipeline::Process(std::vector<MeshGeomFacet>& facets) const
+{
+    if (_applyTransform) {
+        auto transform = [this, &facets](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                facets[i].Transform(_transform);
+            }
+        };
+        MeshCore::parallel_for(facets.size(), transform, _threads);
+    }
+
+    if (_trim) {
+        std::vector<MeshGeomFacet> trimmed;
+        trimmed.reserve(facets.size());
+        for (const auto& it : facets) {
+            MeshTrimByPlane::TrimFacet(it, _base, _normal, trimmed);
+        }
+        facets.swap(trimmed);
+    }
+}
+
+Base::BoundBox3f MeshStreamPipeline::Run(StreamReader& reader, StreamWriterSTL* writer)
+{
+    Base::BoundBox3f box;
+    _numFacets = 0;
+
+    // for ASCII files the number of facets is not known in advance
+    Base::SequencerLauncher seq("Processing mesh...", std::max<std::size_t>(reader.CountFacets(), 1));
+
+    std::vector<MeshGeomFacet> facets;
+    std::size_t numRead = 0;
+    while (reader.ReadBlock(facets)) {
+        numRead += facets.size();
+        Process(facets);
+
+        for (const auto& it : facets) {
+            box.Add(it.GetBoundBox());
+        }
+        if (writer) {
+            writer->WriteBlock(facets);
+        }
+        if (_preview) {
+            _preview->AddFacets(facets);
+        }
+
+        _numFacets += facets.size();
+        seq.setProgress(std::min(numRead, seq.numberOfSteps()));
+        seq.next(true);  // allow one to cancel
+    }
+
+    if (writer) {
+        writer->Finish();
+    }
+
+    return box;
+}
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Matrix.h>
+
+#include "Elements.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+class StreamReader;
+class StreamWriterSTL;
+
+/**
+ * The MeshStreamPreview class builds a coarse mesh out of a stream of facets by
+ * vertex clustering. The bounding box is split into cells and all vertices inside
+ * a cell are replaced by their average. Facets whose vertices end up in less than
+ * three different cells are dropped.
+ * The memory consumption depends on the resolution and not on the number of facets.
+ */
+class MeshExport MeshStreamPreview
+{
+public:
+    /**
+     * \param box The bounding box of all facets that will be added.
+     * \param resolution The number of cells along the longest side of the box.
+     */
+    MeshStreamPreview(const Base::BoundBox3f& box, unsigned long resolution);
+
+    /** Adds a block of facets. */
+    void AddFacets(const std::vector<MeshGeomFacet>& facets);
+    /** Returns the number of facets the preview mesh will have. */
+    std::size_t CountFacets() const;
+    /** Moves the preview mesh into the kernel. */
+    void Finish(MeshKernel& kernel);
+
+private:
+    PointIndex GetCluster(const Base::Vector3f& pnt);
+    void RemoveDuplicatedFacets();
+
+private:
+    Base::BoundBox3f _box;
+    unsigned long _ulCtGridsX;
+    unsigned long _ulCtGridsY;
+    unsigned long _ulCtGridsZ;
+    float _fGridLenX;
+    float _fGridLenY;
+    float _fGridLenZ;
+    std::unordered_map<std::uint64_t, PointIndex> _cells;
+    std::vector<Base::Vector3d> _sums;
+    std::vector<unsigned long> _counts;
+    std::vector<MeshFacet> _facets;
+};
+
+/**
+ * The MeshStreamPipeline class applies a sequence of operations on a stream of facets
+ * without loading the whole mesh into memory.
+ * The facets are first transformed, then trimmed by the plane and afterwards passed to
+ * the writer and the preview.
+ *
+ * As the preview needs the bounding box in advance a typical usage looks like:
+ * \code
+ * MeshStreamPipeline pipeline;
+ * pipeline.SetTransform(mat);
+ * Base::BoundBox3f box = pipeline.Run(reader, nullptr);
+ * reader.Rewind();
+ * MeshStreamPreview preview(box, 256);
+ * pipeline.SetPreview(&preview);
+ * pipeline.Run(reader, &writer);
+ * \endcode
+ */
+class MeshExport MeshStreamPipeline
+{
+public:
+    MeshStreamPipeline();
+
+    /** Sets the transformation applied to all facets. */
+    void SetTransform(const Base::Matrix4D& mat);
+    /** Only the part of the facets below the plane is kept, see MeshTrimByPlane. */
+    void SetTrimPlane(const Base::Vector3f& base, const Base::Vector3f& normal);
+    /** The preview must exist as long as the pipeline is running. */
+    void SetPreview(MeshStreamPreview* preview);
+    /** Sets the number of threads to process a block of facets. */
+    void SetThreads(int threads);
+    /**
+     * Reads all facets from \a reader, applies the operations and writes the result
+     * to \a writer if it's not null.
+     * \return the bounding box of the resulting facets.
+     */
+    Base::BoundBox3f Run(StreamReader& reader, StreamWriterSTL* writer);
+    /** Returns the number of resulting facets of the last run. */
+    std::size_t CountFacets() const;
+
+private:
+    void Process(std::vector<MeshGeomFacet>& facets) const;
+
+private:
+    Base::Matrix4D _transform;
+    Base::Vector3f _base;
+    Base::Vector3f _normal;
+    MeshStreamPreview* _preview = nullptr;
+    std::size_t _numFacets = 0;
+    int _threads;
+    bool _applyTransform = false;
+    bool _trim = false;
+};
+
+}  // namespace MeshCore
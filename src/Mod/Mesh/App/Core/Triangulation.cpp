@@ -22,6 +22,8 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 #include <queue>
@@ -763,11 +765,21 @@ bool DelaunayTriangulator::Triangulate()
         delete[] aiIndex;
     }
 
+    // Delaunay2 returns the triangles in the order of their addresses in memory. Start each
+    // triangle with its lowest index and sort them to get the same result in every run.
+    std::vector<std::array<int, 3>> tria(numFaces);
+    for (std::size_t i = 0; i < numFaces; i++) {
+        std::array<int, 3>& tri = tria[i];
+        std::copy(&aiTVertex[3 * i], &aiTVertex[3 * i + 3], tri.begin());
+        std::rotate(tri.begin(), std::min_element(tri.begin(), tri.end()), tri.end());
+    }
+    std::sort(tria.begin(), tria.end());
+
     MeshGeomFacet triangle;
     MeshFacet facet;
     for (std::size_t i = 0; i < numFaces; i++) {
         for (std::size_t j = 0; j < 3; j++) {
-            auto index = static_cast<size_t>(aiTVertex[3 * i + j]);
+            auto index = static_cast<size_t>(tria[i][j]);
             facet._aulPoints[j] = static_cast<PointIndex>(index);
             triangle._aclPoints[j].x = static_cast<float>(akVertex[index].X());
             triangle._aclPoints[j].y = static_cast<float>(akVertex[index].Y());
@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <array>
 
 
 #include "Grid.h"
@@ -88,7 +89,7 @@ void MeshTrimByPlane::CreateOneFacet(
     unsigned short shift,
     const MeshGeomFacet& facet,
     std::vector<MeshGeomFacet>& trimmedFacets
-) const
+)
 {
     unsigned short nul = shift % 3;
     unsigned short one = (shift + 1) % 3;
@@ -118,7 +119,7 @@ void MeshTrimByPlane::CreateTwoFacet(
     unsigned short shift,
     const MeshGeomFacet& facet,
     std::vector<MeshGeomFacet>& trimmedFacets
-) const
+)
 {
     unsigned short nul = shift % 3;
     unsigned short one = (shift + 1) % 3;
@@ -156,30 +157,70 @@ void MeshTrimByPlane::TrimFacets(
 {
     trimmedFacets.reserve(2 * trimFacets.size());
     for (FacetIndex index : trimFacets) {
-        MeshGeomFacet facet = myMesh.GetFacet(index);
-        float dist1 = facet._aclPoints[0].DistanceToPlane(base, normal);
-        float dist2 = facet._aclPoints[1].DistanceToPlane(base, normal);
-        float dist3 = facet._aclPoints[2].DistanceToPlane(base, normal);
-
-        // only one point below
-        if (dist1 < 0.0F && dist2 > 0.0F && dist3 > 0.0F) {
-            CreateOneFacet(base, normal, 0, facet, trimmedFacets);
-        }
-        else if (dist1 > 0.0F && dist2 < 0.0F && dist3 > 0.0F) {
-            CreateOneFacet(base, normal, 1, facet, trimmedFacets);
-        }
-        else if (dist1 > 0.0F && dist2 > 0.0F && dist3 < 0.0F) {
-            CreateOneFacet(base, normal, 2, facet, trimmedFacets);
-        }
-        // two points below
-        else if (dist1 < 0.0F && dist2 < 0.0F && dist3 > 0.0F) {
-            CreateTwoFacet(base, normal, 0, facet, trimmedFacets);
-        }
-        else if (dist1 > 0.0F && dist2 < 0.0F && dist3 < 0.0F) {
-            CreateTwoFacet(base, normal, 1, facet, trimmedFacets);
+        TrimFacet(myMesh.GetFacet(index), base, normal, trimmedFacets);
+    }
+}
+
+void MeshTrimByPlane::TrimFacet(
+    const MeshGeomFacet& facet,
+    const Base::Vector3f& base,
+    const Base::Vector3f& normal,
+    std::vector<MeshGeomFacet>& trimmedFacets
+)
+{
+    // Classify the points with a tolerance so that a point lying on the plane neither
+    // counts as below nor as above. Otherwise the facet would be dropped completely.
+    const float eps = MeshDefinitions::_fMinPointDistanceD1;
+    std::array<int, 3> side {};
+    int numBelow = 0;
+    int numAbove = 0;
+    for (int i = 0; i < 3; i++) {
+        float dist = facet._aclPoints[i].DistanceToPlane(base, normal);
+        if (dist < -eps) {
+            side[i] = -1;
+            numBelow++;
         }
-        else if (dist1 < 0.0F && dist2 > 0.0F && dist3 < 0.0F) {
-            CreateTwoFacet(base, normal, 2, facet, trimmedFacets);
+        else if (dist > eps) {
+            side[i] = 1;
+            numAbove++;
         }
     }
+
+    // nothing above the plane: keep the whole facet
+    if (numAbove == 0) {
+        trimmedFacets.push_back(facet);
+        return;
+    }
+    // nothing below the plane: drop it
+    if (numBelow == 0) {
+        return;
+    }
+
+    auto indexOf = [&side](int value) {
+        auto it = std::find(side.begin(), side.end(), value);
+        return static_cast<unsigned short>(it - side.begin());
+    };
+    unsigned short below = indexOf(-1);
+    unsigned short above = indexOf(1);
+
+    // one point on the plane: only the edge between the other two points is split
+    if (numBelow == 1 && numAbove == 1) {
+        MeshGeomEdge edge;
+        edge._aclPoints[0] = facet._aclPoints[below];
+        edge._aclPoints[1] = facet._aclPoints[above];
+        Base::Vector3f pnt;
+        edge.IntersectWithPlane(base, normal, pnt);
+
+        MeshGeomFacet create = facet;
+        create._aclPoints[above] = pnt;
+        trimmedFacets.push_back(create);
+    }
+    // only one point below
+    else if (numBelow == 1) {
+        CreateOneFacet(base, normal, below, facet, trimmedFacets);
+    }
+    // two points below
+    else {
+        CreateTwoFacet(base, normal, (above + 1U) % 3U, facet, trimmedFacets);
+    }
 }
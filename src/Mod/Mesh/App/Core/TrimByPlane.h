@@ -63,21 +63,35 @@ public:
         std::vector<MeshGeomFacet>& trimmedFacets
     );
 
+    /**
+     * Trims a single facet and appends the part below the plane to \a trimmedFacets.
+     * Points closer to the plane than MeshDefinitions::_fMinPointDistanceD1 count as lying
+     * on the plane, so a facet touching the plane is kept or split but not lost.
+     * This doesn't require a mesh kernel and can be used for facets that are processed
+     * blockwise.
+     */
+    static void TrimFacet(
+        const MeshGeomFacet& facet,
+        const Base::Vector3f& base,
+        const Base::Vector3f& normal,
+        std::vector<MeshGeomFacet>& trimmedFacets
+    );
+
 private:
-    void CreateOneFacet(
+    static void CreateOneFacet(
         const Base::Vector3f& base,
         const Base::Vector3f& normal,
         unsigned short shift,
         const MeshGeomFacet& facet,
         std::vector<MeshGeomFacet>& trimmedFacets
-    ) const;
-    void CreateTwoFacet(
+    );
+    static void CreateTwoFacet(
         const Base::Vector3f& base,
         const Base::Vector3f& normal,
         unsigned short shift,
         const MeshGeomFacet& facet,
         std::vector<MeshGeomFacet>& trimmedFacets
-    ) const;
+    );
 
 private:
     MeshKernel& myMesh;
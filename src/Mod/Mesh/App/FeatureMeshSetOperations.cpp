@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 
+#include "Core/ExactSetOperations.h"
 #include "Core/Iterator.h"
 #include "Core/SetOperations.h"
 
@@ -34,12 +35,15 @@ using namespace std;
 
 PROPERTY_SOURCE(Mesh::SetOperations, Mesh::Feature)
 
+const char* SetOperations::AlgorithmEnums[] = {"Classic", "Exact", nullptr};
 
 SetOperations::SetOperations()
 {
     ADD_PROPERTY(Source1, (nullptr));
     ADD_PROPERTY(Source2, (nullptr));
     ADD_PROPERTY(OperationType, ("union"));
+    ADD_PROPERTY(Algorithm, (0L));
+    Algorithm.setEnums(AlgorithmEnums);
 }
 
 short SetOperations::mustExecute() const
@@ -54,6 +58,9 @@ short SetOperations::mustExecute() const
         if (OperationType.isTouched()) {
             return 1;
         }
+        if (Algorithm.isTouched()) {
+            return 1;
+        }
     }
 
     return 0;
@@ -94,14 +101,25 @@ App::DocumentObjectExecReturn* SetOperations::execute()
             );
         }
 
-        MeshCore::SetOperations setOp(
-            meshKernel1.getKernel(),
-            meshKernel2.getKernel(),
-            pcKernel->getKernel(),
-            type,
-            1.0e-5F
-        );
-        setOp.Do();
+        if (Algorithm.getValue() == 1) {
+            MeshCore::ExactSetOperations setOp(
+                meshKernel1.getKernel(),
+                meshKernel2.getKernel(),
+                pcKernel->getKernel(),
+                type
+            );
+            setOp.Do();
+        }
+        else {
+            MeshCore::SetOperations setOp(
+                meshKernel1.getKernel(),
+                meshKernel2.getKernel(),
+                pcKernel->getKernel(),
+                type,
+                1.0e-5F
+            );
+            setOp.Do();
+        }
         Mesh.setValuePtr(pcKernel.release());
     }
     else {
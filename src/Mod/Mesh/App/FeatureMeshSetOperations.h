@@ -47,6 +47,8 @@ public:
     App::PropertyLink Source1;
     App::PropertyLink Source2;
     App::PropertyString OperationType;
+    /// Classic uses the tolerance based algorithm, Exact the one with exact predicates
+    App::PropertyEnumeration Algorithm;
 
     /** @name methods override Feature */
     //@{
@@ -54,6 +56,9 @@ public:
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
     //@}
+
+private:
+    static const char* AlgorithmEnums[];
 };
 
 }  // namespace Mesh
@@ -23,8 +23,13 @@
  ***************************************************************************/
 
 
+#include <App/Application.h>
 #include <App/Document.h>
+#include <Base/Console.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
 
+#include "Core/Streaming.h"
 #include "Importer.h"
 #include "MeshFeature.h"
 
@@ -43,6 +48,7 @@ void Importer::load(const std::string& fileName)
 
     if (mesh.load(fileName.c_str(), &mat)) {
         Base::FileInfo file(fileName.c_str());
+        std::unique_ptr<MeshObject> preview = createPreview(fileName, mesh);
         unsigned long segmct = mesh.countSegments();
         if (segmct > 1) {
             createMeshFromSegments(file.fileNamePure(), mat, mesh);
@@ -66,9 +72,77 @@ void Importer::load(const std::string& fileName)
             Feature* feature = createMesh(file.fileNamePure(), mesh);
             feature->purgeTouched();
         }
+
+        if (preview) {
+            addPreview(file.fileNamePure(), *preview);
+        }
     }
 }
 
+std::unique_ptr<MeshObject> Importer::createPreview(
+    const std::string& fileName,
+    const MeshObject& mesh
+)
+{
+    // For files above this size in MB a coarse preview mesh is created in addition to
+    // the full mesh because displaying the full mesh may be too slow. Zero disables it.
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Mesh"
+    );
+    long limit = hGrp->GetInt("StreamingImportSize", 0);
+    if (limit <= 0) {
+        return {};
+    }
+
+    Base::FileInfo file(fileName.c_str());
+    Base::ifstream str(file, std::ios::in | std::ios::binary);
+    str.seekg(0, std::ios::end);
+    std::streamoff size = str.tellg();
+    if (!str || size < std::streamoff(limit) * 1024 * 1024) {
+        return {};
+    }
+
+    // pass the facets blockwise to avoid a copy of the whole mesh
+    const MeshCore::MeshKernel& kernel = mesh.getKernel();
+    unsigned long resolution = hGrp->GetUnsigned("StreamingPreviewResolution", 512);
+    MeshCore::MeshStreamPreview preview(kernel.GetBoundBox(), resolution);
+    const std::size_t blockSize = 65536;
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    facets.reserve(blockSize);
+    for (std::size_t index = 0; index < kernel.CountFacets(); index++) {
+        facets.push_back(kernel.GetFacet(index));
+        if (facets.size() == blockSize) {
+            preview.AddFacets(facets);
+            facets.clear();
+        }
+    }
+    preview.AddFacets(facets);
+
+    MeshCore::MeshKernel coarse;
+    preview.Finish(coarse);
+    Base::Console().log(
+        "%s: created a preview with %lu of %lu facets\n",
+        file.fileName().c_str(),
+        static_cast<unsigned long>(coarse.CountFacets()),
+        static_cast<unsigned long>(kernel.CountFacets())
+    );
+
+    return std::make_unique<MeshObject>(coarse);
+}
+
+void Importer::addPreview(const std::string& name, MeshObject& preview)
+{
+    // the full meshes are kept but hidden, only the preview is shown
+    for (Feature* feature : features) {
+        feature->Visibility.setValue(false);
+        feature->purgeTouched();
+    }
+
+    Feature* feature = createMesh(name + "_Preview", preview);
+    feature->Label.setValue(name + " (Preview)");
+    feature->purgeTouched();
+}
+
 void Importer::addVertexColors(Feature* feature, const std::vector<Base::Color>& colors)
 {
     addColors(feature, "VertexColors", colors);
@@ -127,5 +201,6 @@ Feature* Importer::createMesh(const std::string& name, MeshObject& mesh)
     Mesh::Feature* pcFeature = document->addObject<Mesh::Feature>(name.c_str());
     pcFeature->Label.setValue(name);
     pcFeature->Mesh.swapMesh(mesh);
+    features.push_back(pcFeature);
     return pcFeature;
 }
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -49,6 +50,8 @@ public:
     void load(const std::string& fileName);
 
 private:
+    std::unique_ptr<MeshObject> createPreview(const std::string& fileName, const MeshObject& mesh);
+    void addPreview(const std::string& name, MeshObject& preview);
     void addVertexColors(Feature*, const std::vector<Base::Color>&);
     void addFaceColors(Feature*, const std::vector<Base::Color>&);
     void addColors(Feature*, const std::string& property, const std::vector<Base::Color>&);
@@ -57,6 +60,7 @@ private:
 
 private:
     App::Document* document;
+    std::vector<Feature*> features;
 };
 
 }  // namespace Mesh
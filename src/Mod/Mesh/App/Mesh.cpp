@@ -26,6 +26,7 @@
 #include <sstream>
 
 
+#include <App/Application.h>
 #include <Base/Builder3D.h>
 #include <Base/Console.h>
 #include <Base/Converter.h>
@@ -1097,15 +1098,28 @@ void MeshObject::smooth(int iterations, float d_max)
     _kernel.Smooth(iterations, d_max);
 }
 
+namespace
+{
+bool isConcurrentDecimation()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Mesh"
+    );
+    return hGrp->GetBool("ConcurrentDecimation", false);
+}
+}  // namespace
+
 void MeshObject::decimate(float fTolerance, float fReduction)
 {
     MeshCore::MeshSimplify dm(this->_kernel);
+    dm.setConcurrent(isConcurrentDecimation());
     dm.simplify(fTolerance, fReduction);
 }
 
 void MeshObject::decimate(int targetSize)
 {
     MeshCore::MeshSimplify dm(this->_kernel);
+    dm.setConcurrent(isConcurrentDecimation());
     dm.simplify(targetSize);
 }
 
@@ -37,13 +37,13 @@ MeshTexture::MeshTexture(const Mesh::MeshObject& mesh, const MeshCore::Material&
     if (material.binding == MeshCore::MeshIO::PER_VERTEX
         && material.diffuseColor.size() == countPointsRefMesh) {
         binding = MeshCore::MeshIO::PER_VERTEX;
-        kdTree = std::make_unique<MeshCore::MeshKDTree>(mesh.getKernel().GetPoints());
+        kdTree = std::make_unique<MeshCore::MeshStaticKDTree>(mesh.getKernel().GetPoints());
     }
     else if (
         material.binding == MeshCore::MeshIO::PER_FACE && material.diffuseColor.size() == countFacets
     ) {
         binding = MeshCore::MeshIO::PER_FACE;
-        kdTree = std::make_unique<MeshCore::MeshKDTree>(mesh.getKernel().GetPoints());
+        kdTree = std::make_unique<MeshCore::MeshStaticKDTree>(mesh.getKernel().GetPoints());
         refPnt2Fac = std::make_unique<MeshCore::MeshRefPointToFacets>(mesh.getKernel());
     }
 }
@@ -100,9 +100,9 @@ void MeshTexture::apply(
         const MeshCore::MeshFacetArray& facets = mesh.getKernel().GetFacets();
 
         if (binding == MeshCore::MeshIO::PER_VERTEX) {
+            std::vector<PointIndex> found = findIndices(points, max_dist);
             diffuseColor.reserve(points.size());
-            for (size_t index = 0; index < points.size(); index++) {
-                PointIndex pos = findIndex(points[index], max_dist);
+            for (PointIndex pos : found) {
                 if (pos < countPointsRefMesh) {
                     diffuseColor.push_back(textureColor[pos]);
                 }
@@ -119,9 +119,9 @@ void MeshTexture::apply(
         else if (binding == MeshCore::MeshIO::PER_FACE) {
             // the values of the map give the point indices of the original mesh
             std::vector<PointIndex> pointMap;
+            std::vector<PointIndex> found = findIndices(points, max_dist);
             pointMap.reserve(points.size());
-            for (size_t index = 0; index < points.size(); index++) {
-                PointIndex pos = findIndex(points[index], max_dist);
+            for (PointIndex pos : found) {
                 if (pos < countPointsRefMesh) {
                     pointMap.push_back(pos);
                 }
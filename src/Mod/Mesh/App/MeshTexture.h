@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 
 #include "Core/Algorithm.h"
@@ -90,21 +91,20 @@ private:
         float max_dist,
         MeshCore::Material& material
     );
-    PointIndex findIndex(const Base::Vector3f& p, float max_dist) const
+    std::vector<PointIndex> findIndices(const MeshCore::MeshPointArray& points, float max_dist) const
     {
-        if (max_dist < 0.0F) {
-            return kdTree->FindExact(p);
-        }
-
-        Base::Vector3f n;
-        float dist {};
-        return kdTree->FindNearest(p, max_dist, n, dist);
+        // a negative distance means to search for exact matches only
+        std::vector<Base::Vector3f> queries(points.begin(), points.end());
+        std::vector<PointIndex> indices;
+        std::vector<float> dists;
+        kdTree->FindNearest(queries, 1, std::max(max_dist, 0.0F), indices, dists);
+        return indices;
     }
 
 private:
     const MeshCore::Material& materialRefMesh;
     unsigned long countPointsRefMesh;
-    std::unique_ptr<MeshCore::MeshKDTree> kdTree;
+    std::unique_ptr<MeshCore::MeshStaticKDTree> kdTree;
     std::unique_ptr<MeshCore::MeshRefPointToFacets> refPnt2Fac;
     MeshCore::MeshIO::Binding binding = MeshCore::MeshIO::OVERALL;
 };
@@ -24,7 +24,6 @@
 
 #include <algorithm>
 
-#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
 #include <Standard_Version.hxx>
 #include <TopoDS_Shape.hxx>
@@ -33,6 +32,7 @@
 #include <Base/Tools.h>
 #include <Mod/Mesh/App/Mesh.h>
 #include <Mod/Part/App/BRepMesh.h>
+#include <Mod/Part/App/TessellationCache.h>
 #include <Mod/Part/App/TopoShape.h>
 
 #include "Mesher.h"
@@ -228,7 +228,7 @@ Mesh::MeshObject* Mesher::createStandard() const
 {
     if (!shape.IsNull()) {
         BRepTools::Clean(shape);
-        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection);
+        Part::TessellationCache::instance().mesh(shape, deflection, angularDeflection, relative);
     }
 
     std::vector<Part::TopoShape::Domain> domains;
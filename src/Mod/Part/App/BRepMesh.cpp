@@ -23,6 +23,11 @@
 
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 
 
@@ -33,207 +38,355 @@ using namespace Part;
 
 namespace
 {
-struct MeshVertex
+constexpr std::size_t NoCorner = std::numeric_limits<std::size_t>::max();
+
+// Splits [0, count) into blocks and processes them with the OCC thread pool
+template<typename Func>
+void parallelBlocks(std::size_t count, std::size_t blockSize, Func&& func)
+{
+    const std::size_t numBlocks = (count + blockSize - 1) / blockSize;
+    OSD_Parallel::For(0, int(numBlocks), [&](int block) {
+        std::size_t begin = std::size_t(block) * blockSize;
+        std::size_t end = std::min(begin + blockSize, count);
+        func(begin, end);
+    });
+}
+
+template<typename Func>
+void parallelDomains(std::size_t count, Func&& func)
+{
+    OSD_Parallel::For(0, int(count), [&](int index) {
+        func(std::size_t(index));
+    });
+}
+
+/**
+ * Welds the vertices of the triangulated face domains of a shape.
+ *
+ * All domain points are stored in a spatial hash grid whose cell size is at least the
+ * tolerance. Every point then looks for the point that is used first by the facets among
+ * all points within the tolerance in its own and in the adjacent cells. Following these
+ * links gives the representative of each point. Finally, the facets are re-indexed and the
+ * points are numbered by their first use, i.e. the result doesn't depend on the number of
+ * threads and equals the result of inserting the vertices one after another.
+ */
+class VertexWelder
 {
-    Base::Vector3d p;
-    std::size_t i = 0;
+public:
+    using Facet = BRepMesh::Facet;
+    using Domain = BRepMesh::Domain;
 
-    explicit MeshVertex(const Base::Vector3d& p)
-        : p(p)
+    VertexWelder(const std::vector<Domain>& domains, double tolerance)
+        : domains {domains}
+        , tolerance {tolerance}
     {}
 
-    Base::Vector3d toPoint() const
+    void weld(
+        std::vector<Base::Vector3d>& points,
+        std::vector<Facet>& faces,
+        std::vector<std::size_t>& domainSizes
+    )
     {
-        return p;
+        collectPoints();
+        buildGrid();
+        findRepresentatives();
+        createMesh(points, faces, domainSizes);
     }
 
-    bool operator<(const MeshVertex& v) const
+private:
+    static constexpr std::size_t BlockSize = 4096;
+
+    using Cell = std::array<std::int64_t, 3>;
+
+    void collectPoints()
     {
-        if (p.x != v.p.x) {
-            return p.x < v.p.x;
+        const std::size_t numDomains = domains.size();
+        pointOffset.assign(numDomains + 1, 0);
+        cornerOffset.assign(numDomains + 1, 0);
+        for (std::size_t d = 0; d < numDomains; d++) {
+            pointOffset[d + 1] = pointOffset[d] + domains[d].points.size();
+            cornerOffset[d + 1] = cornerOffset[d] + 3 * domains[d].facets.size();
         }
-        if (p.y != v.p.y) {
-            return p.y < v.p.y;
+
+        // Every point gets the position of the first facet corner that refers to it. As
+        // facets only refer to points of their own domain this can be done per domain.
+        allPoints.resize(pointOffset.back());
+        firstCorner.assign(pointOffset.back(), NoCorner);
+        parallelDomains(numDomains, [this](std::size_t d) {
+            const Domain& domain = domains[d];
+            std::copy(
+                domain.points.begin(),
+                domain.points.end(),
+                allPoints.begin() + std::ptrdiff_t(pointOffset[d])
+            );
+
+            std::size_t corner = cornerOffset[d];
+            for (const Facet& facet : domain.facets) {
+                for (uint32_t index : {facet.I1, facet.I2, facet.I3}) {
+                    std::size_t& first = firstCorner[pointOffset[d] + index];
+                    if (first == NoCorner) {
+                        first = corner;
+                    }
+                    corner++;
+                }
+            }
+        });
+    }
+
+    void buildGrid()
+    {
+        // The cell size must not be smaller than the tolerance so that only the adjacent
+        // cells must be checked. For large coordinates it's increased to keep the cell
+        // indexes in range.
+        double maxCoord = 0.0;
+        std::size_t numUsed = 0;
+        for (std::size_t i = 0; i < allPoints.size(); i++) {
+            if (firstCorner[i] != NoCorner) {
+                const Base::Vector3d& pnt = allPoints[i];
+                maxCoord = std::max({maxCoord, std::fabs(pnt.x), std::fabs(pnt.y), std::fabs(pnt.z)}
+                );
+                numUsed++;
+            }
         }
-        if (p.z != v.p.z) {
-            return p.z < v.p.z;
+
+        cellSize = std::max(tolerance, std::ldexp(maxCoord, -40));
+        if (cellSize <= 0.0) {
+            cellSize = 1.0;
         }
 
-        // points are equal
-        return false;
-    }
-};
+        std::size_t numBuckets = 1;
+        while (numBuckets < 2 * numUsed) {
+            numBuckets <<= 1;
+        }
+        bucketMask = numBuckets - 1;
+
+        // counting sort of the used points into the buckets
+        std::vector<std::size_t> bucketOfPoint(allPoints.size());
+        parallelBlocks(allPoints.size(), BlockSize, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                if (firstCorner[i] != NoCorner) {
+                    bucketOfPoint[i] = bucketOf(cellOf(allPoints[i]));
+                }
+            }
+        });
 
-class MergeVertex
-{
-public:
-    using Facet = BRepMesh::Facet;
+        bucketStart.assign(numBuckets + 1, 0);
+        for (std::size_t i = 0; i < allPoints.size(); i++) {
+            if (firstCorner[i] != NoCorner) {
+                bucketStart[bucketOfPoint[i] + 1]++;
+            }
+        }
+        for (std::size_t b = 0; b < numBuckets; b++) {
+            bucketStart[b + 1] += bucketStart[b];
+        }
 
-    MergeVertex(std::vector<Base::Vector3d> points, std::vector<Facet> faces, double tolerance)
-        : points {std::move(points)}
-        , faces {std::move(faces)}
-        , tolerance {tolerance}
-    {
-        setDefaultMap();
-        check();
+        bucketEntries.resize(numUsed);
+        std::vector<std::size_t> fill(bucketStart.begin(), bucketStart.end() - 1);
+        for (std::size_t i = 0; i < allPoints.size(); i++) {
+            if (firstCorner[i] != NoCorner) {
+                bucketEntries[fill[bucketOfPoint[i]]++] = i;
+            }
+        }
     }
 
-    bool hasDuplicatedPoints() const
+    void findRepresentatives()
     {
-        return duplicatedPoints > 0;
+        // link every point to the first used point within the tolerance
+        std::vector<std::size_t> link(allPoints.size());
+        parallelBlocks(allPoints.size(), BlockSize, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                link[i] = firstCorner[i] != NoCorner ? findFirstNeighbour(i) : i;
+            }
+        });
+
+        // a linked point may itself be linked to a point that is used even earlier
+        representative.resize(allPoints.size());
+        parallelBlocks(allPoints.size(), BlockSize, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                std::size_t rep = link[i];
+                while (link[rep] != rep) {
+                    rep = link[rep];
+                }
+                representative[i] = rep;
+            }
+        });
     }
 
-    void mergeDuplicatedPoints()
+    std::size_t findFirstNeighbour(std::size_t index) const
     {
-        if (!hasDuplicatedPoints()) {
-            return;
+        const Base::Vector3d& pnt = allPoints[index];
+        const Cell cell = cellOf(pnt);
+
+        std::size_t first = index;
+        for (std::int64_t dx = -1; dx <= 1; dx++) {
+            for (std::int64_t dy = -1; dy <= 1; dy++) {
+                for (std::int64_t dz = -1; dz <= 1; dz++) {
+                    std::size_t bucket = bucketOf({cell[0] + dx, cell[1] + dy, cell[2] + dz});
+                    for (std::size_t k = bucketStart[bucket]; k < bucketStart[bucket + 1]; k++) {
+                        std::size_t other = bucketEntries[k];
+                        if (firstCorner[other] < firstCorner[first]
+                            && isEqual(pnt, allPoints[other])) {
+                            first = other;
+                        }
+                    }
+                }
+            }
         }
 
-        redirectPointIndex();
-        auto degreeMap = getPointDegrees();
-        decrementPointIndex(degreeMap);
-        removeUnusedPoints(degreeMap);
-        reset();
+        return first;
     }
 
-    std::vector<Base::Vector3d> getPoints() const
+    bool isEqual(const Base::Vector3d& p1, const Base::Vector3d& p2) const
     {
-        return points;
+        return std::fabs(p1.x - p2.x) <= tolerance && std::fabs(p1.y - p2.y) <= tolerance
+            && std::fabs(p1.z - p2.z) <= tolerance;
     }
 
-    std::vector<Facet> getFacets() const
+    Cell cellOf(const Base::Vector3d& pnt) const
     {
-        return faces;
+        return {
+            std::int64_t(std::floor(pnt.x / cellSize)),
+            std::int64_t(std::floor(pnt.y / cellSize)),
+            std::int64_t(std::floor(pnt.z / cellSize))
+        };
     }
 
-private:
-    void setDefaultMap()
+    std::size_t bucketOf(const Cell& cell) const
     {
-        // by default map point index to itself
-        mapPointIndex.resize(points.size());
-        std::generate(mapPointIndex.begin(), mapPointIndex.end(), Base::iotaGen<std::size_t>(0));
+        std::size_t seed = 0;
+        Base::hash_combine(seed, cell[0]);
+        Base::hash_combine(seed, cell[1]);
+        Base::hash_combine(seed, cell[2]);
+        return seed & bucketMask;
     }
 
-    void reset()
+    bool isDegenerated(std::size_t d, const Facet& facet) const
     {
-        mapPointIndex.clear();
-        duplicatedPoints = 0;
+        std::size_t offset = pointOffset[d];
+        std::size_t p1 = representative[offset + facet.I1];
+        std::size_t p2 = representative[offset + facet.I2];
+        std::size_t p3 = representative[offset + facet.I3];
+        return p1 == p2 || p2 == p3 || p3 == p1;
     }
 
-    void check()
+    void createMesh(
+        std::vector<Base::Vector3d>& points,
+        std::vector<Facet>& faces,
+        std::vector<std::size_t>& domainSizes
+    )
     {
-        using VertexIterator = std::vector<Base::Vector3d>::const_iterator;
-
-        double tol3d = tolerance;
-        auto vertexLess = [tol3d](const VertexIterator& v1, const VertexIterator& v2) {
-            if (fabs(v1->x - v2->x) >= tol3d) {
-                return v1->x < v2->x;
-            }
-            if (fabs(v1->y - v2->y) >= tol3d) {
-                return v1->y < v2->y;
-            }
-            if (fabs(v1->z - v2->z) >= tol3d) {
-                return v1->z < v2->z;
-            }
-            return false;  // points are considered to be equal
-        };
-        auto vertexEqual = [&](const VertexIterator& v1, const VertexIterator& v2) {
-            if (vertexLess(v1, v2)) {
-                return false;
-            }
-            if (vertexLess(v2, v1)) {
-                return false;
-            }
-            return true;
-        };
+        const std::size_t numDomains = domains.size();
 
-        std::vector<VertexIterator> vertices;
-        vertices.reserve(points.size());
-        for (auto it = points.cbegin(); it != points.cend(); ++it) {
-            vertices.push_back(it);
+        // Get the first corner of a valid facet that refers to each representative. Because a
+        // representative can be shared by several domains an atomic minimum is needed.
+        std::vector<std::atomic<std::size_t>> firstUse(allPoints.size());
+        for (auto& it : firstUse) {
+            it.store(NoCorner, std::memory_order_relaxed);
         }
 
-        std::sort(vertices.begin(), vertices.end(), vertexLess);
-
-        auto next = vertices.begin();
-        while (next != vertices.end()) {
-            next = std::adjacent_find(next, vertices.end(), vertexEqual);
-            if (next != vertices.end()) {
-                auto first = next;
-                std::size_t first_index = *first - points.begin();
-                ++next;
-                while (next != vertices.end() && vertexEqual(*first, *next)) {
-                    std::size_t next_index = *next - points.begin();
-                    mapPointIndex[next_index] = first_index;
-                    ++duplicatedPoints;
-                    ++next;
+        domainSizes.assign(numDomains, 0);
+        parallelDomains(numDomains, [&](std::size_t d) {
+            const Domain& domain = domains[d];
+            std::size_t corner = cornerOffset[d];
+            std::size_t numFacets = 0;
+            for (const Facet& facet : domain.facets) {
+                if (isDegenerated(d, facet)) {
+                    corner += 3;
+                    continue;
                 }
-            }
-        }
-    }
-
-    void redirectPointIndex()
-    {
-        for (auto& face : faces) {
-            face.I1 = int(mapPointIndex[face.I1]);
-            face.I2 = int(mapPointIndex[face.I2]);
-            face.I3 = int(mapPointIndex[face.I3]);
-        }
-    }
 
-    std::vector<std::size_t> getPointDegrees() const
-    {
-        std::vector<std::size_t> degreeMap;
-        degreeMap.resize(points.size());
-        for (const auto& face : faces) {
-            degreeMap[face.I1]++;
-            degreeMap[face.I2]++;
-            degreeMap[face.I3]++;
+                numFacets++;
+                for (uint32_t index : {facet.I1, facet.I2, facet.I3}) {
+                    std::size_t rep = representative[pointOffset[d] + index];
+                    std::atomic<std::size_t>& first = firstUse[rep];
+                    std::size_t value = first.load(std::memory_order_relaxed);
+                    while (corner < value && !first.compare_exchange_weak(value, corner)) {
+                    }
+                    corner++;
+                }
+            }
+            domainSizes[d] = numFacets;
+        });
+
+        // number the points of each domain that are used there for the first time
+        std::vector<std::size_t> numNewPoints(numDomains + 1, 0);
+        parallelDomains(numDomains, [&](std::size_t d) {
+            numNewPoints[d + 1] = countNewPoints(d, firstUse);
+        });
+
+        std::vector<std::size_t> facetOffset(numDomains + 1, 0);
+        for (std::size_t d = 0; d < numDomains; d++) {
+            numNewPoints[d + 1] += numNewPoints[d];
+            facetOffset[d + 1] = facetOffset[d] + domainSizes[d];
         }
 
-        return degreeMap;
-    }
-
-    void decrementPointIndex(const std::vector<std::size_t>& degreeMap)
-    {
-        std::vector<std::size_t> decrements;
-        decrements.resize(points.size());
-
-        std::size_t decr = 0;
-        for (std::size_t pos = 0; pos < points.size(); pos++) {
-            decrements[pos] = decr;
-            if (degreeMap[pos] == 0) {
-                decr++;
+        std::vector<uint32_t> pointIndex(allPoints.size());
+        std::vector<Base::Vector3d> meshPoints(numNewPoints.back());
+        parallelDomains(numDomains, [&](std::size_t d) {
+            std::size_t next = numNewPoints[d];
+            std::size_t corner = cornerOffset[d];
+            for (const Facet& facet : domains[d].facets) {
+                for (uint32_t index : {facet.I1, facet.I2, facet.I3}) {
+                    std::size_t rep = representative[pointOffset[d] + index];
+                    if (firstUse[rep].load(std::memory_order_relaxed) == corner) {
+                        pointIndex[rep] = uint32_t(next);
+                        meshPoints[next] = allPoints[rep];
+                        next++;
+                    }
+                    corner++;
+                }
             }
-        }
+        });
+
+        std::vector<Facet> meshFacets(facetOffset.back());
+        parallelDomains(numDomains, [&](std::size_t d) {
+            std::size_t offset = pointOffset[d];
+            std::size_t next = facetOffset[d];
+            for (const Facet& facet : domains[d].facets) {
+                if (!isDegenerated(d, facet)) {
+                    Facet& face = meshFacets[next++];
+                    face.I1 = pointIndex[representative[offset + facet.I1]];
+                    face.I2 = pointIndex[representative[offset + facet.I2]];
+                    face.I3 = pointIndex[representative[offset + facet.I3]];
+                }
+            }
+        });
 
-        for (auto& face : faces) {
-            face.I1 -= int(decrements[face.I1]);
-            face.I2 -= int(decrements[face.I2]);
-            face.I3 -= int(decrements[face.I3]);
-        }
+        points.swap(meshPoints);
+        faces.swap(meshFacets);
     }
 
-    void removeUnusedPoints(const std::vector<std::size_t>& degreeMap)
+    std::size_t countNewPoints(
+        std::size_t d,
+        const std::vector<std::atomic<std::size_t>>& firstUse
+    ) const
     {
-        // remove unreferenced points
-        std::vector<Base::Vector3d> new_points;
-        new_points.reserve(points.size() - duplicatedPoints);
-        for (std::size_t pos = 0; pos < points.size(); ++pos) {
-            if (degreeMap[pos] > 0) {
-                new_points.push_back(points[pos]);
+        std::size_t count = 0;
+        std::size_t corner = cornerOffset[d];
+        for (const Facet& facet : domains[d].facets) {
+            for (uint32_t index : {facet.I1, facet.I2, facet.I3}) {
+                std::size_t rep = representative[pointOffset[d] + index];
+                if (firstUse[rep].load(std::memory_order_relaxed) == corner) {
+                    count++;
+                }
+                corner++;
             }
         }
-
-        points.swap(new_points);
+        return count;
     }
 
 private:
-    std::vector<Base::Vector3d> points;
-    std::vector<Facet> faces;
-    double tolerance = 0.0;
-    std::size_t duplicatedPoints = 0;
-    std::vector<std::size_t> mapPointIndex;
+    const std::vector<Domain>& domains;
+    double tolerance;
+    double cellSize = 1.0;
+    std::size_t bucketMask = 0;
+    std::vector<std::size_t> pointOffset;
+    std::vector<std::size_t> cornerOffset;
+    std::vector<Base::Vector3d> allPoints;
+    std::vector<std::size_t> firstCorner;
+    std::vector<std::size_t> bucketStart;
+    std::vector<std::size_t> bucketEntries;
+    std::vector<std::size_t> representative;
 };
 
 }  // namespace
@@ -244,57 +397,8 @@ void BRepMesh::getFacesFromDomains(
     std::vector<Facet>& faces
 )
 {
-    std::size_t numFaces = 0;
-    for (const auto& it : domains) {
-        numFaces += it.facets.size();
-    }
-    faces.reserve(numFaces);
-
-    std::set<MeshVertex> vertices;
-    auto addVertex = [&vertices](const Base::Vector3d& pnt, uint32_t& pointIndex) {
-        MeshVertex vertex(pnt);
-        vertex.i = vertices.size();
-        auto it = vertices.insert(vertex);
-        pointIndex = it.first->i;
-    };
-
-    for (const auto& domain : domains) {
-        std::size_t numDomainFaces = 0;
-        for (const Facet& df : domain.facets) {
-            Facet face;
-
-            // 1st vertex
-            addVertex(domain.points[df.I1], face.I1);
-
-            // 2nd vertex
-            addVertex(domain.points[df.I2], face.I2);
-
-            // 3rd vertex
-            addVertex(domain.points[df.I3], face.I3);
-
-            // make sure that we don't insert invalid facets
-            if (face.I1 != face.I2 && face.I2 != face.I3 && face.I3 != face.I1) {
-                faces.push_back(face);
-                numDomainFaces++;
-            }
-        }
-
-        domainSizes.push_back(numDomainFaces);
-    }
-
-    std::vector<Base::Vector3d> meshPoints;
-    meshPoints.resize(vertices.size());
-    for (const auto& vertex : vertices) {
-        meshPoints[vertex.i] = vertex.toPoint();
-    }
-    points.swap(meshPoints);
-
-    MergeVertex merge(points, faces, Precision::Confusion());
-    if (merge.hasDuplicatedPoints()) {
-        merge.mergeDuplicatedPoints();
-        points = merge.getPoints();
-        faces = merge.getFacets();
-    }
+    VertexWelder welder(domains, Precision::Confusion());
+    welder.weld(points, faces, domainSizes);
 }
 
 std::vector<BRepMesh::Segment> BRepMesh::createSegments() const
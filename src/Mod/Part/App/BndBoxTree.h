@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry.hpp>
+
+#include <Bnd_Box.hxx>
+#include <gp_Pnt.hxx>
+
+namespace Part
+{
+
+/**
+ * BndBoxTree is an R-tree of bounding boxes identified by an integer. It finds the boxes that
+ * may overlap a box or contain a point without testing all of them. Void boxes are never found.
+ */
+class BndBoxTree
+{
+public:
+    BndBoxTree() = default;
+
+    /// Loads all boxes at once, the id of a box is its index
+    explicit BndBoxTree(const std::vector<Bnd_Box>& boxes)
+    {
+        std::vector<Value> values;
+        values.reserve(boxes.size());
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            if (!boxes[i].IsVoid()) {
+                values.emplace_back(toBox(boxes[i]), static_cast<int>(i));
+            }
+        }
+        tree = Tree(values);
+    }
+
+    void insert(const Bnd_Box& box, int id)
+    {
+        if (!box.IsVoid()) {
+            tree.insert(Value(toBox(box), id));
+        }
+    }
+
+    /// Returns the ids of the boxes that overlap \a box in ascending order
+    std::vector<int> query(const Bnd_Box& box) const
+    {
+        if (box.IsVoid()) {
+            return {};
+        }
+        return collect(boost::geometry::index::intersects(toBox(box)));
+    }
+
+    /// Returns the ids of the boxes that contain \a point in ascending order
+    std::vector<int> query(const gp_Pnt& point) const
+    {
+        return collect(boost::geometry::index::intersects(Point(point.X(), point.Y(), point.Z())));
+    }
+
+private:
+    using Point = boost::geometry::model::point<double, 3, boost::geometry::cs::cartesian>;
+    using Box = boost::geometry::model::box<Point>;
+    using Value = std::pair<Box, int>;
+    using Tree = boost::geometry::index::rtree<Value, boost::geometry::index::linear<16>>;
+
+    static Box toBox(const Bnd_Box& box)
+    {
+        double xmin {}, ymin {}, zmin {}, xmax {}, ymax {}, zmax {};
+        box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        return {Point(xmin, ymin, zmin), Point(xmax, ymax, zmax)};
+    }
+
+    template<class Predicate>
+    std::vector<int> collect(const Predicate& predicate) const
+    {
+        std::vector<int> ids;
+        for (auto it = tree.qbegin(predicate); it != tree.qend(); ++it) {
+            ids.push_back(it->second);
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+
+    Tree tree;
+};
+
+}  // namespace Part
@@ -23,14 +23,21 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <cmath>
+#include <exception>
+#include <memory>
+#include <Bnd_Box.hxx>
 #include <BRepAdaptor_Surface.hxx>
+#include <BRepBndLib.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Section.h>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakeWire.hxx>
 #include <BRepPrimAPI_MakeHalfSpace.hxx>
+#include <gp.hxx>
 #include <gp_Pln.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <ShapeAnalysis_FreeBounds.hxx>
 #include <ShapeFix_Wire.hxx>
@@ -49,6 +56,28 @@
 
 using namespace Part;
 
+namespace
+{
+
+// Returns false if the box lies completely on one side of the plane a*x + b*y + c*z = d
+bool boxIntersectsPlane(const Bnd_Box& box, double a, double b, double c, double d)
+{
+    double len = std::sqrt(a * a + b * b + c * c);
+    if (box.IsVoid() || box.IsOpen() || len < gp::Resolution()) {
+        return true;
+    }
+
+    double xmin {}, ymin {}, zmin {}, xmax {}, ymax {}, zmax {};
+    box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    double center = (a * (xmin + xmax) + b * (ymin + ymax) + c * (zmin + zmax)) / 2.0;
+    double extent = (std::abs(a) * (xmax - xmin) + std::abs(b) * (ymax - ymin)
+                     + std::abs(c) * (zmax - zmin))
+        / 2.0;
+    return std::abs(center - d) <= extent + len * Precision::Confusion();
+}
+
+}  // namespace
+
 CrossSection::CrossSection(double a, double b, double c, const TopoDS_Shape& s)
     : a(a)
     , b(b)
@@ -75,6 +104,27 @@ std::list<TopoDS_Wire> CrossSection::slice(double d) const
     return removeDuplicates(wires);
 }
 
+std::vector<std::list<TopoDS_Wire>> CrossSection::slices(const std::vector<double>& d) const
+{
+    std::vector<std::list<TopoDS_Wire>> wires(d.size());
+    std::vector<std::exception_ptr> errors(d.size());
+    OSD_Parallel::For(0, int(d.size()), [&](int index) {
+        try {
+            wires[index] = slice(d[index]);
+        }
+        catch (...) {
+            errors[index] = std::current_exception();
+        }
+    });
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    return wires;
+}
+
 std::list<TopoDS_Wire> CrossSection::removeDuplicates(const std::list<TopoDS_Wire>& wires) const
 {
     std::list<TopoDS_Wire> wires_reduce;
@@ -240,26 +290,53 @@ TopoCrossSection::TopoCrossSection(double a, double b, double c, const TopoShape
     , op(op ? op : Part::OpCodes::Slice)
 {}
 
-void TopoCrossSection::slice(int idx, double d, std::vector<TopoShape>& wires) const
+struct TopoCrossSection::SliceJob
+{
+    SliceJob(int idx, double d, const TopoShape& shape)
+        : idx(idx)
+        , d(d)
+        , shape(&shape)
+        , solid(shape.getShape().ShapeType() == TopAbs_SOLID)
+    {}
+
+    void release()
+    {
+        mkSolid.reset();
+        mkCut.reset();
+        mkSection.reset();
+    }
+
+    int idx;
+    double d;
+    const TopoShape* shape;
+    bool solid;
+    TopoDS_Face face;
+    std::unique_ptr<BRepPrimAPI_MakeHalfSpace> mkSolid;
+    std::unique_ptr<FCBRepAlgoAPI_Cut> mkCut;
+    std::unique_ptr<FCBRepAlgoAPI_Section> mkSection;
+    std::exception_ptr error;
+};
+
+std::vector<TopoShape> TopoCrossSection::getSlicedShapes() const
 {
     // Fixes: 0001228: Cross section of Torus in Part Workbench fails or give wrong results
     // Fixes: 0001137: Incomplete slices when using Part.slice on a torus
-    bool found = false;
-    for (auto& s : shape.getSubTopoShapes(TopAbs_SOLID)) {
-        sliceSolid(idx, d, s, wires);
-        found = true;
-    }
-    if (!found) {
-        for (auto& s : shape.getSubTopoShapes(TopAbs_SHELL)) {
-            sliceNonSolid(idx, d, s, wires);
-            found = true;
-        }
-        if (!found) {
-            for (auto& s : shape.getSubTopoShapes(TopAbs_FACE)) {
-                sliceNonSolid(idx, d, s, wires);
-            }
+    for (auto type : {TopAbs_SOLID, TopAbs_SHELL}) {
+        auto shapes = shape.getSubTopoShapes(type);
+        if (!shapes.empty()) {
+            return shapes;
         }
     }
+    return shape.getSubTopoShapes(TopAbs_FACE);
+}
+
+void TopoCrossSection::slice(int idx, double d, std::vector<TopoShape>& wires) const
+{
+    for (auto& s : getSlicedShapes()) {
+        SliceJob job(idx, d, s);
+        buildSlice(job);
+        mapSlice(job, wires);
+    }
 }
 
 TopoShape TopoCrossSection::slice(int idx, double d) const
@@ -270,57 +347,113 @@ TopoShape TopoCrossSection::slice(int idx, double d) const
         .makeElementCompound(wires, 0, TopoShape::SingleShapeCompoundCreationPolicy::returnShape);
 }
 
-void TopoCrossSection::sliceNonSolid(
-    int idx,
-    double d,
-    const TopoShape& shape,
+void TopoCrossSection::slices(
+    const std::vector<double>& distances,
     std::vector<TopoShape>& wires
 ) const
 {
-    FCBRepAlgoAPI_Section cs(shape.getShape(), gp_Pln(a, b, c, -d));
-    if (cs.IsDone()) {
-        std::string prefix(op);
-        prefix += Data::indexSuffix(idx);
-        auto res = TopoShape()
-                       .makeElementShape(cs, shape, prefix.c_str())
-                       .makeElementWires()
-                       .getSubTopoShapes(TopAbs_WIRE);
-        wires.insert(wires.end(), res.begin(), res.end());
+    // The sub-shapes and their bounding boxes are shared by all slices. A sub-shape whose
+    // box isn't touched by a plane can't contribute to its section.
+    std::vector<TopoShape> shapes = getSlicedShapes();
+    std::vector<Bnd_Box> boxes(shapes.size());
+    OSD_Parallel::For(0, int(shapes.size()), [&](int index) {
+        try {
+            BRepBndLib::Add(shapes[index].getShape(), boxes[index], Standard_False);
+        }
+        catch (const Standard_Failure&) {
+            boxes[index].SetVoid();
+        }
+    });
+
+    std::vector<SliceJob> jobs;
+    int idx = 0;
+    for (double d : distances) {
+        ++idx;
+        for (std::size_t i = 0; i < shapes.size(); ++i) {
+            if (boxIntersectsPlane(boxes[i], a, b, c, d)) {
+                jobs.emplace_back(idx, d, shapes[i]);
+            }
+        }
+    }
+
+    // The boolean operations are thread-safe but the element maps aren't. So, the
+    // operations of a batch run in parallel and their results are mapped in the order
+    // of the serial version. The batches limit the number of operations kept in memory.
+    const std::size_t batchSize = 4 * std::max(1, OSD_Parallel::NbLogicalProcessors());
+    for (std::size_t first = 0; first < jobs.size(); first += batchSize) {
+        std::size_t last = std::min(jobs.size(), first + batchSize);
+        OSD_Parallel::For(int(first), int(last), [&](int index) {
+            buildSlice(jobs[index]);
+        });
+        for (std::size_t i = first; i < last; ++i) {
+            mapSlice(jobs[i], wires);
+            jobs[i].release();
+        }
     }
 }
 
-void TopoCrossSection::sliceSolid(
-    int idx,
-    double d,
-    const TopoShape& shape,
-    std::vector<TopoShape>& wires
-) const
+void TopoCrossSection::buildSlice(SliceJob& job) const
 {
-    gp_Pln slicePlane(a, b, c, -d);
-    BRepBuilderAPI_MakeFace mkFace(slicePlane);
-    TopoShape face(idx);
-    face.setShape(mkFace.Face());
+    try {
+        gp_Pln slicePlane(a, b, c, -job.d);
+        if (!job.solid) {
+            job.mkSection
+                = std::make_unique<FCBRepAlgoAPI_Section>(job.shape->getShape(), slicePlane);
+            return;
+        }
 
-    // Make sure to choose a point that does not lie on the plane (fixes #0001228)
-    gp_Vec tempVector(a, b, c);
-    tempVector.Normalize();  // just in case.
-    tempVector *= (d + 1.0);
-    gp_Pnt refPoint(0.0, 0.0, 0.0);
-    refPoint.Translate(tempVector);
+        BRepBuilderAPI_MakeFace mkFace(slicePlane);
+        job.face = mkFace.Face();
+
+        // Make sure to choose a point that does not lie on the plane (fixes #0001228)
+        gp_Vec tempVector(a, b, c);
+        tempVector.Normalize();  // just in case.
+        tempVector *= (job.d + 1.0);
+        gp_Pnt refPoint(0.0, 0.0, 0.0);
+        refPoint.Translate(tempVector);
+
+        job.mkSolid = std::make_unique<BRepPrimAPI_MakeHalfSpace>(job.face, refPoint);
+        job.mkCut
+            = std::make_unique<FCBRepAlgoAPI_Cut>(job.shape->getShape(), job.mkSolid->Solid());
+    }
+    catch (...) {
+        job.error = std::current_exception();
+    }
+}
 
-    BRepPrimAPI_MakeHalfSpace mkSolid(TopoDS::Face(face.getShape()), refPoint);
-    TopoShape solid(idx);
+void TopoCrossSection::mapSlice(SliceJob& job, std::vector<TopoShape>& wires) const
+{
+    if (job.error) {
+        std::rethrow_exception(job.error);
+    }
+
+    const TopoShape& shape = *job.shape;
     std::string prefix(op);
-    prefix += Data::indexSuffix(idx);
-    solid.makeElementShape(mkSolid, face, prefix.c_str());
-    FCBRepAlgoAPI_Cut mkCut(shape.getShape(), solid.getShape());
+    prefix += Data::indexSuffix(job.idx);
+
+    if (!job.solid) {
+        if (job.mkSection->IsDone()) {
+            auto res = TopoShape()
+                           .makeElementShape(*job.mkSection, shape, prefix.c_str())
+                           .makeElementWires()
+                           .getSubTopoShapes(TopAbs_WIRE);
+            wires.insert(wires.end(), res.begin(), res.end());
+        }
+        return;
+    }
 
-    if (mkCut.IsDone()) {
+    TopoShape planeFace(job.idx);
+    planeFace.setShape(job.face);
+    TopoShape solid(job.idx);
+    solid.makeElementShape(*job.mkSolid, planeFace, prefix.c_str());
+
+    if (job.mkCut->IsDone()) {
+        gp_Pln slicePlane(a, b, c, -job.d);
         TopoShape res(shape.Tag, shape.Hasher);
         std::vector<TopoShape> shapes;
         shapes.push_back(shape);
         shapes.push_back(solid);
-        res.makeElementShape(mkCut, shapes, prefix.c_str());
+        res.makeElementShape(*job.mkCut, shapes, prefix.c_str());
         for (auto& face : res.getSubTopoShapes(TopAbs_FACE)) {
             BRepAdaptor_Surface adapt(TopoDS::Face(face.getShape()));
             if (adapt.GetType() == GeomAbs_Plane) {
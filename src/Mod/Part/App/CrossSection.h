@@ -25,6 +25,7 @@
 #pragma once
 
 #include <list>
+#include <vector>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <Mod/Part/PartGlobal.h>
 #include "TopoShape.h"
@@ -41,6 +42,8 @@ class PartExport CrossSection
 public:
     CrossSection(double a, double b, double c, const TopoDS_Shape& s);
     std::list<TopoDS_Wire> slice(double d) const;
+    /// Slices the shape at all distances in parallel
+    std::vector<std::list<TopoDS_Wire>> slices(const std::vector<double>& d) const;
 
 private:
     void sliceNonSolid(double d, const TopoDS_Shape&, std::list<TopoDS_Wire>& wires) const;
@@ -61,10 +64,19 @@ public:
     TopoCrossSection(double a, double b, double c, const TopoShape& s, const char* op = 0);
     void slice(int idx, double d, std::vector<TopoShape>& wires) const;
     TopoShape slice(int idx, double d) const;
+    /**
+     * Slices the shape at all \a distances. The boolean operations run in parallel while the
+     * element maps are built in order afterwards, so the result is the same as calling
+     * slice() with the indices 1, 2, ... for each distance.
+     */
+    void slices(const std::vector<double>& distances, std::vector<TopoShape>& wires) const;
 
 private:
-    void sliceNonSolid(int idx, double d, const TopoShape&, std::vector<TopoShape>& wires) const;
-    void sliceSolid(int idx, double d, const TopoShape&, std::vector<TopoShape>& wires) const;
+    struct SliceJob;
+
+    std::vector<TopoShape> getSlicedShapes() const;
+    void buildSlice(SliceJob& job) const;
+    void mapSlice(SliceJob& job, std::vector<TopoShape>& wires) const;
 
 private:
     double a, b, c;
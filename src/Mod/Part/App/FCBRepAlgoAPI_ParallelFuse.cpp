@@ -0,0 +1,357 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+/**
+ * FCBRepAlgoAPI provides a wrapper for various OCCT functions.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <numeric>
+
+#include <Bnd_Box.hxx>
+#include <BRepBndLib.hxx>
+#include <OSD_Parallel.hxx>
+#include <Precision.hxx>
+#include <Standard_ConstructionError.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+
+#include <FCBRepAlgoAPI_ParallelFuse.h>
+#include <FuzzyHelper.h>
+#include <SignalException.h>
+
+namespace
+{
+std::unique_ptr<BRepAlgoAPI_Fuse> makeFuse(const std::vector<TopoDS_Shape>& shapes, double fuzz)
+{
+    TopTools_ListOfShape arguments;
+    TopTools_ListOfShape tools;
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        (i == 0 ? arguments : tools).Append(shapes[i]);
+    }
+    auto fuse = std::make_unique<BRepAlgoAPI_Fuse>();
+    fuse->SetArguments(arguments);
+    fuse->SetTools(tools);
+    if (fuzz > 0.0) {
+        fuse->SetFuzzyValue(fuzz);
+    }
+    fuse->SetRunParallel(Standard_True);
+    fuse->SetNonDestructive(Standard_True);
+    return fuse;
+}
+
+void appendNew(
+    const TopTools_ListOfShape& shapes,
+    TopTools_MapOfShape& added,
+    TopTools_ListOfShape& result
+)
+{
+    for (TopTools_ListOfShape::Iterator it(shapes); it.More(); it.Next()) {
+        if (added.Add(it.Value())) {
+            result.Append(it.Value());
+        }
+    }
+}
+}  // namespace
+
+FCBRepAlgoAPI_ParallelFuse::FCBRepAlgoAPI_ParallelFuse() = default;
+
+FCBRepAlgoAPI_ParallelFuse::~FCBRepAlgoAPI_ParallelFuse() = default;
+
+void FCBRepAlgoAPI_ParallelFuse::SetShapes(const TopTools_ListOfShape& theShapes)
+{
+    myShapes.clear();
+    for (TopTools_ListOfShape::Iterator it(theShapes); it.More(); it.Next()) {
+        myShapes.push_back(it.Value());
+    }
+}
+
+void FCBRepAlgoAPI_ParallelFuse::SetFuzzyValue(double theFuzz)
+{
+    myFuzz = theFuzz;
+}
+
+void FCBRepAlgoAPI_ParallelFuse::setAutoFuzzy()
+{
+    Bnd_Box bounds;
+    for (const auto& shape : myShapes) {
+        BRepBndLib::Add(shape, bounds);
+    }
+    myFuzz = Part::FuzzyHelper::getBooleanFuzzy() * sqrt(bounds.SquareExtent())
+        * Precision::Confusion();
+}
+
+int FCBRepAlgoAPI_ParallelFuse::NbGroups() const
+{
+    return myNbGroups;
+}
+
+std::vector<std::vector<int>> FCBRepAlgoAPI_ParallelFuse::makeGroups() const
+{
+    int count = static_cast<int>(myShapes.size());
+    std::vector<int> parent(count);
+    std::iota(parent.begin(), parent.end(), 0);
+    if (count < MinShapes) {
+        return {parent};
+    }
+
+    std::vector<Bnd_Box> boxes(count);
+    double gap = std::max(myFuzz, 0.0) + Precision::Confusion();
+    OSD_Parallel::For(0, count, [&](int i) {
+        BRepBndLib::Add(myShapes[i], boxes[i]);
+        boxes[i].Enlarge(gap);
+    });
+
+    auto find = [&](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    auto bound = [&](int i, bool upper) {
+        if (boxes[i].IsVoid()) {
+            return std::numeric_limits<double>::max();
+        }
+        double xmin {}, ymin {}, zmin {}, xmax {}, ymax {}, zmax {};
+        boxes[i].Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        return upper ? xmax : xmin;
+    };
+
+    // Sweep along X so that only boxes with overlapping X range are compared
+    std::vector<int> order(parent);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return bound(a, false) < bound(b, false);
+    });
+    for (int k = 0; k < count; ++k) {
+        int i = order[k];
+        if (boxes[i].IsVoid()) {
+            break;
+        }
+        double xmax = bound(i, true);
+        for (int n = k + 1; n < count && bound(order[n], false) <= xmax; ++n) {
+            int j = order[n];
+            if (boxes[i].IsOut(boxes[j])) {
+                continue;
+            }
+            int a = find(i);
+            int b = find(j);
+            if (a != b) {
+                parent[std::max(a, b)] = std::min(a, b);
+            }
+        }
+    }
+
+    // Groups and their shapes keep the order of the input
+    std::vector<std::vector<int>> groups;
+    std::vector<int> groupOfRoot(count, -1);
+    for (int i = 0; i < count; ++i) {
+        int root = find(i);
+        if (groupOfRoot[root] < 0) {
+            groupOfRoot[root] = static_cast<int>(groups.size());
+            groups.emplace_back();
+        }
+        groups[groupOfRoot[root]].push_back(i);
+    }
+    return groups;
+}
+
+#if OCC_VERSION_HEX >= 0x070600
+void FCBRepAlgoAPI_ParallelFuse::Build(const Message_ProgressRange& theRange)
+#else
+void FCBRepAlgoAPI_ParallelFuse::Build()
+#endif
+{
+    Part::SignalException sig;
+    NotDone();
+    myShape.Nullify();
+    myGroupFuses.clear();
+    myFinalFuse.reset();
+    myGroupOfShape.Clear();
+    myNbGroups = 0;
+
+    auto groups = makeGroups();
+    myNbGroups = static_cast<int>(groups.size());
+    std::vector<TopoDS_Shape> results;
+    if (groups.size() == 1) {
+        results = myShapes;
+    }
+    else {
+        results.resize(groups.size());
+        myGroupFuses.resize(groups.size());
+        std::vector<std::exception_ptr> errors(groups.size());
+        OSD_Parallel::For(0, myNbGroups, [&](int i) {
+            try {
+                if (groups[i].size() == 1) {
+                    results[i] = myShapes[groups[i].front()];
+                    return;
+                }
+                std::vector<TopoDS_Shape> shapes;
+                for (int index : groups[i]) {
+                    shapes.push_back(myShapes[index]);
+                }
+                auto fuse = makeFuse(shapes, myFuzz);
+                fuse->Build();
+                if (fuse->IsDone()) {
+                    results[i] = fuse->Shape();
+                }
+                myGroupFuses[i] = std::move(fuse);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+        for (auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        if (std::any_of(results.begin(), results.end(), [](const TopoDS_Shape& shape) {
+                return shape.IsNull();
+            })) {
+            return;
+        }
+
+        for (int i = 0; i < myNbGroups; ++i) {
+            if (!myGroupFuses[i]) {
+                continue;
+            }
+            for (int index : groups[i]) {
+                TopTools_IndexedMapOfShape subShapes;
+                TopExp::MapShapes(myShapes[index], subShapes);
+                for (int j = 1; j <= subShapes.Extent(); ++j) {
+                    myGroupOfShape.Bind(subShapes(j), i);
+                }
+            }
+        }
+    }
+
+#if OCC_VERSION_HEX >= 0x070600
+    if (theRange.UserBreak()) {
+        throw Standard_ConstructionError("User aborted");
+    }
+    myFinalFuse = makeFuse(results, myFuzz);
+    myFinalFuse->Build(theRange);
+#else
+    myFinalFuse = makeFuse(results, myFuzz);
+    myFinalFuse->Build();
+#endif
+    if (myFinalFuse->IsDone()) {
+        myShape = myFinalFuse->Shape();
+        Done();
+    }
+}
+
+void FCBRepAlgoAPI_ParallelFuse::groupImages(const TopoDS_Shape& S, TopTools_ListOfShape& theImages)
+{
+    if (myGroupOfShape.IsBound(S)) {
+        auto& fuse = *myGroupFuses[myGroupOfShape.Find(S)];
+        TopTools_ListOfShape modified(fuse.Modified(S));
+        if (!modified.IsEmpty()) {
+            theImages.Append(modified);
+            return;
+        }
+        if (fuse.IsDeleted(S)) {
+            return;
+        }
+    }
+    theImages.Append(S);
+}
+
+void FCBRepAlgoAPI_ParallelFuse::finalImages(const TopoDS_Shape& S, TopTools_ListOfShape& theImages)
+{
+    TopTools_ListOfShape modified(myFinalFuse->Modified(S));
+    if (!modified.IsEmpty()) {
+        theImages.Append(modified);
+        return;
+    }
+    if (!myFinalFuse->IsDeleted(S)) {
+        theImages.Append(S);
+    }
+}
+
+const TopTools_ListOfShape& FCBRepAlgoAPI_ParallelFuse::Modified(const TopoDS_Shape& S)
+{
+    myGenerated.Clear();
+    if (!myFinalFuse) {
+        return myGenerated;
+    }
+    TopTools_ListOfShape images;
+    groupImages(S, images);
+    TopTools_MapOfShape added;
+    for (TopTools_ListOfShape::Iterator it(images); it.More(); it.Next()) {
+        TopTools_ListOfShape finals;
+        finalImages(it.Value(), finals);
+        appendNew(finals, added, myGenerated);
+    }
+    // Like a single fuse, a shape that is kept as it is isn't modified
+    if (myGenerated.Extent() == 1 && myGenerated.First().IsSame(S)) {
+        myGenerated.Clear();
+    }
+    return myGenerated;
+}
+
+const TopTools_ListOfShape& FCBRepAlgoAPI_ParallelFuse::Generated(const TopoDS_Shape& S)
+{
+    myGenerated.Clear();
+    if (!myFinalFuse) {
+        return myGenerated;
+    }
+    TopTools_MapOfShape added;
+    if (myGroupOfShape.IsBound(S)) {
+        TopTools_ListOfShape generated(myGroupFuses[myGroupOfShape.Find(S)]->Generated(S));
+        for (TopTools_ListOfShape::Iterator it(generated); it.More(); it.Next()) {
+            TopTools_ListOfShape finals;
+            finalImages(it.Value(), finals);
+            appendNew(finals, added, myGenerated);
+        }
+    }
+    TopTools_ListOfShape images;
+    groupImages(S, images);
+    for (TopTools_ListOfShape::Iterator it(images); it.More(); it.Next()) {
+        TopTools_ListOfShape generated(myFinalFuse->Generated(it.Value()));
+        appendNew(generated, added, myGenerated);
+    }
+    return myGenerated;
+}
+
+Standard_Boolean FCBRepAlgoAPI_ParallelFuse::IsDeleted(const TopoDS_Shape& S)
+{
+    if (!myFinalFuse) {
+        return Standard_False;
+    }
+    TopTools_ListOfShape images;
+    groupImages(S, images);
+    for (TopTools_ListOfShape::Iterator it(images); it.More(); it.Next()) {
+        TopTools_ListOfShape finals;
+        finalImages(it.Value(), finals);
+        if (!finals.IsEmpty()) {
+            return Standard_False;
+        }
+    }
+    return Standard_True;
+}
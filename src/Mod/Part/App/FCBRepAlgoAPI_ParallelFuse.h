@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+/**
+ * FCBRepAlgoAPI provides a wrapper for various OCCT functions.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepBuilderAPI_MakeShape.hxx>
+#include <Message_ProgressRange.hxx>
+#include <Standard_Version.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopTools_ListOfShape.hxx>
+
+
+//! Fuses many shapes at once. The shapes are split in groups whose bounding boxes overlap,
+//! the groups are fused concurrently and the results are merged by a final fuse. The history
+//! is the combined history of both steps, so that it can be used like the one of a single fuse.
+class FCBRepAlgoAPI_ParallelFuse: public BRepBuilderAPI_MakeShape
+{
+public:
+    DEFINE_STANDARD_ALLOC
+
+    //! Fewest shapes for which it is worth looking for groups
+    static constexpr int MinShapes = 8;
+
+    Standard_EXPORT FCBRepAlgoAPI_ParallelFuse();
+    Standard_EXPORT ~FCBRepAlgoAPI_ParallelFuse() override;
+
+    //! Sets the shapes to fuse
+    Standard_EXPORT void SetShapes(const TopTools_ListOfShape& theShapes);
+    //! Sets the fuzzy value of all fuses, 0 uses the default of OCCT
+    Standard_EXPORT void SetFuzzyValue(double theFuzz);
+    //! Set fuzzyness based on size, see FCBRepAlgoAPIHelper::setAutoFuzzy()
+    Standard_EXPORT void setAutoFuzzy();
+    //! Returns the number of groups that were fused independently
+    Standard_EXPORT int NbGroups() const;
+
+#if OCC_VERSION_HEX >= 0x070600
+    Standard_EXPORT void Build(const Message_ProgressRange& theRange = Message_ProgressRange())
+        Standard_OVERRIDE;
+#else
+    Standard_EXPORT void Build() Standard_OVERRIDE;
+#endif
+
+    Standard_EXPORT const TopTools_ListOfShape& Modified(const TopoDS_Shape& S) Standard_OVERRIDE;
+    Standard_EXPORT const TopTools_ListOfShape& Generated(const TopoDS_Shape& S) Standard_OVERRIDE;
+    Standard_EXPORT Standard_Boolean IsDeleted(const TopoDS_Shape& S) Standard_OVERRIDE;
+
+private:
+    std::vector<std::vector<int>> makeGroups() const;
+    //! Images of an input sub-shape in the result of its group
+    void groupImages(const TopoDS_Shape& S, TopTools_ListOfShape& theImages);
+    //! Images of a sub-shape of a group result in the final result
+    void finalImages(const TopoDS_Shape& S, TopTools_ListOfShape& theImages);
+
+    std::vector<TopoDS_Shape> myShapes;
+    double myFuzz = 0.0;
+    int myNbGroups = 0;
+    // One fuse per group with more than one shape, null for the other groups
+    std::vector<std::unique_ptr<BRepAlgoAPI_Fuse>> myGroupFuses;
+    std::unique_ptr<BRepAlgoAPI_Fuse> myFinalFuse;
+    // Index of the group fuse of each sub-shape of the input shapes
+    TopTools_DataMapOfShapeInteger myGroupOfShape;
+};
@@ -73,6 +73,7 @@ FCBRepAlgoAPI_Section::FCBRepAlgoAPI_Section(
     }
     setAutoFuzzy();
     SetRunParallel(Standard_True);
+    SetNonDestructive(Standard_True);
     if (PerformNow) {
         Build();
     }
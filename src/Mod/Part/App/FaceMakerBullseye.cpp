@@ -22,6 +22,9 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <exception>
+#include <optional>
+
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepBndLib.hxx>
@@ -31,6 +34,7 @@
 #include <BRepLib_FindSurface.hxx>
 #include <Geom_Plane.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <Standard_Failure.hxx>
 #include <TopoDS.hxx>
@@ -38,6 +42,7 @@
 #include <QtGlobal>
 #include <TopExp.hxx>
 
+#include "BndBoxTree.h"
 #include "FaceMakerBullseye.h"
 #include "FaceMakerCheese.h"
 
@@ -103,17 +108,43 @@ void FaceMakerBullseye::Build_Essence()
         plane = GeomAdaptor_Surface(planeFinder.Surface()).Plane();
     }
 
-    std::vector<WireInfo> wireInfos;
-    for (const auto& w : this->myTopoWires) {
+    // The bounds and directions of the wires don't depend on each other
+    int count = static_cast<int>(this->myTopoWires.size());
+    std::vector<std::optional<WireInfo>> infos(count);
+    std::vector<std::exception_ptr> errors(count);
+    OSD_Parallel::For(0, count, [&](int i) {
+        const auto& w = this->myTopoWires[i];
         Bnd_Box box;
         if (w.isNull()) {
-            continue;
+            return;
+        }
+        try {
+            BRepBndLib::AddOptimal(w.getShape(), box, Standard_False);
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+            return;
         }
-        BRepBndLib::AddOptimal(w.getShape(), box, Standard_False);
         if (box.IsVoid()) {
-            continue;
+            return;
+        }
+        WireInfo info(w, box);
+        try {
+            info.direction = FaceDriller::getWireDirection(plane, TopoDS::Wire(w.getShape()));
+        }
+        catch (const Standard_Failure&) {
+            // computed again, and reported, if the wire is used
+        }
+        infos[i] = info;
+    });
+    std::vector<WireInfo> wireInfos;
+    for (int i = 0; i < count; ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        if (infos[i]) {
+            wireInfos.push_back(*infos[i]);
         }
-        wireInfos.emplace_back(w, box);
     }
 
     // Sort wires by length of diagonal of bounding box.
@@ -122,16 +153,27 @@ void FaceMakerBullseye::Build_Essence()
     for (int i = 0; i < (reuseInnerWire ? 2 : 1); ++i) {
         // add wires one by one to current set of faces.
         std::vector<std::unique_ptr<FaceDriller>> faces;
+        // Bounds of the outer wires of the faces
+        BndBoxTree faceBounds;
         for (auto it = wireInfos.begin(); it != wireInfos.end();) {
 
             // test if this wire is on any of existing faces (if yes, it's a hole;
-            //  if no, it's a beginning of a new face).
+            //  if no, it's a beginning of a new face). Only the faces whose outer
+            //  wire bound contains the tested vertex can be hit.
+            std::vector<int> candidates;
+            if (!faces.empty()) {
+                auto vertex = TopoDS::Vertex(it->wire.getSubShape(TopAbs_VERTEX, 1));
+                Bnd_Box probe;
+                probe.Add(BRep_Tool::Pnt(vertex));
+                probe.Enlarge(BRep_Tool::Tolerance(vertex) + Precision::Confusion());
+                candidates = faceBounds.query(probe);
+            }
             FaceDriller* foundFace = nullptr;
             bool hitted = false;
-            for (auto rit = faces.rbegin(); rit != faces.rend(); ++rit) {
-                switch ((*rit)->hitTest(it->wire)) {
+            for (auto rit = candidates.rbegin(); rit != candidates.rend(); ++rit) {
+                switch (faces[*rit]->hitTest(it->wire)) {
                     case FaceDriller::HitTest::Hit:
-                        foundFace = rit->get();
+                        foundFace = faces[*rit].get();
                         hitted = true;
                         break;
                     case FaceDriller::HitTest::HitOuter:
@@ -153,12 +195,13 @@ void FaceMakerBullseye::Build_Essence()
                     foundFace->addHole(*it, mySourceShapes);
                 }
                 else {
-                    foundFace->addHole(w);
+                    foundFace->addHole(w, it->direction);
                 }
             }
             else {
                 // wire is not on a face. Start a new face.
-                faces.push_back(std::make_unique<FaceDriller>(plane, w));
+                faceBounds.insert(it->bound, static_cast<int>(faces.size()));
+                faces.push_back(std::make_unique<FaceDriller>(plane, w, it->direction));
             }
 
             if (i == 0 && reuseInnerWire && !hitted) {
@@ -180,13 +223,26 @@ void FaceMakerBullseye::Build_Essence()
 }
 
 
-FaceMakerBullseye::FaceDriller::FaceDriller(const gp_Pln& plane, TopoDS_Wire outerWire)
+struct FaceMakerBullseye::FaceDriller::HoleIndex
+{
+    BndBoxTree bounds;
+    std::vector<TopoDS_Face> faces;
+};
+
+FaceMakerBullseye::FaceDriller::FaceDriller(
+    const gp_Pln& plane,
+    TopoDS_Wire outerWire,
+    int direction
+)
 {
     this->myPlane = plane;
     this->myFace = TopoDS_Face();
 
     // Ensure correct orientation of the wire.
-    if (getWireDirection(myPlane, outerWire) < 0) {
+    if (direction == 0) {
+        direction = getWireDirection(myPlane, outerWire);
+    }
+    if (direction < 0) {
         outerWire.Reverse();
     }
 
@@ -197,6 +253,8 @@ FaceMakerBullseye::FaceDriller::FaceDriller(const gp_Pln& plane, TopoDS_Wire out
     this->myTopoFace = TopoShape(this->myFace);
 }
 
+FaceMakerBullseye::FaceDriller::~FaceDriller() = default;
+
 FaceMakerBullseye::FaceDriller::HitTest FaceMakerBullseye::FaceDriller::hitTest(
     const TopoShape& shape
 ) const
@@ -235,6 +293,27 @@ FaceMakerBullseye::FaceDriller::HitTest FaceMakerBullseye::FaceDriller::hitTest(
                 throw Base::ValueError(err);
         }
     }
+    if (hit == HitTest::HitOuter && myHoleIndex && !myJoiner) {
+        // The point is inside the outer wire and the face is that wire with the holes as they
+        // were added, so the point is on the face unless it is in or on one of the holes around it
+        Bnd_Box probe;
+        probe.Add(point);
+        probe.Enlarge(tol + Precision::Confusion());
+        for (int index : myHoleIndex->bounds.query(probe)) {
+            BRepClass_FaceClassifier cl(myHoleIndex->faces[index], gp_Pnt2d(u, v), tol);
+            switch (cl.State()) {
+                case TopAbs_IN:
+                    return hit;
+                case TopAbs_ON:
+                    return HitTest::Hit;
+                case TopAbs_OUT:
+                    break;
+                default:
+                    throw Base::ValueError(err);
+            }
+        }
+        return HitTest::Hit;
+    }
     BRepClass_FaceClassifier cl(myFace, gp_Pnt2d(u, v), tol);
     TopAbs_State ret = cl.State();
     switch (ret) {
@@ -266,11 +345,14 @@ void FaceMakerBullseye::FaceDriller::copyFaceBound(
     topoFace = TopoShape(face);
 }
 
-void FaceMakerBullseye::FaceDriller::addHole(TopoDS_Wire w)
+void FaceMakerBullseye::FaceDriller::addHole(TopoDS_Wire w, int direction)
 {
     // Ensure correct orientation of the wire.
-    if (getWireDirection(myPlane, w) > 0) {  // if wire is CCW..
-        w.Reverse();                         //.. we want CW!
+    if (direction == 0) {
+        direction = getWireDirection(myPlane, w);
+    }
+    if (direction > 0) {  // if wire is CCW..
+        w.Reverse();      //.. we want CW!
     }
 
     if (this->myFaceBound.IsNull()) {
@@ -279,6 +361,17 @@ void FaceMakerBullseye::FaceDriller::addHole(TopoDS_Wire w)
 
     BRep_Builder builder;
     builder.Add(this->myFace, w);
+
+    if (!myHoleIndex) {
+        myHoleIndex = std::make_unique<HoleIndex>();
+    }
+    TopoDS_Face holeFace;
+    builder.MakeFace(holeFace, myHPlane, Precision::Confusion());
+    builder.Add(holeFace, TopoDS::Wire(w.Reversed()));
+    Bnd_Box bound;
+    BRepBndLib::Add(w, bound);
+    myHoleIndex->bounds.insert(bound, static_cast<int>(myHoleIndex->faces.size()));
+    myHoleIndex->faces.push_back(holeFace);
 }
 
 void FaceMakerBullseye::FaceDriller::addHole(const WireInfo& wireInfo, std::vector<TopoShape>& sources)
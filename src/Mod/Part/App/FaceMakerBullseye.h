@@ -78,6 +78,8 @@ protected:
         TopoShape wire;
         Bnd_Box bound;
         double extent;
+        /// see FaceDriller::getWireDirection(), 0 if not known
+        int direction {0};
         WireInfo(const TopoShape& s, const Bnd_Box& b)
             : wire(s)
             , bound(b)
@@ -95,7 +97,9 @@ protected:
     class PartExport FaceDriller
     {
     public:
-        FaceDriller(const gp_Pln& plane, TopoDS_Wire outerWire);
+        /// \a direction of the wire, see getWireDirection(), is computed if it is 0
+        FaceDriller(const gp_Pln& plane, TopoDS_Wire outerWire, int direction = 0);
+        ~FaceDriller();
 
         /// Hit test result
         enum class HitTest
@@ -114,7 +118,7 @@ protected:
          */
         HitTest hitTest(const TopoShape& shape) const;
 
-        void addHole(TopoDS_Wire w);
+        void addHole(TopoDS_Wire w, int direction = 0);
         void addHole(const WireInfo& info, std::vector<TopoShape>& sources);
         void copyFaceBound(TopoDS_Face& f, TopoShape& tf, const TopoShape& source);
 
@@ -141,6 +145,10 @@ protected:
         std::vector<WireInfo> myHoles;
         Handle(Geom_Surface) myHPlane;
         std::unique_ptr<WireJoiner> myJoiner;
+        // Faces of the holes added by addHole(TopoDS_Wire), to classify points against
+        // the holes near them instead of against the whole face
+        struct HoleIndex;
+        std::unique_ptr<HoleIndex> myHoleIndex;
     };
 };
 
@@ -23,15 +23,18 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <exception>
 #include <Bnd_Box.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepAdaptor_Surface.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <BRepBndLib.hxx>
 #include <Geom_Plane.hxx>
 #include <IntTools_FClass2d.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <ShapeAnalysis.hxx>
 #include <ShapeAnalysis_Surface.hxx>
@@ -45,6 +48,7 @@
 #include <QtGlobal>
 
 
+#include "BndBoxTree.h"
 #include "FaceMakerCheese.h"
 
 
@@ -200,33 +204,108 @@ TopoDS_Shape FaceMakerCheese::makeFace(const std::vector<TopoDS_Wire>& w)
         return {};
     }
 
+    int count = static_cast<int>(w.size());
+    std::vector<Bnd_Box> boxes(count);
+    OSD_Parallel::For(0, count, [&](int i) {
+        if (!w[i].IsNull()) {
+            BRepBndLib::Add(w[i], boxes[i]);
+            boxes[i].SetGap(0.0);
+        }
+    });
+
     // FIXME: Need a safe method to sort wire that the outermost one comes last
     //  Currently it's done with the diagonal lengths of the bounding boxes
-    std::vector<TopoDS_Wire> wires = w;
-    std::sort(wires.begin(), wires.end(), Wire_Compare());
-    std::list<TopoDS_Wire> wire_list;
-    wire_list.insert(wire_list.begin(), wires.rbegin(), wires.rend());
-
-    // separate the wires into several independent faces
-    std::list<std::list<TopoDS_Wire>> sep_wire_list;
-    while (!wire_list.empty()) {
-        std::list<TopoDS_Wire> sep_list;
-        TopoDS_Wire wire = wire_list.front();
-        wire_list.pop_front();
-        sep_list.push_back(wire);
-
-        std::list<TopoDS_Wire>::iterator it = wire_list.begin();
-        while (it != wire_list.end()) {
-            if (isInside(wire, *it)) {
-                sep_list.push_back(*it);
-                it = wire_list.erase(it);
-            }
-            else {
-                ++it;
+    std::vector<int> order(count);
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return boxes[a].SquareExtent() > boxes[b].SquareExtent();
+    });
+    std::vector<TopoDS_Wire> wires(count);
+    std::vector<Bnd_Box> sortedBoxes(count);
+    for (int i = 0; i < count; ++i) {
+        wires[i] = w[order[i]];
+        sortedBoxes[i] = boxes[order[i]];
+    }
+
+    // A wire can only be inside a larger wire whose bounding box it overlaps. The candidates
+    // are collected per outer wire, so that its face classifier is built only once.
+    BndBoxTree tree(sortedBoxes);
+    std::vector<std::vector<int>> candidates(count);
+    for (int k = 0; k < count; ++k) {
+        for (int j : tree.query(sortedBoxes[k])) {
+            if (j >= k) {
+                break;
             }
+            candidates[j].push_back(k);
         }
+    }
 
-        sep_wire_list.push_back(sep_list);
+    // Test the candidates of each wire in parallel. The faces are made from copies because
+    // making a face may update the tolerances of the wire, which other tasks are reading.
+    std::vector<std::vector<bool>> inside(count);
+    std::vector<std::exception_ptr> errors(count);
+    OSD_Parallel::For(0, count, [&](int j) {
+        if (candidates[j].empty()) {
+            return;
+        }
+        try {
+            double prec = Precision::Confusion();
+            BRepBuilderAPI_Copy copy(wires[j]);
+            BRepBuilderAPI_MakeFace mkFace(TopoDS::Wire(copy.Shape()));
+            if (!mkFace.IsDone()) {
+                throw Standard_Failure("Failed to create a face from wire in sketch");
+            }
+            TopoDS_Face face = validateFace(mkFace.Face());
+            BRepAdaptor_Surface adapt(face);
+            IntTools_FClass2d class2d(face, prec);
+            Handle(Geom_Surface) surf = new Geom_Plane(adapt.Plane());
+            ShapeAnalysis_Surface as(surf);
+
+            inside[j].resize(candidates[j].size(), false);
+            for (std::size_t n = 0; n < candidates[j].size(); ++n) {
+                TopExp_Explorer xp(wires[candidates[j][n]], TopAbs_VERTEX);
+                if (xp.More()) {
+                    gp_Pnt p = BRep_Tool::Pnt(TopoDS::Vertex(xp.Current()));
+                    gp_Pnt2d uv = as.ValueOfUV(p, prec);
+                    inside[j][n] = class2d.Perform(uv) == TopAbs_IN;
+                }
+            }
+        }
+        catch (...) {
+            errors[j] = std::current_exception();
+        }
+    });
+
+    // separate the wires into several independent faces, each wire goes to the first
+    // outer wire that contains it
+    std::vector<int> owner(count, -1);
+    std::vector<std::list<TopoDS_Wire>> sep_wire_list;
+    std::vector<int> group(count, -1);
+    for (int j = 0; j < count; ++j) {
+        if (owner[j] >= 0) {
+            continue;
+        }
+        group[j] = static_cast<int>(sep_wire_list.size());
+        sep_wire_list.emplace_back(1, wires[j]);
+        for (std::size_t n = 0; n < candidates[j].size(); ++n) {
+            int k = candidates[j][n];
+            if (owner[k] >= 0) {
+                continue;
+            }
+            if (errors[j]) {
+                std::rethrow_exception(errors[j]);
+            }
+            if (inside[j][n]) {
+                owner[k] = j;
+            }
+        }
+    }
+    for (int k = 0; k < count; ++k) {
+        if (owner[k] >= 0) {
+            sep_wire_list[group[owner[k]]].push_back(wires[k]);
+        }
     }
 
     if (sep_wire_list.size() == 1) {
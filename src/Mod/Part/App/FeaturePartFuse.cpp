@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 #include <Mod/Part/App/FCBRepAlgoAPI_Fuse.h>
+#include <Mod/Part/App/FCBRepAlgoAPI_ParallelFuse.h>
 #include <BRepCheck_Analyzer.hxx>
 #include <Standard_Failure.hxx>
 #include <TopoDS_Iterator.hxx>
@@ -133,23 +134,17 @@ App::DocumentObjectExecReturn* MultiFuse::execute()
     if (shapes.size() >= 2) {
         try {
             std::vector<ShapeHistory> history;
-            FCBRepAlgoAPI_Fuse mkFuse;
-            TopTools_ListOfShape shapeArguments, shapeTools;
-            const TopoShape& shape = shapes.front();
-            if (shape.isNull()) {
-                throw Base::RuntimeError("Input shape is null");
-            }
-            shapeArguments.Append(shape.getShape());
-
-            for (auto it2 = shapes.begin() + 1; it2 != shapes.end(); ++it2) {
-                if (it2->isNull()) {
+            // Groups of overlapping shapes are fused concurrently
+            FCBRepAlgoAPI_ParallelFuse mkFuse;
+            TopTools_ListOfShape shapeList;
+            for (const auto& shape : shapes) {
+                if (shape.isNull()) {
                     throw Base::RuntimeError("Input shape is null");
                 }
-                shapeTools.Append(it2->getShape());
+                shapeList.Append(shape.getShape());
             }
 
-            mkFuse.SetArguments(shapeArguments);
-            mkFuse.SetTools(shapeTools);
+            mkFuse.SetShapes(shapeList);
             mkFuse.setAutoFuzzy();
             mkFuse.Build();
 
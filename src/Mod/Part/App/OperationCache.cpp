@@ -0,0 +1,315 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <sstream>
+
+#include <gp_Trsf.hxx>
+#include <Standard_Failure.hxx>
+#include <TopoDS.hxx>
+
+#include <QCryptographicHash>
+
+#include <App/Application.h>
+#include <Base/Console.h>
+
+#include "OperationCache.h"
+#include "ShapeContentHash.h"
+#include "TopoShapeMapper.h"
+
+
+using namespace Part;
+
+namespace
+{
+ParameterGrp::handle getParameter()
+{
+    return App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+}
+
+// Replays a recorded shape history
+class HistoryMapper: public TopoShape::Mapper
+{
+public:
+    void add(MappingStatus status, const TopoDS_Shape& s, const std::vector<TopoDS_Shape>& d)
+    {
+        auto& map = status == MappingStatus::Generated ? generatedShapes : modifiedShapes;
+        map[s] = d;
+    }
+
+    const std::vector<TopoDS_Shape>& generated(const TopoDS_Shape& s) const override
+    {
+        auto it = generatedShapes.find(s);
+        return it != generatedShapes.end() ? it->second : _res;
+    }
+
+    const std::vector<TopoDS_Shape>& modified(const TopoDS_Shape& s) const override
+    {
+        auto it = modifiedShapes.find(s);
+        return it != modifiedShapes.end() ? it->second : _res;
+    }
+
+private:
+    using ShapeMap
+        = std::unordered_map<TopoDS_Shape, std::vector<TopoDS_Shape>, ShapeHasher, ShapeHasher>;
+    ShapeMap generatedShapes;
+    ShapeMap modifiedShapes;
+};
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+struct OperationCache::Result
+{
+    struct Item
+    {
+        // index of the input shape
+        std::size_t source = 0;
+        TopAbs_ShapeEnum type = TopAbs_SHAPE;
+        // index of the sub-shape in the input shape
+        int index = 0;
+        MappingStatus status = MappingStatus::Modified;
+        // sub-shapes of the result
+        std::vector<TopoDS_Shape> shapes;
+    };
+
+    TopoDS_Shape shape;
+    // the input shapes the result was made from, their sub-shapes that went into the result
+    // unchanged are shared with it
+    std::vector<TopoDS_Shape> inputs;
+    std::vector<Item> history;
+};
+
+OperationCache& OperationCache::instance()
+{
+    static OperationCache cache;
+    return cache;
+}
+
+OperationCache::OperationCache()
+{
+    maxEntries = getParameter()->GetUnsigned("OperationCacheSize", 100);
+    enabled = getParameter()->GetBool("OperationCache", false);
+}
+
+OperationCache::~OperationCache() = default;
+
+bool OperationCache::isEnabled() const
+{
+    return enabled;
+}
+
+void OperationCache::setEnabled(bool enable)
+{
+    enabled = enable;
+    if (!enable) {
+        clear();
+    }
+}
+
+std::string OperationCache::makeKey(
+    const char* maker,
+    const std::vector<TopoShape>& shapes,
+    const std::string& params
+) const
+{
+    if (!enabled || !maker) {
+        return {};
+    }
+
+    std::ostringstream str;
+    str.precision(17);
+    str << maker << ';' << params;
+    for (const auto& shape : shapes) {
+        if (shape.isNull()) {
+            return {};
+        }
+        const TopoDS_Shape& s = shape.getShape();
+        std::string hash = ShapeContentHash::compute(s);
+        if (hash.empty()) {
+            return {};
+        }
+        str << ';' << hash << ';' << int(s.Orientation());
+        gp_Trsf trsf = s.Location().Transformation();
+        for (int row = 1; row <= 3; ++row) {
+            for (int col = 1; col <= 4; ++col) {
+                str << ',' << trsf.Value(row, col);
+            }
+        }
+    }
+
+    std::string data = str.str();
+    QCryptographicHash key(QCryptographicHash::Sha1);
+#if QT_VERSION < QT_VERSION_CHECK(6, 3, 0)
+    key.addData(data.c_str(), int(data.size()));
+#else
+    key.addData(QByteArrayView(data.c_str(), qsizetype(data.size())));
+#endif
+    return key.result().toHex().toStdString();
+}
+
+bool OperationCache::restore(
+    const std::string& key,
+    TopoShape& result,
+    const std::vector<TopoShape>& shapes,
+    const char* op,
+    ElementMapPolicy elementMapPolicy
+)
+{
+    if (key.empty()) {
+        return false;
+    }
+
+    ResultPtr cached;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            return false;
+        }
+        recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, it->second.position);
+        cached = it->second.result;
+    }
+
+    if (cached->inputs.size() != shapes.size()) {
+        return false;
+    }
+
+    // The input shapes have the same content as the recorded ones, so their sub-shape indices
+    // and element maps are valid for the recorded shapes, too. The recorded shapes stand in for
+    // the inputs so that sub-shapes that went into the result unchanged are found in it.
+    std::vector<TopoShape> sources;
+    sources.reserve(shapes.size());
+    for (std::size_t source = 0; source < shapes.size(); ++source) {
+        sources.push_back(shapes[source]);
+        sources.back().setShape(cached->inputs[source], false);
+    }
+
+    HistoryMapper mapper;
+    for (const auto& item : cached->history) {
+        if (item.source >= sources.size()) {
+            return false;
+        }
+        TopoDS_Shape element = sources[item.source].findShape(item.type, item.index);
+        if (element.IsNull()) {
+            return false;
+        }
+        mapper.add(item.status, element, item.shapes);
+    }
+
+    result.makeShapeWithElementMap(cached->shape, mapper, sources, op, elementMapPolicy);
+    return true;
+}
+
+void OperationCache::store(
+    const std::string& key,
+    const TopoDS_Shape& shape,
+    const TopoShape::Mapper& mapper,
+    const std::vector<TopoShape>& shapes
+)
+{
+    if (key.empty() || shape.IsNull()) {
+        return;
+    }
+
+    auto result = std::make_shared<Result>();
+    result->shape = shape;
+    for (const auto& input : shapes) {
+        result->inputs.push_back(input.getShape());
+    }
+    try {
+        // Record the history of the same sub-shapes that TopoShape::makeShapeWithElementMap()
+        // queries
+        for (std::size_t source = 0; source < shapes.size(); ++source) {
+            const auto& input = shapes[source];
+            for (auto type : {TopAbs_VERTEX, TopAbs_EDGE, TopAbs_FACE}) {
+                int count = int(input.countSubShapes(type));
+                for (int index = 1; index <= count; ++index) {
+                    TopoDS_Shape element = input.findShape(type, index);
+                    const auto& modified = mapper.modified(element);
+                    if (!modified.empty()) {
+                        result->history.push_back(
+                            {source, type, index, MappingStatus::Modified, modified}
+                        );
+                    }
+                    const auto& generated = mapper.generated(element);
+                    if (!generated.empty()) {
+                        result->history.push_back(
+                            {source, type, index, MappingStatus::Generated, generated}
+                        );
+                    }
+                }
+            }
+        }
+    }
+    catch (const Standard_Failure& e) {
+        Base::Console().log("Operation result not cached: %s\n", e.GetMessageString());
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, it->second.position);
+        it->second.result = result;
+        return;
+    }
+    recentlyUsed.push_front(key);
+    entries.emplace(key, Entry {result, recentlyUsed.begin()});
+    evict();
+}
+
+void OperationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    recentlyUsed.clear();
+}
+
+void OperationCache::setMaxEntries(std::size_t count)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    maxEntries = count;
+    evict();
+}
+
+std::size_t OperationCache::getMaxEntries() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return maxEntries;
+}
+
+std::size_t OperationCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+void OperationCache::evict()
+{
+    while (entries.size() > maxEntries && !recentlyUsed.empty()) {
+        entries.erase(recentlyUsed.back());
+        recentlyUsed.pop_back();
+    }
+}
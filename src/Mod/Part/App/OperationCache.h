@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Mod/Part/PartGlobal.h>
+
+#include "TopoShape.h"
+
+namespace Part
+{
+
+/**
+ * The OperationCache remembers the results of modelling operations, e.g. booleans, fillets
+ * and extrusions, so that repeating an operation on unchanged input shapes doesn't call OCCT.
+ *
+ * Entries are keyed by the operation, its parameters and a hash of the content, placement and
+ * orientation of the input shapes. Next to the result shape the input shapes and the history
+ * of the operation by sub-shape indices of the inputs are recorded. Restoring a result creates
+ * the element map from the recorded inputs, which share the unchanged sub-shapes with the
+ * result, the history and the element maps of the current input shapes, so the names are the
+ * same as if the operation had been performed again.
+ *
+ * The cache is disabled by default.
+ */
+class PartExport OperationCache
+{
+public:
+    static OperationCache& instance();
+
+    bool isEnabled() const;
+    void setEnabled(bool enable);
+
+    /**
+     * Returns the key of the operation \a maker with the input \a shapes and further
+     * parameters \a params. If the cache is disabled or a key can't be computed an empty
+     * string is returned.
+     */
+    std::string makeKey(
+        const char* maker,
+        const std::vector<TopoShape>& shapes,
+        const std::string& params
+    ) const;
+
+    /**
+     * If a result is cached for \a key it's assigned to \a result with an element map
+     * created from \a shapes like TopoShape::makeShapeWithElementMap() does.
+     * Returns true if the result was taken from the cache.
+     */
+    bool restore(
+        const std::string& key,
+        TopoShape& result,
+        const std::vector<TopoShape>& shapes,
+        const char* op,
+        ElementMapPolicy elementMapPolicy = ElementMapPolicy::Propagate
+    );
+
+    /// Stores the result \a shape of an operation on \a shapes with its history given by \a mapper
+    void store(
+        const std::string& key,
+        const TopoDS_Shape& shape,
+        const TopoShape::Mapper& mapper,
+        const std::vector<TopoShape>& shapes
+    );
+
+    /// Removes all entries
+    void clear();
+    /// Sets the maximum number of cached results
+    void setMaxEntries(std::size_t count);
+    std::size_t getMaxEntries() const;
+    std::size_t size() const;
+
+private:
+    OperationCache();
+    ~OperationCache();
+
+    struct Result;
+    using ResultPtr = std::shared_ptr<const Result>;
+
+    void evict();
+
+private:
+    struct Entry
+    {
+        ResultPtr result;
+        std::list<std::string>::iterator position;
+    };
+
+    mutable std::mutex mutex;
+    std::list<std::string> recentlyUsed;
+    std::unordered_map<std::string, Entry> entries;
+    std::size_t maxEntries;
+    std::atomic<bool> enabled;
+};
+
+}  // namespace Part
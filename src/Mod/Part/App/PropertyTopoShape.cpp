@@ -49,6 +49,7 @@
 #include "PartFeature.h"
 #include "PartPyCXX.h"
 #include "PropertyTopoShape.h"
+#include "ShapePayload.h"
 #include "TopoShapePy.h"
 #include "PartFeature.h"
 
@@ -365,6 +366,7 @@ void PropertyPartShape::beforeSave() const
 void PropertyPartShape::Save(Base::Writer& writer) const
 {
     // See SaveDocFile(), RestoreDocFile()
+    _SaveElementMap = false;
     writer.Stream() << writer.ind() << "<Part";
     auto owner = dynamic_cast<App::DocumentObject*>(getContainer());
     if (owner && !_Shape.isNull() && _Shape.getElementMapSize() > 0 && !_Shape.Hasher.isNull()) {
@@ -388,7 +390,12 @@ void PropertyPartShape::Save(Base::Writer& writer) const
 
     bool binary = writer.getMode("BinaryBrep");
     bool toXML = writer.isForceXML();
-    if (!toXML) {
+    _SaveNative = !toXML && ShapePayload::isEnabled();
+    if (_SaveNative) {
+        writer.Stream() << " file=\"" << writer.addFile(getFileName(".fcs").c_str(), this)
+                        << "\"/>\n";
+    }
+    else if (!toXML) {
         writer.Stream() << " file=\""
                         << writer.addFile(getFileName(binary ? ".bin" : ".brp").c_str(), this)
                         << "\"/>\n";
@@ -413,7 +420,12 @@ void PropertyPartShape::Save(Base::Writer& writer) const
         }
         _Shape.Hasher->Save(writer);
     }
-    if (version.size()) {
+    if (version.size() && _SaveNative) {
+        // The element map is stored in the shape file, see SaveDocFile()
+        _SaveElementMap = true;
+        writer.Stream() << writer.ind() << "<ElementMap/>\n";
+    }
+    else if (version.size()) {
         if (!toXML) {
             _Shape.setPersistenceFileName(getFileName(".Map").c_str());
         }
@@ -534,6 +546,11 @@ void PropertyPartShape::Restore(Base::XMLReader& reader)
 
 void PropertyPartShape::afterRestore()
 {
+    if (!_PendingElementMap.empty()) {
+        std::istringstream stream(std::move(_PendingElementMap));
+        _PendingElementMap.clear();
+        _Shape.restoreElementMap(stream);
+    }
     if (_Shape.isRestoreFailed()) {
         // this cause GeoFeature::updateElementReference() to call
         // PropertyLinkBase::updateElementReferences() with reverse = true, in
@@ -717,7 +734,10 @@ void PropertyPartShape::SaveDocFile(Base::Writer& writer) const
         return;
     }
     TopoDS_Shape myShape = _Shape.getShape();
-    if (writer.getMode("BinaryBrep")) {
+    if (_SaveNative) {
+        ShapePayload::write(writer.Stream(), _Shape, _SaveElementMap);
+    }
+    else if (writer.getMode("BinaryBrep")) {
         TopoShape shape;
         shape.setShape(myShape);
         shape.exportBinary(writer.Stream());
@@ -756,7 +776,10 @@ void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
 
     std::string ver = _Ver;
 
-    if (brep.hasExtension("bin")) {
+    if (brep.hasExtension("fcs")) {
+        shape.setShape(ShapePayload::read(reader, _PendingElementMap), false);
+    }
+    else if (brep.hasExtension("bin")) {
         shape.importBinary(reader);
     }
     else {
@@ -122,6 +122,10 @@ private:
     std::string _Ver;
     mutable int _HasherIndex = 0;
     mutable bool _SaveHasher = false;
+    mutable bool _SaveNative = false;
+    mutable bool _SaveElementMap = false;
+    // Element map read from a native shape file, restored once the string hasher is restored
+    std::string _PendingElementMap;
 };
 
 struct PartExport ShapeHistory
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <array>
+#include <list>
+#include <mutex>
+#include <ostream>
+
+#include <BinTools_ShapeSet.hxx>
+#include <Standard_Version.hxx>
+
+#include <QCryptographicHash>
+
+#include "ShapeContentHash.h"
+#include "TopoShapeCache.h"
+
+
+using namespace Part;
+
+namespace
+{
+// Number of shapes whose content hash is remembered
+constexpr std::size_t MaxIdentities = 64;
+
+// Passes everything written to the stream to the hash function
+class HashBuffer: public std::streambuf
+{
+public:
+    explicit HashBuffer(QCryptographicHash& hash)
+        : hash {hash}
+    {
+        setp(buffer.data(), buffer.data() + buffer.size());
+    }
+
+protected:
+    int_type overflow(int_type ch) override
+    {
+        flush();
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    int sync() override
+    {
+        flush();
+        return 0;
+    }
+
+private:
+    void flush()
+    {
+        auto size = pptr() - pbase();
+        if (size > 0) {
+#if QT_VERSION < QT_VERSION_CHECK(6, 3, 0)
+            hash.addData(pbase(), int(size));
+#else
+            hash.addData(QByteArrayView(pbase(), size));
+#endif
+        }
+        setp(buffer.data(), buffer.data() + buffer.size());
+    }
+
+private:
+    QCryptographicHash& hash;
+    std::array<char, 65536> buffer {};
+};
+
+struct Identity
+{
+    // keeps the TShape alive so that its address can't be reused
+    TopoDS_Shape shape;
+    // fingerprint of the shape when the hash was computed
+    std::size_t stamp;
+    std::string hash;
+};
+
+std::mutex identityMutex;
+std::list<Identity> identities;
+}  // namespace
+
+std::string ShapeContentHash::compute(const TopoDS_Shape& shape)
+{
+#if OCC_VERSION_HEX >= 0x070600
+    // A shape can be changed in place, e.g. when its tolerances are fixed, so a remembered hash
+    // is only used if the much cheaper fingerprint of the shape is unchanged
+    TopoDS_Shape located = shape.Located(TopLoc_Location());
+    std::size_t stamp = TopoShapeCache::getStamp(located);
+    {
+        std::lock_guard<std::mutex> lock(identityMutex);
+        for (auto it = identities.begin(); it != identities.end(); ++it) {
+            if (it->shape.TShape() == shape.TShape()) {
+                if (it->stamp == stamp) {
+                    identities.splice(identities.begin(), identities, it);
+                    return it->hash;
+                }
+                identities.erase(it);
+                break;
+            }
+        }
+    }
+
+    // The binary B-Rep format without triangulations is a stable description of the
+    // geometry and topology of the shape that doesn't depend on the session.
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    HashBuffer buffer(hash);
+    std::ostream str(&buffer);
+    BinTools_ShapeSet shapeSet;
+    shapeSet.SetWithTriangles(Standard_False);
+    shapeSet.SetFormatNb(3);
+    shapeSet.Add(located);
+    shapeSet.Write(str);
+    str.flush();
+    std::string result = hash.result().toHex().toStdString();
+
+    std::lock_guard<std::mutex> lock(identityMutex);
+    identities.push_front({shape, stamp, result});
+    if (identities.size() > MaxIdentities) {
+        identities.pop_back();
+    }
+    return result;
+#else
+    (void)shape;
+    return {};
+#endif
+}
+
+void ShapeContentHash::clear()
+{
+    std::lock_guard<std::mutex> lock(identityMutex);
+    identities.clear();
+}
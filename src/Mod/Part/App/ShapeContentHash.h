@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/Part/PartGlobal.h>
+
+namespace Part
+{
+
+/**
+ * ShapeContentHash computes a hash of the geometry and topology of a shape that doesn't depend
+ * on the session, i.e. a recomputed or reloaded shape that is unchanged gets the same hash.
+ * The hashes of the recently used shapes are remembered as long as the shapes aren't changed
+ * in place.
+ */
+class PartExport ShapeContentHash
+{
+public:
+    /// Returns the SHA1 of \a shape without its location, orientation and triangulations, or an
+    /// empty string if the OCCT version doesn't support it
+    static std::string compute(const TopoDS_Shape& shape);
+    /// Forgets the remembered hashes
+    static void clear();
+};
+
+}  // namespace Part
@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <sstream>
+#include <unordered_set>
+#include <vector>
+
+#include <BRep_Builder.hxx>
+#include <OSD_Parallel.hxx>
+#include <TopExp.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <App/Application.h>
+#include <Base/Exception.h>
+#include <Base/Stream.h>
+
+#include "ShapePayload.h"
+#include "TopoShape.h"
+
+
+using namespace Part;
+
+namespace
+{
+constexpr uint32_t PayloadMagic = 0x50534346;  // "FCSP"
+constexpr uint32_t PayloadVersion = 1;
+
+enum PayloadFlags : uint32_t
+{
+    SplitCompound = 1,
+};
+
+// Size of the pieces a block is copied in, so that a corrupted size fails on the missing data
+// instead of allocating it upfront
+constexpr std::size_t BlockPiece = 1 << 24;
+
+void writeBlock(Base::OutputStream& str, const std::string& data)
+{
+    str << static_cast<uint64_t>(data.size());
+    for (std::size_t pos = 0; pos < data.size();) {
+        auto size = std::min<std::size_t>(data.size() - pos, BlockPiece);
+        str.write(data.data() + pos, static_cast<int>(size));
+        pos += size;
+    }
+}
+
+std::string readBlock(Base::InputStream& str)
+{
+    uint64_t size = 0;
+    str >> size;
+    std::string data;
+    while (str && data.size() < size) {
+        auto pos = data.size();
+        auto piece = std::min<uint64_t>(size - pos, BlockPiece);
+        data.resize(pos + piece);
+        str.read(&data[pos], static_cast<int>(piece));
+    }
+    if (!str) {
+        throw Base::RuntimeError("Truncated shape payload");
+    }
+    return data;
+}
+
+// Returns the children of a compound if no two of them share a sub-shape, so that each child
+// can be stored on its own without losing the sharing of the topology
+std::vector<TopoDS_Shape> independentChildren(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull() || shape.ShapeType() != TopAbs_COMPOUND
+        || !shape.Location().IsIdentity()) {
+        return {};
+    }
+    std::vector<TopoDS_Shape> children;
+    for (TopoDS_Iterator it(shape, Standard_False, Standard_False); it.More(); it.Next()) {
+        children.push_back(it.Value());
+    }
+    if (children.size() < 2) {
+        return {};
+    }
+    std::unordered_set<const TopoDS_TShape*> seen;
+    for (const auto& child : children) {
+        TopTools_IndexedMapOfShape map;
+        TopExp::MapShapes(child, map);
+        std::unordered_set<const TopoDS_TShape*> own;
+        for (int i = 1; i <= map.Extent(); ++i) {
+            own.insert(map(i).TShape().get());
+        }
+        for (auto tshape : own) {
+            if (!seen.insert(tshape).second) {
+                return {};
+            }
+        }
+    }
+    return children;
+}
+
+// Runs job(i) for every index in parallel and rethrows the first failure
+template<class Job>
+void runParallel(int count, Job job)
+{
+    std::vector<std::exception_ptr> errors(count);
+    OSD_Parallel::For(0, count, [&](int i) {
+        try {
+            job(i);
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+std::string encode(const TopoDS_Shape& shape)
+{
+    std::ostringstream str(std::ios::out | std::ios::binary);
+    TopoShape(shape).exportBinary(str);
+    return str.str();
+}
+
+TopoDS_Shape decode(const std::string& data)
+{
+    std::istringstream str(data, std::ios::in | std::ios::binary);
+    TopoShape shape;
+    shape.importBinary(str);
+    return shape.getShape();
+}
+}  // namespace
+
+bool ShapePayload::isEnabled()
+{
+    return App::GetApplication()
+        .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
+        ->GetBool("NativeShapeFormat", false);
+}
+
+void ShapePayload::write(std::ostream& stream, const TopoShape& shape, bool withElementMap)
+{
+    Base::OutputStream str(stream);
+    str << PayloadMagic << PayloadVersion;
+
+    const TopoDS_Shape& topoShape = shape.getShape();
+    auto children = independentChildren(topoShape);
+    if (children.empty()) {
+        str << static_cast<uint32_t>(0);
+        writeBlock(str, encode(topoShape));
+    }
+    else {
+        std::vector<std::string> chunks(children.size());
+        runParallel(static_cast<int>(children.size()), [&](int i) {
+            chunks[i] = encode(children[i]);
+        });
+        str << static_cast<uint32_t>(SplitCompound)
+            << static_cast<int32_t>(topoShape.Orientation())
+            << static_cast<uint64_t>(chunks.size());
+        for (const auto& chunk : chunks) {
+            writeBlock(str, chunk);
+        }
+    }
+
+    std::string elementMap;
+    if (withElementMap && shape.getElementMapSize() > 0) {
+        std::ostringstream mapStream;
+        shape.saveElementMap(mapStream);
+        elementMap = mapStream.str();
+    }
+    writeBlock(str, elementMap);
+}
+
+TopoDS_Shape ShapePayload::read(std::istream& stream, std::string& elementMap)
+{
+    Base::InputStream str(stream);
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t flags = 0;
+    str >> magic >> version >> flags;
+    if (!str || magic != PayloadMagic) {
+        throw Base::RuntimeError("Invalid shape payload");
+    }
+    if (version > PayloadVersion) {
+        throw Base::RuntimeError("Unsupported shape payload version");
+    }
+
+    TopoDS_Shape shape;
+    if ((flags & SplitCompound) == 0) {
+        shape = decode(readBlock(str));
+    }
+    else {
+        int32_t orientation = 0;
+        uint64_t count = 0;
+        str >> orientation >> count;
+        if (!str || count > static_cast<uint64_t>(std::numeric_limits<int>::max())) {
+            throw Base::RuntimeError("Invalid shape payload");
+        }
+        std::vector<std::string> chunks;
+        for (uint64_t i = 0; i < count; ++i) {
+            chunks.push_back(readBlock(str));
+        }
+        std::vector<TopoDS_Shape> children(chunks.size());
+        runParallel(static_cast<int>(chunks.size()), [&](int i) {
+            children[i] = decode(chunks[i]);
+        });
+
+        BRep_Builder builder;
+        TopoDS_Compound compound;
+        builder.MakeCompound(compound);
+        for (const auto& child : children) {
+            builder.Add(compound, child);
+        }
+        compound.Orientation(static_cast<TopAbs_Orientation>(orientation));
+        shape = compound;
+    }
+
+    elementMap = readBlock(str);
+    return shape;
+}
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <iosfwd>
+#include <string>
+
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/Part/PartGlobal.h>
+
+namespace Part
+{
+
+class TopoShape;
+
+/**
+ * ShapePayload is the native file format of a shape property. It keeps the OCCT binary shape
+ * and the element map in one versioned stream. The children of a compound that don't share
+ * any sub-shape are stored as separate chunks, so that they are encoded and decoded in parallel.
+ */
+class PartExport ShapePayload
+{
+public:
+    /// Whether documents are saved with the native format instead of a BRep file
+    static bool isEnabled();
+    /// Writes the shape and, if \a withElementMap is true, its element map to \a stream
+    static void write(std::ostream& stream, const TopoShape& shape, bool withElementMap);
+    /** Reads a shape written by write()
+     * @param stream the input stream
+     * @param elementMap receives the element map, which can only be restored with
+     * Data::ComplexGeoData::restoreElementMap() once its string hasher is available
+     */
+    static TopoDS_Shape read(std::istream& stream, std::string& elementMap);
+};
+
+}  // namespace Part
@@ -0,0 +1,830 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
+#include <ostream>
+#include <sstream>
+#include <vector>
+
+#include <Bnd_Box.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepMesh_ShapeTool.hxx>
+#include <Poly_Polygon3D.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_Version.hxx>
+#include <TColStd_Array1OfInteger.hxx>
+#include <TColStd_Array1OfReal.hxx>
+#include <TColStd_HArray1OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TopExp.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <QCryptographicHash>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/Console.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "ShapeContentHash.h"
+#include "TessellationCache.h"
+
+
+using namespace Part;
+
+namespace
+{
+constexpr uint32_t FileMagic = 0x53544346;  // FCTS
+constexpr uint32_t FileVersion = 1;
+
+ParameterGrp::handle getParameter()
+{
+    return App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+}
+
+void addData(QCryptographicHash& hash, const std::string& data)
+{
+#if QT_VERSION < QT_VERSION_CHECK(6, 3, 0)
+    hash.addData(data.c_str(), int(data.size()));
+#else
+    hash.addData(QByteArrayView(data.c_str(), qsizetype(data.size())));
+#endif
+}
+
+// The absolute deflection a triangulation of the face must satisfy. A relative deflection
+// refers to the size of the face.
+double getDeflection(const TopoDS_Face& face, const IMeshTools_Parameters& params)
+{
+    if (!params.Relative) {
+        return params.Deflection;
+    }
+
+    Bnd_Box box;
+    BRepBndLib::Add(face, box, Standard_False);
+    double maxDim = 0.0;
+    BRepMesh_ShapeTool::BoxMaxDimension(box, maxDim);
+    return params.Deflection * maxDim;
+}
+
+#if OCC_VERSION_HEX >= 0x070600
+std::vector<Handle(Poly_Triangulation)> getTriangulations(const TopoDS_Shape& shape)
+{
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    std::vector<Handle(Poly_Triangulation)> meshes;
+    meshes.reserve(faceMap.Extent());
+    for (int i = 1; i <= faceMap.Extent(); i++) {
+        TopLoc_Location loc;
+        meshes.push_back(BRep_Tool::Triangulation(TopoDS::Face(faceMap(i)), loc));
+    }
+    return meshes;
+}
+
+// Marks a cache file as recently used
+void touch(const std::string& fileName)
+{
+    std::error_code ec;
+    std::filesystem::last_write_time(
+        Base::FileInfo::stringToPath(fileName),
+        std::filesystem::file_time_type::clock::now(),
+        ec
+    );
+}
+#endif
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+struct TessellationCache::Tessellation
+{
+    struct EdgeMesh
+    {
+        int edge = 0;
+        int face = 0;
+        Handle(Poly_PolygonOnTriangulation) polygon;
+        // second polygon of a seam edge
+        Handle(Poly_PolygonOnTriangulation) seam;
+    };
+    struct FreeEdgeMesh
+    {
+        int edge = 0;
+        Handle(Poly_Polygon3D) polygon;
+    };
+
+    std::vector<Handle(Poly_Triangulation)> faces;
+    std::vector<EdgeMesh> edges;
+    std::vector<FreeEdgeMesh> freeEdges;
+    int numEdges = 0;
+    std::size_t memory = 0;
+
+    void addMemory(const Handle(Poly_Triangulation)& mesh)
+    {
+        memory += std::size_t(mesh->NbNodes()) * sizeof(gp_Pnt);
+        memory += std::size_t(mesh->NbTriangles()) * sizeof(Poly_Triangle);
+        if (mesh->HasUVNodes()) {
+            memory += std::size_t(mesh->NbNodes()) * sizeof(gp_Pnt2d);
+        }
+    }
+};
+
+TessellationCache& TessellationCache::instance()
+{
+    static TessellationCache cache;
+    return cache;
+}
+
+TessellationCache::TessellationCache()
+{
+    // size in MB
+    std::size_t size = getParameter()->GetUnsigned("TessellationCacheSize", 256);
+    maxMemory = size * 1024 * 1024;
+}
+
+TessellationCache::~TessellationCache() = default;
+
+bool TessellationCache::mesh(
+    const TopoDS_Shape& shape,
+    const IMeshTools_Parameters& params,
+    const std::string& directory
+)
+{
+    if (shape.IsNull()) {
+        return false;
+    }
+
+#if OCC_VERSION_HEX >= 0x070600
+    const std::string key = makeKey(ShapeContentHash::compute(shape), params);
+    std::string fileName;
+    if (!directory.empty()) {
+        fileName = directory + "/" + key + ".tess";
+    }
+
+    TessellationPtr tess = find(key);
+    if (!tess && !fileName.empty()) {
+        tess = read(fileName);
+        if (tess) {
+            insert(key, tess);
+        }
+    }
+    if (tess && attach(shape, *tess)) {
+        if (!fileName.empty()) {
+            touch(fileName);
+        }
+        return true;
+    }
+
+    // the mesher keeps triangulations of the faces that are fine enough
+    std::vector<Handle(Poly_Triangulation)> attached = getTriangulations(shape);
+    BRepMesh_IncrementalMesh mesher(shape, params);
+
+    tess = extract(shape, params, attached);
+    if (!tess) {
+        return false;
+    }
+
+    insert(key, tess);
+    if (!fileName.empty()) {
+        write(fileName, *tess);
+        prune(directory);
+    }
+#else
+    (void)directory;
+    BRepMesh_IncrementalMesh mesher(shape, params);
+#endif
+    return false;
+}
+
+bool TessellationCache::mesh(
+    const TopoDS_Shape& shape,
+    double deflection,
+    double angularDeflection,
+    bool relative,
+    const std::string& directory
+)
+{
+    IMeshTools_Parameters params;
+    params.Deflection = deflection;
+    params.Angle = angularDeflection;
+    params.Relative = relative;
+    params.InParallel = Standard_True;
+    return mesh(shape, params, directory);
+}
+
+void TessellationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    recentlyUsed.clear();
+    memory = 0;
+}
+
+void TessellationCache::setMaxMemory(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    maxMemory = bytes;
+    evict();
+}
+
+std::size_t TessellationCache::getMaxMemory() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return maxMemory;
+}
+
+std::size_t TessellationCache::getMemory() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return memory;
+}
+
+std::size_t TessellationCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+std::string TessellationCache::directoryOf(const App::Document* doc)
+{
+    if (!doc || !getParameter()->GetBool("TessellationDiskCache", false)) {
+        return {};
+    }
+
+    std::string fileName = doc->FileName.getValue();
+    if (fileName.empty()) {
+        return {};
+    }
+
+    Base::FileInfo fi(fileName);
+    return fi.dirPath() + "/" + fi.fileNamePure() + ".tessellation";
+}
+
+std::string TessellationCache::makeKey(const std::string& hash, const IMeshTools_Parameters& params)
+{
+    std::ostringstream str;
+    str.precision(17);
+    str << hash << ';' << params.Deflection << ';' << params.Angle << ';'
+        << params.DeflectionInterior << ';' << params.AngleInterior << ';' << params.MinSize
+        << ';' << params.Relative << ';' << params.InternalVerticesMode << ';'
+        << params.ControlSurfaceDeflection;
+
+    QCryptographicHash key(QCryptographicHash::Sha1);
+    addData(key, str.str());
+    return key.result().toHex().toStdString();
+}
+
+TessellationCache::TessellationPtr TessellationCache::find(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        return {};
+    }
+
+    recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, it->second.position);
+    return it->second.tessellation;
+}
+
+void TessellationCache::insert(const std::string& key, const TessellationPtr& tess)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        memory -= it->second.tessellation->memory;
+        it->second.tessellation = tess;
+        recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, it->second.position);
+    }
+    else {
+        recentlyUsed.push_front(key);
+        entries[key] = Entry {tess, recentlyUsed.begin()};
+    }
+
+    memory += tess->memory;
+    evict();
+}
+
+void TessellationCache::evict()
+{
+    // the most recently used entry is kept even if it exceeds the limit
+    while (memory > maxMemory && recentlyUsed.size() > 1) {
+        auto it = entries.find(recentlyUsed.back());
+        memory -= it->second.tessellation->memory;
+        entries.erase(it);
+        recentlyUsed.pop_back();
+    }
+}
+
+TessellationCache::TessellationPtr TessellationCache::extract(
+    const TopoDS_Shape& shape,
+    const IMeshTools_Parameters& params,
+    const std::vector<Handle(Poly_Triangulation)>& attached
+)
+{
+    TopTools_IndexedMapOfShape faceMap;
+    TopTools_IndexedMapOfShape edgeMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+
+    auto tess = std::make_shared<Tessellation>();
+    tess->numEdges = edgeMap.Extent();
+    tess->faces.resize(faceMap.Extent());
+
+    std::vector<bool> faceEdge(edgeMap.Extent() + 1, false);
+    for (int i = 1; i <= faceMap.Extent(); i++) {
+        const TopoDS_Face& face = TopoDS::Face(faceMap(i));
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+        if (mesh.IsNull()) {
+            continue;
+        }
+
+        // a triangulation that the face had before is not necessarily fine enough
+        bool isAttached = i <= int(attached.size()) && attached[i - 1] == mesh;
+        if (isAttached && mesh->Deflection() > getDeflection(face, params)) {
+            return {};
+        }
+
+        tess->faces[i - 1] = mesh;
+        tess->addMemory(mesh);
+
+        TopTools_IndexedMapOfShape edges;
+        TopExp::MapShapes(face, TopAbs_EDGE, edges);
+        for (int j = 1; j <= edges.Extent(); j++) {
+            const TopoDS_Edge& edge = TopoDS::Edge(edges(j));
+            int index = edgeMap.FindIndex(edge);
+            if (index == 0) {
+                continue;
+            }
+
+            faceEdge[index] = true;
+            Tessellation::EdgeMesh edgeMesh;
+            edgeMesh.edge = index;
+            edgeMesh.face = i;
+            edgeMesh.polygon = BRep_Tool::PolygonOnTriangulation(
+                TopoDS::Edge(edge.Oriented(TopAbs_FORWARD)),
+                mesh,
+                loc
+            );
+            if (BRep_Tool::IsClosed(edge, face)) {
+                edgeMesh.seam = BRep_Tool::PolygonOnTriangulation(
+                    TopoDS::Edge(edge.Oriented(TopAbs_REVERSED)),
+                    mesh,
+                    loc
+                );
+            }
+            if (!edgeMesh.polygon.IsNull()) {
+                tess->edges.push_back(edgeMesh);
+            }
+        }
+    }
+
+    // Polygons of free edges are only kept if they are defined in the coordinate
+    // system of the edge, so they can be attached to an edge with another location.
+    for (int i = 1; i <= edgeMap.Extent(); i++) {
+        if (!faceEdge[i]) {
+            const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(i));
+            TopLoc_Location loc;
+            Handle(Poly_Polygon3D) polygon = BRep_Tool::Polygon3D(edge, loc);
+            if (!polygon.IsNull() && loc == edge.Location()) {
+                tess->freeEdges.push_back({i, polygon});
+                tess->memory += std::size_t(polygon->NbNodes()) * sizeof(gp_Pnt);
+            }
+        }
+    }
+
+    return tess;
+}
+
+bool TessellationCache::attach(const TopoDS_Shape& shape, const Tessellation& tess)
+{
+    TopTools_IndexedMapOfShape faceMap;
+    TopTools_IndexedMapOfShape edgeMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+    if (faceMap.Extent() != int(tess.faces.size()) || edgeMap.Extent() != tess.numEdges) {
+        return false;
+    }
+
+    BRep_Builder builder;
+    std::vector<bool> updated(faceMap.Extent() + 1, false);
+    for (int i = 1; i <= faceMap.Extent(); i++) {
+        const Handle(Poly_Triangulation)& mesh = tess.faces[i - 1];
+        if (mesh.IsNull()) {
+            continue;
+        }
+
+        // keep a finer triangulation that the face already has
+        const TopoDS_Face& face = TopoDS::Face(faceMap(i));
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) current = BRep_Tool::Triangulation(face, loc);
+        if (!current.IsNull() && current->Deflection() <= mesh->Deflection()) {
+            continue;
+        }
+
+        builder.UpdateFace(face, mesh);
+        updated[i] = true;
+    }
+
+    for (const auto& it : tess.edges) {
+        if (!updated[it.face]) {
+            continue;
+        }
+        const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(it.edge));
+        const TopoDS_Face& face = TopoDS::Face(faceMap(it.face));
+        const Handle(Poly_Triangulation)& mesh = tess.faces[it.face - 1];
+        if (it.seam.IsNull()) {
+            builder.UpdateEdge(edge, it.polygon, mesh, face.Location());
+        }
+        else {
+            builder.UpdateEdge(edge, it.polygon, it.seam, mesh, face.Location());
+        }
+    }
+
+    for (const auto& it : tess.freeEdges) {
+        const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(it.edge));
+        TopLoc_Location loc;
+        Handle(Poly_Polygon3D) current = BRep_Tool::Polygon3D(edge, loc);
+        if (!current.IsNull() && current->Deflection() <= it.polygon->Deflection()) {
+            continue;
+        }
+        builder.UpdateEdge(edge, it.polygon, edge.Location());
+    }
+
+    return true;
+}
+
+#if OCC_VERSION_HEX >= 0x070600
+namespace
+{
+void writePolygon(Base::OutputStream& str, const Handle(Poly_PolygonOnTriangulation)& polygon)
+{
+    const TColStd_Array1OfInteger& nodes = polygon->Nodes();
+    bool hasParams = polygon->HasParameters();
+    str << uint32_t(nodes.Length()) << polygon->Deflection() << hasParams;
+    for (int i = nodes.Lower(); i <= nodes.Upper(); i++) {
+        str << int32_t(nodes(i));
+    }
+    if (hasParams) {
+        const TColStd_Array1OfReal& params = polygon->Parameters()->Array1();
+        for (int i = params.Lower(); i <= params.Upper(); i++) {
+            str << params(i);
+        }
+    }
+}
+
+Handle(Poly_PolygonOnTriangulation) readPolygon(Base::InputStream& str, std::size_t fileSize)
+{
+    uint32_t numNodes {};
+    double deflection {};
+    bool hasParams {};
+    str >> numNodes >> deflection >> hasParams;
+    if (!str || numNodes == 0 || numNodes * sizeof(int32_t) > fileSize) {
+        return {};
+    }
+
+    TColStd_Array1OfInteger nodes(1, int(numNodes));
+    for (int i = 1; i <= int(numNodes); i++) {
+        int32_t node {};
+        str >> node;
+        nodes(i) = node;
+    }
+
+    Handle(Poly_PolygonOnTriangulation) polygon;
+    if (hasParams) {
+        TColStd_Array1OfReal params(1, int(numNodes));
+        for (int i = 1; i <= int(numNodes); i++) {
+            str >> params(i);
+        }
+        polygon = new Poly_PolygonOnTriangulation(nodes, params);
+    }
+    else {
+        polygon = new Poly_PolygonOnTriangulation(nodes);
+    }
+    polygon->Deflection(deflection);
+    return polygon;
+}
+
+bool isValid(const Handle(Poly_PolygonOnTriangulation)& polygon, int numNodes)
+{
+    if (polygon.IsNull()) {
+        return false;
+    }
+    const TColStd_Array1OfInteger& nodes = polygon->Nodes();
+    for (int i = nodes.Lower(); i <= nodes.Upper(); i++) {
+        if (nodes(i) < 1 || nodes(i) > numNodes) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void writeTriangulation(Base::OutputStream& str, const Handle(Poly_Triangulation)& mesh)
+{
+    bool hasUV = mesh->HasUVNodes();
+    str << uint32_t(mesh->NbNodes()) << uint32_t(mesh->NbTriangles()) << hasUV
+        << mesh->Deflection();
+    for (int i = 1; i <= mesh->NbNodes(); i++) {
+        const gp_Pnt pnt = mesh->Node(i);
+        str << pnt.X() << pnt.Y() << pnt.Z();
+    }
+    if (hasUV) {
+        for (int i = 1; i <= mesh->NbNodes(); i++) {
+            const gp_Pnt2d uv = mesh->UVNode(i);
+            str << uv.X() << uv.Y();
+        }
+    }
+    for (int i = 1; i <= mesh->NbTriangles(); i++) {
+        int n1 {}, n2 {}, n3 {};
+        mesh->Triangle(i).Get(n1, n2, n3);
+        str << int32_t(n1) << int32_t(n2) << int32_t(n3);
+    }
+}
+
+Handle(Poly_Triangulation) readTriangulation(Base::InputStream& str, std::size_t fileSize)
+{
+    uint32_t numNodes {};
+    uint32_t numTriangles {};
+    bool hasUV {};
+    double deflection {};
+    str >> numNodes >> numTriangles >> hasUV >> deflection;
+    // reject the sizes of a corrupted file before allocating memory
+    if (!str || std::size_t(numNodes) * 3 * sizeof(double) > fileSize
+        || std::size_t(numTriangles) * 3 * sizeof(int32_t) > fileSize) {
+        return {};
+    }
+
+    Handle(Poly_Triangulation) mesh =
+        new Poly_Triangulation(int(numNodes), int(numTriangles), hasUV);
+    mesh->Deflection(deflection);
+    for (int i = 1; i <= int(numNodes); i++) {
+        double x {}, y {}, z {};
+        str >> x >> y >> z;
+        mesh->SetNode(i, gp_Pnt(x, y, z));
+    }
+    if (hasUV) {
+        for (int i = 1; i <= int(numNodes); i++) {
+            double u {}, v {};
+            str >> u >> v;
+            mesh->SetUVNode(i, gp_Pnt2d(u, v));
+        }
+    }
+    for (int i = 1; i <= int(numTriangles); i++) {
+        int32_t n1 {}, n2 {}, n3 {};
+        str >> n1 >> n2 >> n3;
+        auto isValid = [numNodes](int32_t node) {
+            return node >= 1 && node <= int32_t(numNodes);
+        };
+        if (!isValid(n1) || !isValid(n2) || !isValid(n3)) {
+            return {};
+        }
+        mesh->SetTriangle(i, Poly_Triangle(n1, n2, n3));
+    }
+    return mesh;
+}
+}  // namespace
+#endif
+
+TessellationCache::TessellationPtr TessellationCache::read(const std::string& fileName)
+{
+#if OCC_VERSION_HEX >= 0x070600
+    Base::FileInfo fi(fileName);
+    if (!fi.exists()) {
+        return {};
+    }
+
+    Base::ifstream file(fi, std::ios::in | std::ios::binary);
+    file.seekg(0, std::ios::end);
+    const auto fileSize = static_cast<std::size_t>(std::max<std::streamoff>(file.tellg(), 0));
+    file.seekg(0, std::ios::beg);
+    Base::InputStream str(file);
+    uint32_t magic {};
+    uint32_t version {};
+    uint32_t numFaces {};
+    int32_t numEdges {};
+    str >> magic >> version >> numFaces >> numEdges;
+    // every face takes at least one byte, so reject the count of a corrupted file before
+    // allocating memory
+    if (!str || magic != FileMagic || version != FileVersion || numFaces > fileSize) {
+        return {};
+    }
+
+    auto tess = std::make_shared<Tessellation>();
+    tess->numEdges = numEdges;
+    tess->faces.resize(numFaces);
+    for (auto& mesh : tess->faces) {
+        bool hasMesh {};
+        str >> hasMesh;
+        if (hasMesh) {
+            mesh = readTriangulation(str, fileSize);
+            if (mesh.IsNull()) {
+                return {};
+            }
+            tess->addMemory(mesh);
+        }
+    }
+
+    uint32_t numEdgeMeshes {};
+    str >> numEdgeMeshes;
+    for (uint32_t i = 0; i < numEdgeMeshes && str; i++) {
+        Tessellation::EdgeMesh edgeMesh;
+        int32_t edge {};
+        int32_t face {};
+        bool isSeam {};
+        str >> edge >> face >> isSeam;
+        if (edge < 1 || edge > numEdges || face < 1 || face > int32_t(numFaces)
+            || tess->faces[face - 1].IsNull()) {
+            return {};
+        }
+        edgeMesh.edge = edge;
+        edgeMesh.face = face;
+        edgeMesh.polygon = readPolygon(str, fileSize);
+        if (isSeam) {
+            edgeMesh.seam = readPolygon(str, fileSize);
+        }
+
+        int numNodes = tess->faces[face - 1]->NbNodes();
+        if (!isValid(edgeMesh.polygon, numNodes) || (isSeam && !isValid(edgeMesh.seam, numNodes))) {
+            return {};
+        }
+        tess->edges.push_back(edgeMesh);
+    }
+
+    uint32_t numFreeEdges {};
+    str >> numFreeEdges;
+    for (uint32_t i = 0; i < numFreeEdges && str; i++) {
+        int32_t edge {};
+        uint32_t numNodes {};
+        double deflection {};
+        str >> edge >> numNodes >> deflection;
+        if (edge < 1 || edge > numEdges || numNodes == 0
+            || std::size_t(numNodes) * 3 * sizeof(double) > fileSize) {
+            return {};
+        }
+        TColgp_Array1OfPnt nodes(1, int(numNodes));
+        for (int j = 1; j <= int(numNodes); j++) {
+            double x {}, y {}, z {};
+            str >> x >> y >> z;
+            nodes(j).SetCoord(x, y, z);
+        }
+        Handle(Poly_Polygon3D) polygon = new Poly_Polygon3D(nodes);
+        polygon->Deflection(deflection);
+        tess->freeEdges.push_back({edge, polygon});
+        tess->memory += std::size_t(numNodes) * sizeof(gp_Pnt);
+    }
+
+    if (!str) {
+        Base::Console().warning("Ignore corrupted tessellation file %s\n", fileName.c_str());
+        return {};
+    }
+
+    return tess;
+#else
+    (void)fileName;
+    return {};
+#endif
+}
+
+void TessellationCache::write(const std::string& fileName, const Tessellation& tess)
+{
+#if OCC_VERSION_HEX >= 0x070600
+    Base::FileInfo fi(fileName);
+    Base::FileInfo dir(fi.dirPath());
+    if (!dir.exists() && !dir.createDirectories()) {
+        return;
+    }
+
+    // write to a temporary file first so that a reader never sees a partial file, the name
+    // is unique so that concurrent writers don't write to the same file
+    Base::FileInfo tmp(
+        Base::FileInfo::getTempFileName((fi.fileName() + ".").c_str(), fi.dirPath().c_str())
+        + ".part"
+    );
+    {
+        Base::ofstream file(tmp, std::ios::out | std::ios::binary);
+        Base::OutputStream str(file);
+        str << FileMagic << FileVersion << uint32_t(tess.faces.size()) << int32_t(tess.numEdges);
+        for (const auto& mesh : tess.faces) {
+            str << !mesh.IsNull();
+            if (!mesh.IsNull()) {
+                writeTriangulation(str, mesh);
+            }
+        }
+
+        str << uint32_t(tess.edges.size());
+        for (const auto& it : tess.edges) {
+            str << int32_t(it.edge) << int32_t(it.face) << !it.seam.IsNull();
+            writePolygon(str, it.polygon);
+            if (!it.seam.IsNull()) {
+                writePolygon(str, it.seam);
+            }
+        }
+
+        str << uint32_t(tess.freeEdges.size());
+        for (const auto& it : tess.freeEdges) {
+            const TColgp_Array1OfPnt& nodes = it.polygon->Nodes();
+            str << int32_t(it.edge) << uint32_t(nodes.Length()) << it.polygon->Deflection();
+            for (int i = nodes.Lower(); i <= nodes.Upper(); i++) {
+                str << nodes(i).X() << nodes(i).Y() << nodes(i).Z();
+            }
+        }
+
+        file.close();
+        if (!file) {
+            Base::Console().warning("Failed to write tessellation file %s\n", fileName.c_str());
+            tmp.deleteFile();
+            return;
+        }
+    }
+
+    // renaming replaces an existing file in one step
+    if (!tmp.renameFile(fileName.c_str())) {
+        tmp.deleteFile();
+    }
+#else
+    (void)fileName;
+    (void)tess;
+#endif
+}
+
+void TessellationCache::prune(const std::string& directory)
+{
+    // size in MB
+    std::size_t maxSize = getParameter()->GetUnsigned("TessellationDiskCacheSize", 1024);
+    maxSize *= 1024 * 1024;
+
+    struct CacheFile
+    {
+        Base::FileInfo file;
+        std::time_t time;
+        std::size_t size;
+    };
+
+    // temporary files older than this are left over from an interrupted write
+    const std::time_t staleTime = std::time(nullptr) - 3600;
+    std::vector<CacheFile> files;
+    std::size_t total = 0;
+    for (const auto& fi : Base::FileInfo(directory).getDirectoryContent()) {
+        if (!fi.isFile()) {
+            continue;
+        }
+        std::time_t time = fi.lastModified().getTime_t();
+        if (fi.hasExtension("part")) {
+            if (time < staleTime) {
+                fi.deleteFile();
+            }
+        }
+        else if (fi.hasExtension("tess")) {
+            files.push_back({fi, time, fi.size()});
+            total += files.back().size;
+        }
+    }
+
+    if (total <= maxSize) {
+        return;
+    }
+
+    // remove the least recently used files first, a cache hit touches its file
+    std::sort(files.begin(), files.end(), [](const CacheFile& f1, const CacheFile& f2) {
+        return f1.time < f2.time;
+    });
+    for (const auto& it : files) {
+        if (total <= maxSize) {
+            break;
+        }
+        if (it.file.deleteFile()) {
+            total -= it.size;
+        }
+    }
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <IMeshTools_Parameters.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/Part/PartGlobal.h>
+
+namespace App
+{
+class Document;
+}
+
+namespace Part
+{
+
+/**
+ * The TessellationCache keeps the triangulations that BRepMesh_IncrementalMesh creates for a
+ * shape so that meshing the same shape with the same parameters again only re-attaches them.
+ *
+ * Entries are keyed by a hash of the B-Rep content of the shape (without its placement and
+ * its triangulations) and the meshing parameters, i.e. a recomputed or reloaded shape that
+ * is geometrically unchanged finds its triangulation, too. The entries are kept in a memory
+ * limited LRU list and optionally written to a directory on disk.
+ */
+class PartExport TessellationCache
+{
+public:
+    static TessellationCache& instance();
+
+    /**
+     * Triangulates the faces and edges of \a shape with the given parameters. If the cache
+     * contains a triangulation for the shape it's attached to the shape instead. If
+     * \a directory is not empty it's used as disk cache.
+     * Returns true if the triangulation was taken from the cache.
+     */
+    bool mesh(
+        const TopoDS_Shape& shape,
+        const IMeshTools_Parameters& params,
+        const std::string& directory = {}
+    );
+    /// Convenience function with the parameters of BRepMesh_IncrementalMesh
+    bool mesh(
+        const TopoDS_Shape& shape,
+        double deflection,
+        double angularDeflection,
+        bool relative = false,
+        const std::string& directory = {}
+    );
+
+    /// Removes all entries from the memory cache.
+    void clear();
+    /// Sets the maximum memory in bytes that the cached triangulations may use.
+    void setMaxMemory(std::size_t bytes);
+    std::size_t getMaxMemory() const;
+    std::size_t getMemory() const;
+    std::size_t size() const;
+
+    /**
+     * Returns the disk cache directory next to the file of \a doc. If the disk cache
+     * is disabled in the preferences or the document is not saved yet an empty string
+     * is returned.
+     */
+    static std::string directoryOf(const App::Document* doc);
+
+private:
+    TessellationCache();
+    ~TessellationCache();
+
+    struct Tessellation;
+    using TessellationPtr = std::shared_ptr<const Tessellation>;
+
+    TessellationPtr find(const std::string& key);
+    void insert(const std::string& key, const TessellationPtr& tess);
+    void evict();
+
+    static std::string makeKey(const std::string& hash, const IMeshTools_Parameters& params);
+    /**
+     * Collects the triangulations of \a shape. Triangulations in \a attached were kept by the
+     * mesher and are only taken if they satisfy the deflection of \a params, otherwise nothing
+     * is returned.
+     */
+    static TessellationPtr extract(
+        const TopoDS_Shape& shape,
+        const IMeshTools_Parameters& params,
+        const std::vector<Handle(Poly_Triangulation)>& attached
+    );
+    /// Attaches the triangulations but keeps those of the shape that are finer
+    static bool attach(const TopoDS_Shape& shape, const Tessellation& tess);
+    static TessellationPtr read(const std::string& fileName);
+    static void write(const std::string& fileName, const Tessellation& tess);
+    /// Removes the least recently used files if the directory exceeds the size set in the
+    /// preferences
+    static void prune(const std::string& directory);
+
+private:
+    struct Entry
+    {
+        TessellationPtr tessellation;
+        std::list<std::string>::iterator position;
+    };
+
+    mutable std::mutex mutex;
+    std::list<std::string> recentlyUsed;
+    std::unordered_map<std::string, Entry> entries;
+    std::size_t memory = 0;
+    std::size_t maxMemory;
+};
+
+}  // namespace Part
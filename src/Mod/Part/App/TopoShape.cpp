@@ -25,9 +25,11 @@
 #include <FCConfig.h>
 
 #include <TopoDS_Shape.hxx>
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstdlib>
+#include <exception>
 #include <sstream>
 #include <boost/regex.hpp>
 
@@ -66,7 +68,6 @@
 #include <BRepLib.hxx>
 #include <BRepLib_FindSurface.hxx>
 #include <BRepLProp_SLProps.hxx>
-#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepOffsetAPI_MakeOffset.hxx>
 #include <BRepOffsetAPI_MakeOffsetShape.hxx>
 #include <BRepOffsetAPI_MakePipe.hxx>
@@ -123,6 +124,7 @@
 #include <Law_BSpline.hxx>
 #include <Law_BSpFunc.hxx>
 #include <Law_Constant.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeAnalysis_FreeBoundsProperties.hxx>
 #include <ShapeExtend_Explorer.hxx>
 #include <ShapeFix_Shape.hxx>
@@ -171,6 +173,7 @@
 #include <Base/Tools.h>
 #include <Base/Vector3D.h>
 #include <Base/Reader.h>
+#include <Base/Sequencer.h>
 #include <Base/Writer.h>
 
 #include "BRepMesh.h"
@@ -183,8 +186,10 @@
 #include "modelRefine.h"
 #include "PartPyCXX.h"
 #include "ProgressIndicator.h"
+#include "TessellationCache.h"
 #include "Tools.h"
 #include "TopoShape.h"
+#include "TopoShapeCache.h"
 #include "TopoShapeCompoundPy.h"
 #include "TopoShapeCompSolidPy.h"
 #include "TopoShapeEdgePy.h"
@@ -1002,14 +1007,8 @@ void TopoShape::dump(std::ostream& out) const
 void TopoShape::exportStl(const char* filename, double deflection) const
 {
     StlAPI_Writer writer;
-    BRepMesh_IncrementalMesh aMesh(
-        this->_Shape,
-        deflection,
-        /*isRelative*/ Standard_False,
-        /*theAngDeflection*/
-        defaultAngularDeflection(deflection),
-        /*isInParallel*/ true
-    );
+    TessellationCache::instance()
+        .mesh(this->_Shape, deflection, defaultAngularDeflection(deflection));
     writer.Write(this->_Shape, encodeFilename(filename).c_str());
 }
 
@@ -1031,14 +1030,7 @@ void TopoShape::exportFaceSet(
     bool supportFaceColors = (numFaces == colors.size());
 
     std::size_t index = 0;
-    BRepMesh_IncrementalMesh MESH(
-        this->_Shape,
-        dev,
-        /*isRelative*/ Standard_False,
-        /*theAngDeflection*/
-        defaultAngularDeflection(dev),
-        /*isInParallel*/ true
-    );
+    TessellationCache::instance().mesh(this->_Shape, dev, defaultAngularDeflection(dev));
     for (ex.Init(this->_Shape, TopAbs_FACE); ex.More(); ex.Next(), index++) {
         // get the shape and mesh it
         const TopoDS_Face& aFace = TopoDS::Face(ex.Current());
@@ -1425,12 +1417,6 @@ bool TopoShape::isNull() const
     return this->_Shape.IsNull() ? true : false;
 }
 
-bool TopoShape::isValid() const
-{
-    BRepCheck_Analyzer aChecker(this->_Shape);
-    return aChecker.IsValid() ? true : false;
-}
-
 bool TopoShape::isEmpty() const
 {
     return Tools::isShapeEmpty(this->_Shape);
@@ -1472,229 +1458,380 @@ std::vector<std::string> buildBOPCheckResultVector()
 }
 }  // namespace Part
 
-bool TopoShape::analyze(bool runBopCheck, std::ostream& str) const
+namespace
+{
+// Collects the parts of \a shape that are checked separately, i.e. the children of compounds
+void collectCheckParts(const TopoDS_Shape& shape, std::vector<TopoDS_Shape>& parts)
 {
-    if (!this->_Shape.IsNull()) {
-        BRepCheck_Analyzer aChecker(this->_Shape);
-        if (!aChecker.IsValid()) {
-            std::vector<TopoDS_Shape> shapes;
+    for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+        if (it.Value().ShapeType() == TopAbs_COMPOUND) {
+            collectCheckParts(it.Value(), parts);
+        }
+        else {
+            parts.push_back(it.Value());
+        }
+    }
+}
 
-            TopTools_IndexedMapOfShape vertexOfShape;
-            TopExp::MapShapes(this->_Shape, TopAbs_VERTEX, vertexOfShape);
-            for (int i = 1; i <= vertexOfShape.Extent(); ++i) {
-                shapes.push_back(vertexOfShape(i));
-            }
+// Collects the parts of \a shape that are checked separately. That's the shape itself unless
+// it's a compound with more than one child.
+std::vector<TopoDS_Shape> getCheckParts(const TopoDS_Shape& shape)
+{
+    std::vector<TopoDS_Shape> parts;
+    if (!shape.IsNull() && shape.ShapeType() == TopAbs_COMPOUND) {
+        collectCheckParts(shape, parts);
+    }
+    if (parts.size() < 2) {
+        parts.assign(1, shape);
+    }
+    return parts;
+}
 
-            TopTools_IndexedMapOfShape edgeOfShape;
-            TopExp::MapShapes(this->_Shape, TopAbs_EDGE, edgeOfShape);
-            for (int i = 1; i <= edgeOfShape.Extent(); ++i) {
-                shapes.push_back(edgeOfShape(i));
+// Checks the validity of \a shape and passes the result of each part to \a report. The children
+// of a compound are checked in parallel, a batch at a time, and the check stops after the batch
+// in which \a report returned false. Then \a complete is set to false.
+bool checkValidity(
+    const TopoDS_Shape& shape,
+    const Part::TopoShape::ValidityReport& report,
+    bool& complete
+)
+{
+    complete = true;
+    std::vector<TopoDS_Shape> parts = getCheckParts(shape);
+    if (parts.size() == 1) {
+        // A null shape is passed on to BRepCheck_Analyzer, which throws Standard_NullObject
+#if OCC_VERSION_HEX >= 0x070600
+        BRepCheck_Analyzer aChecker(shape, Standard_True, Standard_True);
+#else
+        BRepCheck_Analyzer aChecker(shape);
+#endif
+        bool valid = aChecker.IsValid() ? true : false;
+        complete = report(0, shape, valid);
+        return valid;
+    }
+
+    bool allValid = true;
+    int count = static_cast<int>(parts.size());
+    int batch = std::max(1, OSD_Parallel::NbLogicalProcessors()) * 4;
+    for (int begin = 0; begin < count && complete; begin += batch) {
+        Base::SequencerBase::Instance().checkAbort();
+        int end = std::min(count, begin + batch);
+        std::vector<char> valid(end - begin, 0);
+        std::vector<std::exception_ptr> errors(end - begin);
+        OSD_Parallel::For(begin, end, [&](int i) {
+            try {
+                BRepCheck_Analyzer aChecker(parts[i]);
+                valid[i - begin] = aChecker.IsValid() ? 1 : 0;
             }
-
-            TopTools_IndexedMapOfShape wireOfShape;
-            TopExp::MapShapes(this->_Shape, TopAbs_WIRE, wireOfShape);
-            for (int i = 1; i <= wireOfShape.Extent(); ++i) {
-                shapes.push_back(wireOfShape(i));
+            catch (...) {
+                errors[i - begin] = std::current_exception();
             }
-
-            TopTools_IndexedMapOfShape faceOfShape;
-            TopExp::MapShapes(this->_Shape, TopAbs_FACE, faceOfShape);
-            for (int i = 1; i <= faceOfShape.Extent(); ++i) {
-                shapes.push_back(faceOfShape(i));
+        });
+        for (int i = begin; i < end; ++i) {
+            if (errors[i - begin]) {
+                std::rethrow_exception(errors[i - begin]);
             }
-
-            TopTools_IndexedMapOfShape shellOfShape;
-            TopExp::MapShapes(this->_Shape, TopAbs_SHELL, shellOfShape);
-            for (int i = 1; i <= shellOfShape.Extent(); ++i) {
-                shapes.push_back(shellOfShape(i));
+        }
+        for (int i = begin; i < end; ++i) {
+            allValid = allValid && valid[i - begin];
+            if (!report(i, parts[i], valid[i - begin] != 0)) {
+                complete = false;
             }
+        }
+    }
+    return allValid;
+}
 
-            TopTools_IndexedMapOfShape solidOfShape;
-            TopExp::MapShapes(this->_Shape, TopAbs_SOLID, solidOfShape);
-            for (int i = 1; i <= solidOfShape.Extent(); ++i) {
-                shapes.push_back(solidOfShape(i));
-            }
+// Writes the problems that BRepCheck_Analyzer finds in \a shape to \a str
+void reportInvalid(const TopoDS_Shape& shape, std::ostream& str)
+{
+#if OCC_VERSION_HEX >= 0x070600
+    BRepCheck_Analyzer aChecker(shape, Standard_True, Standard_True);
+#else
+    BRepCheck_Analyzer aChecker(shape);
+#endif
 
-            TopTools_IndexedMapOfShape compOfShape;
-            TopExp::MapShapes(this->_Shape, TopAbs_COMPOUND, compOfShape);
-            for (int i = 1; i <= compOfShape.Extent(); ++i) {
-                shapes.push_back(compOfShape(i));
-            }
+    std::vector<TopoDS_Shape> shapes;
 
-            TopTools_IndexedMapOfShape compsOfShape;
-            TopExp::MapShapes(this->_Shape, TopAbs_COMPSOLID, compsOfShape);
-            for (int i = 1; i <= compsOfShape.Extent(); ++i) {
-                shapes.push_back(compsOfShape(i));
-            }
+    TopTools_IndexedMapOfShape vertexOfShape;
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertexOfShape);
+    for (int i = 1; i <= vertexOfShape.Extent(); ++i) {
+        shapes.push_back(vertexOfShape(i));
+    }
 
-            for (const auto& shape : shapes) {
-                if (!aChecker.IsValid(shape)) {
-                    const Handle(BRepCheck_Result) & result = aChecker.Result(shape);
-                    if (result.IsNull()) {
-                        continue;
-                    }
-                    const BRepCheck_ListOfStatus& status = result->StatusOnShape(shape);
-
-                    BRepCheck_ListIteratorOfListOfStatus it(status);
-                    while (it.More()) {
-                        BRepCheck_Status& val = it.Value();
-                        switch (val) {
-                            case BRepCheck_NoError:
-                                str << "No error" << std::endl;
-                                break;
-                            case BRepCheck_InvalidPointOnCurve:
-                                str << "Invalid point on curve" << std::endl;
-                                break;
-                            case BRepCheck_InvalidPointOnCurveOnSurface:
-                                str << "Invalid point on curve on surface" << std::endl;
-                                break;
-                            case BRepCheck_InvalidPointOnSurface:
-                                str << "Invalid point on surface" << std::endl;
-                                break;
-                            case BRepCheck_No3DCurve:
-                                str << "No 3D curve" << std::endl;
-                                break;
-                            case BRepCheck_Multiple3DCurve:
-                                str << "Multiple 3D curve" << std::endl;
-                                break;
-                            case BRepCheck_Invalid3DCurve:
-                                str << "Invalid 3D curve" << std::endl;
-                                break;
-                            case BRepCheck_NoCurveOnSurface:
-                                str << "No curve on surface" << std::endl;
-                                break;
-                            case BRepCheck_InvalidCurveOnSurface:
-                                str << "Invalid curve on surface" << std::endl;
-                                break;
-                            case BRepCheck_InvalidCurveOnClosedSurface:
-                                str << "Invalid curve on closed surface" << std::endl;
-                                break;
-                            case BRepCheck_InvalidSameRangeFlag:
-                                str << "Invalid same-range flag" << std::endl;
-                                break;
-                            case BRepCheck_InvalidSameParameterFlag:
-                                str << "Invalid same-parameter flag" << std::endl;
-                                break;
-                            case BRepCheck_InvalidDegeneratedFlag:
-                                str << "Invalid degenerated flag" << std::endl;
-                                break;
-                            case BRepCheck_FreeEdge:
-                                str << "Free edge" << std::endl;
-                                break;
-                            case BRepCheck_InvalidMultiConnexity:
-                                str << "Invalid multi-connexity" << std::endl;
-                                break;
-                            case BRepCheck_InvalidRange:
-                                str << "Invalid range" << std::endl;
-                                break;
-                            case BRepCheck_EmptyWire:
-                                str << "Empty wire" << std::endl;
-                                break;
-                            case BRepCheck_RedundantEdge:
-                                str << "Redundant edge" << std::endl;
-                                break;
-                            case BRepCheck_SelfIntersectingWire:
-                                str << "Self-intersecting wire" << std::endl;
-                                break;
-                            case BRepCheck_NoSurface:
-                                str << "No surface" << std::endl;
-                                break;
-                            case BRepCheck_InvalidWire:
-                                str << "Invalid wires" << std::endl;
-                                break;
-                            case BRepCheck_RedundantWire:
-                                str << "Redundant wires" << std::endl;
-                                break;
-                            case BRepCheck_IntersectingWires:
-                                str << "Intersecting wires" << std::endl;
-                                break;
-                            case BRepCheck_InvalidImbricationOfWires:
-                                str << "Invalid imbrication of wires" << std::endl;
-                                break;
-                            case BRepCheck_EmptyShell:
-                                str << "Empty shell" << std::endl;
-                                break;
-                            case BRepCheck_RedundantFace:
-                                str << "Redundant face" << std::endl;
-                                break;
-                            case BRepCheck_UnorientableShape:
-                                str << "Unorientable shape" << std::endl;
-                                break;
-                            case BRepCheck_NotClosed:
-                                str << "Not closed" << std::endl;
-                                break;
-                            case BRepCheck_NotConnected:
-                                str << "Not connected" << std::endl;
-                                break;
-                            case BRepCheck_SubshapeNotInShape:
-                                str << "Sub-shape not in shape" << std::endl;
-                                break;
-                            case BRepCheck_BadOrientation:
-                                str << "Bad orientation" << std::endl;
-                                break;
-                            case BRepCheck_BadOrientationOfSubshape:
-                                str << "Bad orientation of sub-shape" << std::endl;
-                                break;
-                            case BRepCheck_InvalidToleranceValue:
-                                str << "Invalid tolerance value" << std::endl;
-                                break;
-                            case BRepCheck_CheckFail:
-                                str << "Check failed" << std::endl;
-                                break;
-                            default:
-                                str << "Undetermined error" << std::endl;
-                                break;
-                        }
+    TopTools_IndexedMapOfShape edgeOfShape;
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeOfShape);
+    for (int i = 1; i <= edgeOfShape.Extent(); ++i) {
+        shapes.push_back(edgeOfShape(i));
+    }
 
-                        it.Next();
-                    }
+    TopTools_IndexedMapOfShape wireOfShape;
+    TopExp::MapShapes(shape, TopAbs_WIRE, wireOfShape);
+    for (int i = 1; i <= wireOfShape.Extent(); ++i) {
+        shapes.push_back(wireOfShape(i));
+    }
+
+    TopTools_IndexedMapOfShape faceOfShape;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceOfShape);
+    for (int i = 1; i <= faceOfShape.Extent(); ++i) {
+        shapes.push_back(faceOfShape(i));
+    }
+
+    TopTools_IndexedMapOfShape shellOfShape;
+    TopExp::MapShapes(shape, TopAbs_SHELL, shellOfShape);
+    for (int i = 1; i <= shellOfShape.Extent(); ++i) {
+        shapes.push_back(shellOfShape(i));
+    }
+
+    TopTools_IndexedMapOfShape solidOfShape;
+    TopExp::MapShapes(shape, TopAbs_SOLID, solidOfShape);
+    for (int i = 1; i <= solidOfShape.Extent(); ++i) {
+        shapes.push_back(solidOfShape(i));
+    }
+
+    TopTools_IndexedMapOfShape compOfShape;
+    TopExp::MapShapes(shape, TopAbs_COMPOUND, compOfShape);
+    for (int i = 1; i <= compOfShape.Extent(); ++i) {
+        shapes.push_back(compOfShape(i));
+    }
+
+    TopTools_IndexedMapOfShape compsOfShape;
+    TopExp::MapShapes(shape, TopAbs_COMPSOLID, compsOfShape);
+    for (int i = 1; i <= compsOfShape.Extent(); ++i) {
+        shapes.push_back(compsOfShape(i));
+    }
+
+    for (const auto& shape : shapes) {
+        if (!aChecker.IsValid(shape)) {
+            const Handle(BRepCheck_Result) & result = aChecker.Result(shape);
+            if (result.IsNull()) {
+                continue;
+            }
+            const BRepCheck_ListOfStatus& status = result->StatusOnShape(shape);
+
+            BRepCheck_ListIteratorOfListOfStatus it(status);
+            while (it.More()) {
+                BRepCheck_Status& val = it.Value();
+                switch (val) {
+                    case BRepCheck_NoError:
+                        str << "No error" << std::endl;
+                        break;
+                    case BRepCheck_InvalidPointOnCurve:
+                        str << "Invalid point on curve" << std::endl;
+                        break;
+                    case BRepCheck_InvalidPointOnCurveOnSurface:
+                        str << "Invalid point on curve on surface" << std::endl;
+                        break;
+                    case BRepCheck_InvalidPointOnSurface:
+                        str << "Invalid point on surface" << std::endl;
+                        break;
+                    case BRepCheck_No3DCurve:
+                        str << "No 3D curve" << std::endl;
+                        break;
+                    case BRepCheck_Multiple3DCurve:
+                        str << "Multiple 3D curve" << std::endl;
+                        break;
+                    case BRepCheck_Invalid3DCurve:
+                        str << "Invalid 3D curve" << std::endl;
+                        break;
+                    case BRepCheck_NoCurveOnSurface:
+                        str << "No curve on surface" << std::endl;
+                        break;
+                    case BRepCheck_InvalidCurveOnSurface:
+                        str << "Invalid curve on surface" << std::endl;
+                        break;
+                    case BRepCheck_InvalidCurveOnClosedSurface:
+                        str << "Invalid curve on closed surface" << std::endl;
+                        break;
+                    case BRepCheck_InvalidSameRangeFlag:
+                        str << "Invalid same-range flag" << std::endl;
+                        break;
+                    case BRepCheck_InvalidSameParameterFlag:
+                        str << "Invalid same-parameter flag" << std::endl;
+                        break;
+                    case BRepCheck_InvalidDegeneratedFlag:
+                        str << "Invalid degenerated flag" << std::endl;
+                        break;
+                    case BRepCheck_FreeEdge:
+                        str << "Free edge" << std::endl;
+                        break;
+                    case BRepCheck_InvalidMultiConnexity:
+                        str << "Invalid multi-connexity" << std::endl;
+                        break;
+                    case BRepCheck_InvalidRange:
+                        str << "Invalid range" << std::endl;
+                        break;
+                    case BRepCheck_EmptyWire:
+                        str << "Empty wire" << std::endl;
+                        break;
+                    case BRepCheck_RedundantEdge:
+                        str << "Redundant edge" << std::endl;
+                        break;
+                    case BRepCheck_SelfIntersectingWire:
+                        str << "Self-intersecting wire" << std::endl;
+                        break;
+                    case BRepCheck_NoSurface:
+                        str << "No surface" << std::endl;
+                        break;
+                    case BRepCheck_InvalidWire:
+                        str << "Invalid wires" << std::endl;
+                        break;
+                    case BRepCheck_RedundantWire:
+                        str << "Redundant wires" << std::endl;
+                        break;
+                    case BRepCheck_IntersectingWires:
+                        str << "Intersecting wires" << std::endl;
+                        break;
+                    case BRepCheck_InvalidImbricationOfWires:
+                        str << "Invalid imbrication of wires" << std::endl;
+                        break;
+                    case BRepCheck_EmptyShell:
+                        str << "Empty shell" << std::endl;
+                        break;
+                    case BRepCheck_RedundantFace:
+                        str << "Redundant face" << std::endl;
+                        break;
+                    case BRepCheck_UnorientableShape:
+                        str << "Unorientable shape" << std::endl;
+                        break;
+                    case BRepCheck_NotClosed:
+                        str << "Not closed" << std::endl;
+                        break;
+                    case BRepCheck_NotConnected:
+                        str << "Not connected" << std::endl;
+                        break;
+                    case BRepCheck_SubshapeNotInShape:
+                        str << "Sub-shape not in shape" << std::endl;
+                        break;
+                    case BRepCheck_BadOrientation:
+                        str << "Bad orientation" << std::endl;
+                        break;
+                    case BRepCheck_BadOrientationOfSubshape:
+                        str << "Bad orientation of sub-shape" << std::endl;
+                        break;
+                    case BRepCheck_InvalidToleranceValue:
+                        str << "Invalid tolerance value" << std::endl;
+                        break;
+                    case BRepCheck_CheckFail:
+                        str << "Check failed" << std::endl;
+                        break;
+                    default:
+                        str << "Undetermined error" << std::endl;
+                        break;
                 }
+
+                it.Next();
             }
+        }
+    }
+}
 
-            return false;  // errors detected
+// Runs the BOP argument check on \a shape and writes the problems to \a str. Returns true if
+// none were found.
+bool checkBop(const TopoDS_Shape& shape, std::ostream& str)
+{
+    TopoDS_Shape BOPCopy = BRepBuilderAPI_Copy(shape).Shape();
+    BOPAlgo_ArgumentAnalyzer BOPCheck;
+    BOPCheck.SetShape1(BOPCopy);
+    // all settings are false by default. so only turn on what we want.
+    BOPCheck.ArgumentTypeMode() = true;
+    BOPCheck.SelfInterMode() = true;
+    BOPCheck.SmallEdgeMode() = true;
+    BOPCheck.RebuildFaceMode() = true;
+    BOPCheck.ContinuityMode() = true;
+    BOPCheck.SetParallelMode(true);  // this doesn't help for speed right now(occt 6.9.1).
+    BOPCheck.SetRunParallel(true);   // performance boost, use all available cores
+    BOPCheck.TangentMode() = true;   // these 4 new tests add about 5% processing time.
+    BOPCheck.MergeVertexMode() = true;
+    BOPCheck.CurveOnSurfaceMode() = true;
+    BOPCheck.MergeEdgeMode() = true;
+    BOPCheck.Perform();
+    if (!BOPCheck.HasFaulty()) {
+        return true;
+    }
+
+    str << "BOP check found the following errors:" << std::endl;
+    static std::vector<std::string> shapeEnumToString = buildShapeEnumVector();
+    static std::vector<std::string> bopEnumToString = buildBOPCheckResultVector();
+    const BOPAlgo_ListOfCheckResult& BOPResults = BOPCheck.GetCheckResult();
+    BOPAlgo_ListIteratorOfListOfCheckResult BOPResultsIt(BOPResults);
+    for (; BOPResultsIt.More(); BOPResultsIt.Next()) {
+        const BOPAlgo_CheckResult& current = BOPResultsIt.Value();
+
+        const TopTools_ListOfShape& faultyShapes1 = current.GetFaultyShapes1();
+        TopTools_ListIteratorOfListOfShape faultyShapes1It(faultyShapes1);
+        for (; faultyShapes1It.More(); faultyShapes1It.Next()) {
+            const TopoDS_Shape& faultyShape = faultyShapes1It.Value();
+            str << "Error in " << shapeEnumToString[faultyShape.ShapeType()] << ": ";
+            str << bopEnumToString[current.GetCheckStatus()] << std::endl;
         }
-        else if (runBopCheck) {
+    }
+    return false;
+}
+}  // namespace
 
-            TopoDS_Shape BOPCopy = BRepBuilderAPI_Copy(this->_Shape).Shape();
-            BOPAlgo_ArgumentAnalyzer BOPCheck;
-            BOPCheck.SetShape1(BOPCopy);
-            // all settings are false by default. so only turn on what we want.
-            BOPCheck.ArgumentTypeMode() = true;
-            BOPCheck.SelfInterMode() = true;
-            BOPCheck.SmallEdgeMode() = true;
-            BOPCheck.RebuildFaceMode() = true;
-            BOPCheck.ContinuityMode() = true;
-            BOPCheck.SetParallelMode(true);  // this doesn't help for speed right now(occt 6.9.1).
-            BOPCheck.SetRunParallel(true);   // performance boost, use all available cores
-            BOPCheck.TangentMode() = true;   // these 4 new tests add about 5% processing time.
-            BOPCheck.MergeVertexMode() = true;
-            BOPCheck.CurveOnSurfaceMode() = true;
-            BOPCheck.MergeEdgeMode() = true;
-            BOPCheck.Perform();
-            if (!BOPCheck.HasFaulty()) {
-                return true;
-            }
+bool TopoShape::isValid() const
+{
+    initCache();
+    auto& validity = _cache->getValidity();
+    if (validity.valid < 0) {
+        // stop at the first invalid part
+        bool complete {};
+        auto report = [](int, const TopoDS_Shape&, bool valid) {
+            return valid;
+        };
+        validity.valid = checkValidity(this->_Shape, report, complete) ? 1 : 0;
+    }
+    return validity.valid != 0;
+}
 
-            str << "BOP check found the following errors:" << std::endl;
-            static std::vector<std::string> shapeEnumToString = buildShapeEnumVector();
-            static std::vector<std::string> bopEnumToString = buildBOPCheckResultVector();
-            const BOPAlgo_ListOfCheckResult& BOPResults = BOPCheck.GetCheckResult();
-            BOPAlgo_ListIteratorOfListOfCheckResult BOPResultsIt(BOPResults);
-            for (; BOPResultsIt.More(); BOPResultsIt.Next()) {
-                const BOPAlgo_CheckResult& current = BOPResultsIt.Value();
-
-                const TopTools_ListOfShape& faultyShapes1 = current.GetFaultyShapes1();
-                TopTools_ListIteratorOfListOfShape faultyShapes1It(faultyShapes1);
-                for (; faultyShapes1It.More(); faultyShapes1It.Next()) {
-                    const TopoDS_Shape& faultyShape = faultyShapes1It.Value();
-                    str << "Error in " << shapeEnumToString[faultyShape.ShapeType()] << ": ";
-                    str << bopEnumToString[current.GetCheckStatus()] << std::endl;
-                }
+bool TopoShape::isValid(const ValidityReport& report) const
+{
+    initCache();
+    auto& validity = _cache->getValidity();
+    if (validity.valid > 0) {
+        // all parts are known to be valid
+        std::vector<TopoDS_Shape> parts = getCheckParts(this->_Shape);
+        for (int i = 0; i < static_cast<int>(parts.size()); ++i) {
+            if (!report(i, parts[i], true)) {
+                return false;
             }
-            return false;
         }
+        return true;
     }
-    return true;
+
+    bool complete {};
+    bool valid = checkValidity(this->_Shape, report, complete);
+    // an invalid part is a final result even if the check was stopped
+    if (complete || !valid) {
+        validity.valid = valid ? 1 : 0;
+    }
+    return valid && complete;
+}
+
+bool TopoShape::analyze(bool runBopCheck, std::ostream& str) const
+{
+    if (this->_Shape.IsNull()) {
+        return true;
+    }
+    // The results are kept with the shape, checking it again only repeats the report
+    initCache();
+    auto& validity = _cache->getValidity();
+    int index = runBopCheck ? 1 : 0;
+    if (validity.analyzed[index] < 0) {
+        std::ostringstream report;
+        bool valid = isValid();
+        if (!valid) {
+            reportInvalid(this->_Shape, report);
+        }
+        else if (runBopCheck) {
+            valid = checkBop(this->_Shape, report);
+        }
+        validity.analyzed[index] = valid ? 1 : 0;
+        validity.reports[index] = report.str();
+    }
+    str << validity.reports[index];
+    return validity.analyzed[index] != 0;
 }
 
 bool TopoShape::isClosed() const
@@ -1968,11 +2105,8 @@ std::list<TopoDS_Wire> TopoShape::slice(const Base::Vector3d& dir, double d) con
 
 TopoDS_Compound TopoShape::slices(const Base::Vector3d& dir, const std::vector<double>& d) const
 {
-    std::vector<std::list<TopoDS_Wire>> wire_list;
     CrossSection cs(dir.x, dir.y, dir.z, this->_Shape);
-    for (double jt : d) {
-        wire_list.push_back(cs.slice(jt));
-    }
+    std::vector<std::list<TopoDS_Wire>> wire_list = cs.slices(d);
 
     std::vector<std::list<TopoDS_Wire>>::const_iterator ft;
     TopoDS_Compound comp;
@@ -3662,14 +3796,7 @@ void TopoShape::
     }
 
     // get the meshes of all faces and then merge them
-    BRepMesh_IncrementalMesh aMesh(
-        this->_Shape,
-        accuracy,
-        /*isRelative*/ Standard_False,
-        /*theAngDeflection*/
-        defaultAngularDeflection(accuracy),
-        /*isInParallel*/ true
-    );
+    TessellationCache::instance().mesh(this->_Shape, accuracy, defaultAngularDeflection(accuracy));
     std::vector<Domain> domains;
     getDomains(domains);
     getFacesFromDomains(domains, aPoints, aTopo);
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <functional>
 #include <iosfwd>
 #include <list>
 #include <unordered_map>
@@ -527,7 +528,17 @@ public:
     /** @name Query*/
     //@{
     bool isNull() const;
+    /// Checks the validity of the shape, the result is kept until the shape is changed.
+    /// The children of compounds are checked separately and in parallel.
     bool isValid() const;
+    /// Gets the index, the shape and the validity of a checked part. Returning false stops
+    /// the check.
+    using ValidityReport = std::function<bool(int, const TopoDS_Shape&, bool)>;
+    /// Checks the validity like isValid() but doesn't stop at the first invalid part. The
+    /// result of each part, i.e. of each child of a compound or of the shape itself, is
+    /// passed to \a report as soon as its batch is done. Returns false if a part is invalid
+    /// or if the check was stopped.
+    bool isValid(const ValidityReport& report) const;
     bool isEmpty() const;
     bool analyze(bool runBopCheck, std::ostream&) const;
     bool isClosed() const;
@@ -22,6 +22,15 @@
  *                                                                          *
  ***************************************************************************/
 
+#include <limits>
+
+#include <BRep_TEdge.hxx>
+#include <BRep_Tool.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_Version.hxx>
+
+#include <Base/Tools.h>
+
 #include "TopoShapeCache.h"
 
 using namespace Part;
@@ -185,6 +194,78 @@ bool TopoShapeCache::isTouched(const TopoDS_Shape& tds) const
     return !this->shape.IsPartner(tds) || this->shape.Orientation() != tds.Orientation();
 }
 
+// Combines everything of the shape that BRepCheck looks at and that may be changed in place,
+// i.e. the sub-shapes, their locations and orientations, tolerances, flags and geometries
+static void addValidityStamp(const TopoDS_Shape& shape, std::size_t& seed)
+{
+#if OCC_VERSION_HEX >= 0x070800
+    Base::hash_combine(seed, std::hash<TopoDS_Shape> {}(shape));
+#else
+    Base::hash_combine(seed, shape.HashCode(std::numeric_limits<int>::max()));
+#endif
+    Base::hash_combine(seed, static_cast<int>(shape.Orientation()));
+    switch (shape.ShapeType()) {
+        case TopAbs_VERTEX: {
+            const auto& vertex = TopoDS::Vertex(shape);
+            gp_Pnt pnt = BRep_Tool::Pnt(vertex);
+            Base::hash_combine(seed, BRep_Tool::Tolerance(vertex));
+            Base::hash_combine(seed, pnt.X());
+            Base::hash_combine(seed, pnt.Y());
+            Base::hash_combine(seed, pnt.Z());
+            break;
+        }
+        case TopAbs_EDGE: {
+            const auto& edge = TopoDS::Edge(shape);
+            double first {}, last {};
+            BRep_Tool::Range(edge, first, last);
+            Base::hash_combine(seed, BRep_Tool::Tolerance(edge));
+            Base::hash_combine(seed, first);
+            Base::hash_combine(seed, last);
+            Base::hash_combine(seed, BRep_Tool::SameParameter(edge));
+            Base::hash_combine(seed, BRep_Tool::SameRange(edge));
+            Base::hash_combine(seed, BRep_Tool::Degenerated(edge));
+            auto tedge = Handle(BRep_TEdge)::DownCast(edge.TShape());
+            if (!tedge.IsNull()) {
+                Base::hash_combine(seed, tedge->Curves().Extent());
+            }
+            break;
+        }
+        case TopAbs_FACE: {
+            const auto& face = TopoDS::Face(shape);
+            TopLoc_Location loc;
+            const auto& surface = BRep_Tool::Surface(face, loc);
+            Base::hash_combine(seed, BRep_Tool::Tolerance(face));
+            Base::hash_combine(seed, BRep_Tool::NaturalRestriction(face));
+            Base::hash_combine(seed, static_cast<const void*>(surface.get()));
+            break;
+        }
+        default:
+            break;
+    }
+    for (TopoDS_Iterator it(shape, Standard_False, Standard_False); it.More(); it.Next()) {
+        addValidityStamp(it.Value(), seed);
+    }
+}
+
+std::size_t TopoShapeCache::getStamp(const TopoDS_Shape& shape)
+{
+    std::size_t stamp = 0;
+    if (!shape.IsNull()) {
+        addValidityStamp(shape, stamp);
+    }
+    return stamp;
+}
+
+TopoShapeCache::Validity& TopoShapeCache::getValidity()
+{
+    std::size_t stamp = getStamp(shape);
+    if (stamp != validity.stamp) {
+        validity = Validity();
+        validity.stamp = stamp;
+    }
+    return validity;
+}
+
 TopoShapeCache::Ancestry& TopoShapeCache::getAncestry(TopAbs_ShapeEnum type)
 {
     auto& ancestry = shapeAncestryCache.at(type);
@@ -228,6 +309,70 @@ TopoDS_Shape TopoShapeCache::findShape(const TopoDS_Shape& parent, TopAbs_ShapeE
     return {};
 }
 
+const TopoShapeCache::Incidence& TopoShapeCache::getIncidence(
+    TopAbs_ShapeEnum subType,
+    TopAbs_ShapeEnum type
+)
+{
+    auto& ancestry = getAncestry(type);
+    auto& incidence = ancestry.incidences.at(subType);
+    if (incidence.initialized) {
+        return incidence;
+    }
+    incidence.initialized = true;
+    const auto& subShapes = getAncestry(subType).shapes;
+
+    if (!ancestry.occurrencesInitialized) {
+        ancestry.occurrencesInitialized = true;
+        for (TopExp_Explorer xp(shape, type); xp.More(); xp.Next()) {
+            ancestry.occurrences.push_back(xp.Current());
+            ancestry.occurrenceIndices.push_back(ancestry.shapes.FindIndex(xp.Current()));
+        }
+    }
+
+    // The sub-shapes of each ancestor are independent of each other, so collect them in
+    // parallel. The maps are only read here.
+    int count = ancestry.shapes.Extent();
+    std::vector<std::vector<int>> children(count);
+    OSD_Parallel::For(0, count, [&](int index) {
+        const TopoDS_Shape& ancestor = ancestry.shapes.FindKey(index + 1);
+        for (TopExp_Explorer xp(ancestor, subType); xp.More(); xp.Next()) {
+            int subIndex = subShapes.FindIndex(xp.Current());
+            if (subIndex > 0) {
+                children[index].push_back(subIndex);
+            }
+        }
+    });
+
+    incidence.childOffsets.reserve(count + 1);
+    incidence.childOffsets.push_back(0);
+    for (const auto& subIndices : children) {
+        incidence.children.insert(incidence.children.end(), subIndices.begin(), subIndices.end());
+        incidence.childOffsets.push_back(int(incidence.children.size()));
+    }
+
+    // Invert the relation in the order of the explored ancestors, which is the order of
+    // TopExp::MapShapesAndAncestors()
+    auto& offsets = incidence.ancestorOffsets;
+    offsets.assign(subShapes.Extent() + 1, 0);
+    for (int index : ancestry.occurrenceIndices) {
+        for (int subIndex : children[index - 1]) {
+            ++offsets[subIndex];
+        }
+    }
+    for (std::size_t i = 1; i < offsets.size(); ++i) {
+        offsets[i] += offsets[i - 1];
+    }
+    incidence.ancestors.resize(offsets.back());
+    std::vector<int> next(offsets.begin(), offsets.end() - 1);
+    for (int occurrence = 0; occurrence < int(ancestry.occurrenceIndices.size()); ++occurrence) {
+        for (int subIndex : children[ancestry.occurrenceIndices[occurrence] - 1]) {
+            incidence.ancestors[next[subIndex - 1]++] = occurrence;
+        }
+    }
+    return incidence;
+}
+
 TopoDS_Shape TopoShapeCache::findAncestor(
     const TopoDS_Shape& parent,
     const TopoDS_Shape& subShape,
@@ -240,30 +385,51 @@ TopoDS_Shape TopoShapeCache::findAncestor(
         return nullShape;
     }
 
-    auto& info = getAncestry(type);
-
-    auto& ancestorInfo = info.ancestors.at(subShape.ShapeType());
-    if (!ancestorInfo.initialized) {
-        ancestorInfo.initialized = true;
-        // ancestorInfo.shapes is the output variable here, storing (and caching) the actual map
-        TopExp::MapShapesAndAncestors(shape, subShape.ShapeType(), type, ancestorInfo.shapes);
-    }
-    int index = parent.Location().IsIdentity()
-        ? ancestorInfo.shapes.FindIndex(subShape)
-        : ancestorInfo.shapes.FindIndex(info.stripLocation(parent, subShape));
+    const auto& incidence = getIncidence(subShape.ShapeType(), type);
+    const auto& occurrences = getAncestry(type).occurrences;
+    int index = findShape(parent, subShape);
     if (index == 0) {
         return nullShape;
     }
-    const auto& shapes = ancestorInfo.shapes.FindFromIndex(index);
-    if (shapes.Extent() == 0) {
+    int begin = incidence.ancestorOffsets[index - 1];
+    int end = incidence.ancestorOffsets[index];
+    if (begin == end) {
         return nullShape;
     }
 
     if (ancestors) {
-        ancestors->reserve(ancestors->size() + shapes.Extent());
-        for (TopTools_ListIteratorOfListOfShape it(shapes); it.More(); it.Next()) {
-            ancestors->push_back(TopoShape::moved(it.Value(), parent.Location()));
+        ancestors->reserve(ancestors->size() + end - begin);
+        for (int i = begin; i < end; ++i) {
+            ancestors->push_back(
+                TopoShape::moved(occurrences[incidence.ancestors[i]], parent.Location())
+            );
         }
     }
-    return TopoShape::moved(shapes.First(), parent.Location());
+    return TopoShape::moved(occurrences[incidence.ancestors[begin]], parent.Location());
+}
+
+std::vector<int> TopoShapeCache::findAncestors(
+    const TopoDS_Shape& parent,
+    const TopoDS_Shape& subShape,
+    TopAbs_ShapeEnum type
+)
+{
+    std::vector<int> res;
+    if (shape.IsNull() || subShape.IsNull() || type == TopAbs_SHAPE) {
+        return res;
+    }
+
+    const auto& incidence = getIncidence(subShape.ShapeType(), type);
+    const auto& indices = getAncestry(type).occurrenceIndices;
+    int index = findShape(parent, subShape);
+    if (index == 0) {
+        return res;
+    }
+    int begin = incidence.ancestorOffsets[index - 1];
+    int end = incidence.ancestorOffsets[index];
+    res.reserve(end - begin);
+    for (int i = begin; i < end; ++i) {
+        res.push_back(indices[incidence.ancestors[i]]);
+    }
+    return res;
 }
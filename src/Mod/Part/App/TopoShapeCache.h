@@ -33,7 +33,10 @@
 #include <TopExp_Explorer.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
+#include <array>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <App/ElementMap.h>
 
@@ -76,10 +79,26 @@ public:
     /// Inverse of location
     TopLoc_Location locationInverse;
 
-    struct PartExport AncestorInfo
+    /// Flat incidence between the sub-shapes of one type and their ancestors of another type,
+    /// stored as compressed rows of indices. Like TopExp::MapShapesAndAncestors(), a shape is
+    /// listed as often as TopExp_Explorer finds it, e.g. a face twice for its seam edge.
+    struct PartExport Incidence
     {
         bool initialized = false;
-        TopTools_IndexedDataMapOfShapeListOfShape shapes;
+
+        /// The ancestors of the sub-shape with index i are stored in
+        /// ancestors[ancestorOffsets[i - 1]] ... ancestors[ancestorOffsets[i] - 1]
+        std::vector<int> ancestorOffsets;
+
+        /// Zero-based indices into Ancestry::occurrences of the ancestor type
+        std::vector<int> ancestors;
+
+        /// The sub-shapes of the ancestor with index i are stored in
+        /// children[childOffsets[i - 1]] ... children[childOffsets[i] - 1]
+        std::vector<int> childOffsets;
+
+        /// One-based indices into Ancestry::shapes of the sub-shape type
+        std::vector<int> children;
     };
 
     /// Class for caching the ancestor and children shapes mapping
@@ -95,11 +114,16 @@ public:
         /// One-to-one corresponding TopoShape to each child TopoDS_Shape
         std::vector<TopoShape> topoShapes;
 
-        /// Caches the OCCT ancestor shape maps, e.g.
-        ///     Cache::shapeAncestryCache[TopAbs_FACE].ancestors[TopAbs_EDGE]
-        /// stores an OCCT TopTools_IndexedDataMapOfShapeListOfShape that can return a list of
-        /// faces containing a given edge.
-        std::array<AncestorInfo, TopAbs_SHAPE + 1> ancestors;
+        /// Every occurrence of a shape of this type in the order of TopExp_Explorer, and the
+        /// index of each occurrence in shapes. Filled on the first use of an Incidence.
+        std::vector<TopoDS_Shape> occurrences;
+        std::vector<int> occurrenceIndices;
+        bool occurrencesInitialized = false;
+
+        /// Caches the incidence to the sub-shapes of each type, e.g.
+        ///     Cache::shapeAncestryCache[TopAbs_FACE].incidences[TopAbs_EDGE]
+        /// lists the faces containing a given edge and the edges of a given face.
+        std::array<Incidence, TopAbs_SHAPE + 1> incidences;
 
         TopoShape _getTopoShape(const TopoShape& parent, int index);
 
@@ -124,10 +148,12 @@ public:
     int findShape(const TopoDS_Shape& parent, const TopoDS_Shape& subShape);
     TopoDS_Shape findShape(const TopoDS_Shape& parent, TopAbs_ShapeEnum type, int index);
 
-    /// Given a parent shape and a child (sub) shape, call TopExp::MapShapesAndAncestors and cache
-    /// the result. Subsequent calls to this method given unchanged geometry will use the cached
-    /// data rather than re-running MapShapesAndAncestors.
-    /// If ancestors is given, it is cleared and overwritten with the ancestry data.
+    /// Returns the incidence between the sub-shapes of subType and their ancestors of type. It's
+    /// built once for the cached shape and then shared by all TopoShapes using this cache.
+    const Incidence& getIncidence(TopAbs_ShapeEnum subType, TopAbs_ShapeEnum type);
+
+    /// Given a parent shape and a child (sub) shape, return the first ancestor of the given type
+    /// using the cached incidence. If ancestors is given, all ancestors are appended to it.
     TopoDS_Shape findAncestor(
         const TopoDS_Shape& parent,
         const TopoDS_Shape& subShape,
@@ -135,12 +161,43 @@ public:
         std::vector<TopoDS_Shape>* ancestors = nullptr
     );
 
+    /// Returns the one-based indices of all ancestors of the given type of the child shape
+    std::vector<int> findAncestors(
+        const TopoDS_Shape& parent,
+        const TopoDS_Shape& subShape,
+        TopAbs_ShapeEnum type
+    );
+
     /// Ancestor and children shape caches of all shape types. Note that
     /// shapeAncestryCache[TopAbs_SHAPE] is also valid and stores the direct children of a
     /// compound shape.
     std::array<Ancestry, TopAbs_SHAPE + 1> shapeAncestryCache;
 
     std::map<ShapeRelationKey, QVector<Data::MappedElement>> relations;
+
+    /// Results of checking the validity of the shape, see TopoShape::isValid() and analyze()
+    struct PartExport Validity
+    {
+        /// Fingerprint of the shape when it was checked
+        std::size_t stamp = 0;
+        /// 1 if the shape is valid, 0 if not and -1 if it wasn't checked
+        int valid = -1;
+        /// Results and reports of TopoShape::analyze() without and with BOP check
+        std::array<int, 2> analyzed {-1, -1};
+        std::array<std::string, 2> reports;
+    };
+
+    /**
+     * Returns the validity check results of the shape. They are reset if the shape was changed
+     * in place since, e.g. if the tolerances were updated or sub-shapes were added.
+     */
+    Validity& getValidity();
+
+    /// Returns a fingerprint of everything of \a shape that may be changed in place
+    static std::size_t getStamp(const TopoDS_Shape& shape);
+
+private:
+    Validity validity;
 };
 
 }  // namespace Part
@@ -49,6 +49,7 @@
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Fuse.h>
+#include <Mod/Part/App/FCBRepAlgoAPI_ParallelFuse.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Section.h>
 #include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_FindPlane.hxx>
@@ -101,6 +102,8 @@
 #include "Geometry.h"
 #include "BRepOffsetAPI_MakeOffsetFix.h"
 #include "ProgressIndicator.h"
+#include "FuzzyHelper.h"
+#include "OperationCache.h"
 
 #include <App/ElementMap.h>
 #include <App/ElementNamingUtils.h>
@@ -704,13 +707,8 @@ TopoDS_Shape TopoShape::findAncestorShape(const TopoDS_Shape& subshape, TopAbs_S
 
 std::vector<int> TopoShape::findAncestors(const TopoDS_Shape& subshape, TopAbs_ShapeEnum type) const
 {
-    const auto& shapes = findAncestorsShapes(subshape, type);
-    std::vector<int> ret;
-    ret.reserve(shapes.size());
-    for (const auto& shape : shapes) {
-        ret.push_back(findShape(shape));
-    }
-    return ret;
+    initCache();
+    return _cache->findAncestors(_Shape, subshape, type);
 }
 
 std::vector<TopoDS_Shape> TopoShape::findAncestorsShapes(
@@ -4092,10 +4090,7 @@ TopoShape& TopoShape::makeElementSlices(
 {
     std::vector<TopoShape> wires;
     TopoCrossSection cs(dir.x, dir.y, dir.z, shape, op);
-    int index = 0;
-    for (auto& distance : distances) {
-        cs.slice(++index, distance, wires);
-    }
+    cs.slices(distances, wires);
     return makeElementCompound(wires, op, SingleShapeCompoundCreationPolicy::returnShape);
 }
 
@@ -4172,7 +4167,24 @@ TopoShape& TopoShape::makeElementFillet(
         }
         mkFillet.Add(radius1, radius2, TopoDS::Edge(edge));
     }
-    return makeElementShape(mkFillet, shape, op);
+
+    auto& cache = OperationCache::instance();
+    std::string key;
+    std::vector<TopoShape> sources(1, shape);
+    if (cache.isEnabled()) {
+        std::ostringstream params;
+        params.precision(17);
+        params << radius1 << ';' << radius2;
+        for (auto& e : edges) {
+            params << ';' << shape.findShape(e.getShape());
+        }
+        key = cache.makeKey(Part::OpCodes::Fillet, sources, params.str());
+    }
+    if (cache.restore(key, *this, sources, op)) {
+        return *this;
+    }
+    cache.store(key, mkFillet.Shape(), MapperMaker(mkFillet), sources);
+    return makeElementShape(mkFillet, sources, op);
 }
 
 TopoShape& TopoShape::makeElementChamfer(
@@ -4595,8 +4607,21 @@ TopoShape& TopoShape::makeElementPrism(const TopoShape& base, const gp_Vec& vec,
     if (base.isNull()) {
         FC_THROWM(NullShapeException, "Null shape");
     }
+    auto& cache = OperationCache::instance();
+    std::string key;
+    std::vector<TopoShape> sources(1, base);
+    if (cache.isEnabled()) {
+        std::ostringstream params;
+        params.precision(17);
+        params << vec.X() << ';' << vec.Y() << ';' << vec.Z();
+        key = cache.makeKey(Part::OpCodes::Extrude, sources, params.str());
+    }
+    if (cache.restore(key, *this, sources, op)) {
+        return *this;
+    }
     BRepPrimAPI_MakePrism mkPrism(base.getShape(), vec);
-    return makeElementShape(mkPrism, base, op);
+    cache.store(key, mkPrism.Shape(), MapperMaker(mkPrism), sources);
+    return makeElementShape(mkPrism, sources, op);
 }
 
 TopoShape& TopoShape::makeElementPrismUntil(
@@ -6179,6 +6204,21 @@ TopoShape& TopoShape::makeElementBoolean(
         FC_THROWM(Base::CADKernelError, "Unknown maker");
     }
 
+    auto& cache = OperationCache::instance();
+    std::string key;
+    if (cache.isEnabled()) {
+        std::ostringstream params;
+        params.precision(17);
+        params << tolerance << ';' << FuzzyHelper::getBooleanFuzzy();
+        key = cache.makeKey(maker, inputs, params.str());
+    }
+    if (cache.restore(key, *this, inputs, op, elementMapPolicy)) {
+        if (buildShell) {
+            makeElementShell(true, nullptr, elementMapPolicy);
+        }
+        return *this;
+    }
+
     TopTools_ListOfShape shapeArguments, shapeTools;
 
     int i = -1;
@@ -6209,26 +6249,51 @@ TopoShape& TopoShape::makeElementBoolean(
         }
     }
 
-    mk->SetRunParallel(Standard_True);
     OSD_Parallel::SetUseOcctThreads(Standard_True);
 
-    mk->SetArguments(shapeArguments);
-    mk->SetTools(shapeTools);
-    if (tolerance > 0.0) {
-        mk->SetFuzzyValue(tolerance);
+    // Many shapes to fuse are split in groups of overlapping shapes that are fused concurrently.
+    // The combined history gives the same element names as a single fuse.
+    std::unique_ptr<FCBRepAlgoAPI_ParallelFuse> mkFuse;
+    if (strcmp(maker, Part::OpCodes::Fuse) == 0
+        && inputs.size() >= FCBRepAlgoAPI_ParallelFuse::MinShapes) {
+        TopTools_ListOfShape fuseShapes(shapeArguments);
+        for (TopTools_ListOfShape::Iterator it(shapeTools); it.More(); it.Next()) {
+            fuseShapes.Append(it.Value());
+        }
+        mkFuse = std::make_unique<FCBRepAlgoAPI_ParallelFuse>();
+        mkFuse->SetShapes(fuseShapes);
+        if (tolerance > 0.0) {
+            mkFuse->SetFuzzyValue(tolerance);
+        }
+        else if (tolerance < 0.0) {
+            mkFuse->setAutoFuzzy();
+        }
     }
-    else if (tolerance < 0.0) {
-        FCBRepAlgoAPIHelper::setAutoFuzzy(mk.get());
+    else {
+        mk->SetRunParallel(Standard_True);
+        mk->SetArguments(shapeArguments);
+        mk->SetTools(shapeTools);
+        if (tolerance > 0.0) {
+            mk->SetFuzzyValue(tolerance);
+        }
+        else if (tolerance < 0.0) {
+            FCBRepAlgoAPIHelper::setAutoFuzzy(mk.get());
+        }
     }
+    BRepBuilderAPI_MakeShape& mkShape = mkFuse ? static_cast<BRepBuilderAPI_MakeShape&>(*mkFuse)
+                                               : *mk;
 #if OCC_VERSION_HEX >= 0x070600
-    mk->Build(std::make_unique<Part::ProgressIndicator>()->Start());
+    mkShape.Build(std::make_unique<Part::ProgressIndicator>()->Start());
 #else
-    mk->Build();
+    mkShape.Build();
 #endif
     if (Base::Sequencer().wasCanceled()) {
         FC_THROWM(Base::CADKernelError, "User aborted");
     }
-    makeElementShape(*mk, inputs, op, elementMapPolicy);
+    if (mkShape.IsDone()) {
+        cache.store(key, mkShape.Shape(), MapperMaker(mkShape), inputs);
+    }
+    makeElementShape(mkShape, inputs, op, elementMapPolicy);
 
     if (buildShell) {
         makeElementShell(true, nullptr, elementMapPolicy);
@@ -22,6 +22,7 @@
  *                                                                          *
  ****************************************************************************/
 
+#include <exception>
 #include <limits>
 
 #include <boost/core/ignore_unused.hpp>
@@ -54,6 +55,7 @@
 #include <TopExp_Explorer.hxx>
 #include <TopTools_HSequenceOfShape.hxx>
 #include <IntRes2d_SequenceOfIntersectionPoint.hxx>
+#include <OSD_Parallel.hxx>
 #include <TColStd_SequenceOfReal.hxx>
 #include <TColgp_SequenceOfPnt.hxx>
 
@@ -1051,7 +1053,36 @@ public:
         }
     };
 
-    void checkSelfIntersection(const EdgeInfo& info, std::set<IntersectInfo>& params) const
+    // An intersection found on the first (onOther false) or second edge of a pair, kept in the
+    // order it was found
+    struct IntersectRecord
+    {
+        bool onOther;
+        double param;
+        gp_Pnt point;
+    };
+
+    // The part of an edge used to check intersections. It holds a copy of the edge, so that
+    // several checks can run at the same time, because building a wire or face may update the
+    // tolerances of the edge in place.
+    struct CheckEdge
+    {
+        TopoDS_Edge edge;
+        gp_Pnt p1;
+        gp_Pnt p2;
+        GeomAbs_CurveType type;
+        bool isLinear;
+
+        explicit CheckEdge(const EdgeInfo& info)
+            : edge(TopoDS::Edge(BRepBuilderAPI_Copy(info.edge, Standard_False).Shape()))
+            , p1(info.p1)
+            , p2(info.p2)
+            , type(info.type)
+            , isLinear(info.isLinear)
+        {}
+    };
+
+    void checkSelfIntersection(const CheckEdge& info, std::vector<IntersectRecord>& records) const
     {
         // Early return if checking for self intersection (only for non linear spline curves)
         if (info.type <= GeomAbs_Parabola || info.isLinear) {
@@ -1083,27 +1114,27 @@ public:
 
         ENSURE(points2d.Length() == points3d.Length());
         for (int i = 1; i <= points2d.Length(); ++i) {
-            params.emplace(points2d(i).ParamOnFirst(), points3d(i), info.edge);
-            params.emplace(points2d(i).ParamOnSecond(), points3d(i), info.edge);
+            records.push_back({false, points2d(i).ParamOnFirst(), points3d(i)});
+            records.push_back({false, points2d(i).ParamOnSecond(), points3d(i)});
         }
     }
 
     // This method was originally part of WireJoinerP::checkIntersection(), split to reduce
     // cognitive complexity
     bool checkIntersectionPlanar(
-        const EdgeInfo& info,
-        const EdgeInfo& other,
-        std::set<IntersectInfo>& params1,
-        std::set<IntersectInfo>& params2
-    )
+        const CheckEdge& info,
+        const CheckEdge& other,
+        std::vector<IntersectRecord>& records
+    ) const
     {
         gp_Pln pln;
         bool planar = TopoShape(info.edge).findPlane(pln);
         if (!planar) {
+            BRep_Builder compBuilder;
             TopoDS_Compound comp;
-            builder.MakeCompound(comp);
-            builder.Add(comp, info.edge);
-            builder.Add(comp, other.edge);
+            compBuilder.MakeCompound(comp);
+            compBuilder.Add(comp, info.edge);
+            compBuilder.Add(comp, other.edge);
             planar = TopoShape(comp).findPlane(pln);
             if (!planar) {
                 BRepExtrema_DistShapeShape extss(info.edge, other.edge);
@@ -1119,11 +1150,11 @@ public:
                     auto s2 = extss.SupportOnShape2(i);
                     if (s1.ShapeType() == TopAbs_EDGE) {
                         extss.ParOnEdgeS1(i, par);
-                        pushIntersection(params1, par, extss.PointOnShape1(i), other.edge);
+                        records.push_back({false, par, extss.PointOnShape1(i)});
                     }
                     if (s2.ShapeType() == TopAbs_EDGE) {
                         extss.ParOnEdgeS2(i, par);
-                        pushIntersection(params2, par, extss.PointOnShape2(i), info.edge);
+                        records.push_back({true, par, extss.PointOnShape2(i)});
                     }
                 }
                 return false;
@@ -1162,8 +1193,8 @@ public:
     // This method was originally part of WireJoinerP::checkIntersection(), split to reduce
     // cognitive complexity
     static bool checkIntersectionMakeWire(
-        const EdgeInfo& info,
-        const EdgeInfo& other,
+        const CheckEdge& info,
+        const CheckEdge& other,
         int& idx,
         TopoDS_Wire& wire
     )
@@ -1219,13 +1250,12 @@ public:
     }
 
     void checkIntersection(
-        const EdgeInfo& info,
-        const EdgeInfo& other,
-        std::set<IntersectInfo>& params1,
-        std::set<IntersectInfo>& params2
-    )
+        const CheckEdge& info,
+        const CheckEdge& other,
+        std::vector<IntersectRecord>& records
+    ) const
     {
-        if (!checkIntersectionPlanar(info, other, params1, params2)) {
+        if (!checkIntersectionPlanar(info, other, records)) {
             return;
         }
 
@@ -1256,8 +1286,8 @@ public:
 
         ENSURE(points2d.Length() == points3d.Length());
         for (int i = 1; i <= points2d.Length(); ++i) {
-            pushIntersection(params1, points2d(i).ParamOnFirst(), points3d(i), other.edge);
-            pushIntersection(params2, points2d(i).ParamOnSecond(), points3d(i), info.edge);
+            records.push_back({false, points2d(i).ParamOnFirst(), points3d(i)});
+            records.push_back({true, points2d(i).ParamOnSecond(), points3d(i)});
         }
     }
 
@@ -1362,24 +1392,82 @@ public:
             info.iteration = ++idx;
         }
 
-        std::unique_ptr<Base::SequencerLauncher> seq(
-            new Base::SequencerLauncher("Splitting edges", edges.size())
-        );
-
+        // Collect the edges whose bounding boxes overlap, each pair once
+        std::vector<EdgeInfo*> infos;
+        std::vector<std::vector<EdgeInfo*>> others;
+        infos.reserve(edges.size());
+        others.reserve(edges.size());
         idx = 0;
         for (auto& info : edges) {
-            seq->next(true);
             ++idx;
-            auto& params = intersects[&info];
-            checkSelfIntersection(info, params);
-
+            infos.push_back(&info);
+            others.emplace_back();
             for (auto vit = boxMap.qbegin(bgi::intersects(info.box)); vit != boxMap.qend(); ++vit) {
-                const auto& other = *(*vit);
+                auto& other = *(*vit);
                 if (other.iteration <= idx) {
                     // means the edge is before us, and we've already checked intersection
                     continue;
                 }
-                checkIntersection(info, other, params, intersects[&other]);
+                others.back().push_back(&other);
+            }
+        }
+
+        // The checks are independent, so run them concurrently and keep what they find per edge.
+        // They run in batches so that the progress is updated and an abort is checked for in
+        // between, and the intersections are merged in the order they would have been found one
+        // by one.
+        std::unique_ptr<Base::SequencerLauncher> seq(
+            new Base::SequencerLauncher("Splitting edges", edges.size())
+        );
+
+        int count = static_cast<int>(infos.size());
+        int batchSize = 4 * std::max(1, OSD_Parallel::NbLogicalProcessors());
+        std::vector<std::vector<IntersectRecord>> selfRecords(batchSize);
+        std::vector<std::vector<std::vector<IntersectRecord>>> pairRecords(batchSize);
+        std::vector<std::exception_ptr> errors(batchSize);
+        for (int start = 0; start < count; start += batchSize) {
+            int end = std::min(count, start + batchSize);
+            OSD_Parallel::For(start, end, [&](int i) {
+                int slot = i - start;
+                selfRecords[slot].clear();
+                pairRecords[slot].clear();
+                errors[slot] = nullptr;
+                try {
+                    CheckEdge info(*infos[i]);
+                    checkSelfIntersection(info, selfRecords[slot]);
+                    pairRecords[slot].resize(others[i].size());
+                    for (std::size_t j = 0; j < others[i].size(); ++j) {
+                        checkIntersection(info, CheckEdge(*others[i][j]), pairRecords[slot][j]);
+                    }
+                }
+                catch (...) {
+                    errors[slot] = std::current_exception();
+                }
+            });
+
+            for (int i = start; i < end; ++i) {
+                int slot = i - start;
+                seq->next(true);
+                if (errors[slot]) {
+                    std::rethrow_exception(errors[slot]);
+                }
+                auto& info = *infos[i];
+                auto& params = intersects[&info];
+                for (const auto& record : selfRecords[slot]) {
+                    params.emplace(record.param, record.point, info.edge);
+                }
+                for (std::size_t j = 0; j < others[i].size(); ++j) {
+                    auto& other = *others[i][j];
+                    auto& otherParams = intersects[&other];
+                    for (const auto& record : pairRecords[slot][j]) {
+                        if (record.onOther) {
+                            pushIntersection(otherParams, record.param, record.point, info.edge);
+                        }
+                        else {
+                            pushIntersection(params, record.param, record.point, other.edge);
+                        }
+                    }
+                }
             }
         }
 
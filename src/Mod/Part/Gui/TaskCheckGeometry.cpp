@@ -475,12 +475,13 @@ void TaskCheckGeometryResults::goCheck()
             baseStream << " (" << label.c_str() << ")";
         }
 
-        TopoDS_Shape shape = Part::Feature::getShape(
+        Part::TopoShape topoShape = Part::Feature::getTopoShape(
             sel.pObject,
             Part::ShapeOption::NeedSubElement | Part::ShapeOption::ResolveLink
                 | Part::ShapeOption::Transform,
             sel.SubName
         );
+        TopoDS_Shape shape = topoShape.getShape();
 
         if (shape.IsNull()) {
             ResultEntry* entry = new ResultEntry();
@@ -516,8 +517,19 @@ void TaskCheckGeometryResults::goCheck()
 
         buildShapeContent(sel.pObject, baseName, shape);
 
-        BRepCheck_Analyzer shapeCheck(shape);
-        if (!shapeCheck.IsValid()) {
+        // The validity is remembered with the shape and the children of compounds are checked
+        // in parallel. Only the invalid parts are analyzed in detail afterwards.
+        std::vector<TopoDS_Shape> invalidParts;
+        bool valid = topoShape.isValid([&](int, const TopoDS_Shape& part, bool partValid) {
+            if (!partValid) {
+                invalidParts.push_back(part);
+            }
+            return !theScope.UserBreak();
+        });
+        if (theScope.UserBreak()) {
+            break;
+        }
+        if (!valid) {
             invalidShapes++;
             localInvalidShapeCount++;
             ResultEntry* entry = new ResultEntry();
@@ -533,7 +545,10 @@ void TaskCheckGeometryResults::goCheck()
             entry->viewProviderRoot->ref();
             goSetupResultBoundingBox(entry);
             theRoot->children.push_back(entry);
-            recursiveCheck(shapeCheck, shape, entry);
+            for (const auto& part : invalidParts) {
+                BRepCheck_Analyzer partCheck(part);
+                recursiveCheck(partCheck, part, entry);
+            }
             continue;  // don't run BOPAlgo_ArgumentAnalyzer if BRepCheck_Analyzer finds something.
         }
         else {
@@ -28,7 +28,6 @@
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
-#include <BRepMesh_IncrementalMesh.hxx>
 #include <gp_Trsf.hxx>
 #include <Precision.hxx>
 #include <Poly_Array1OfTriangle.hxx>
@@ -84,6 +83,7 @@
 #include <Gui/Utilities.h>
 
 #include <Mod/Part/App/ShapeMapHasher.h>
+#include <Mod/Part/App/TessellationCache.h>
 #include <Mod/Part/App/Tools.h>
 
 #include "ViewProviderExt.h"
@@ -1040,7 +1040,8 @@ void ViewProviderPartExt::setupCoinGeometry(
     SoBrepPointSet* nodeset,
     double deviation,
     double angularDeflection,
-    bool normalsFromUV
+    bool normalsFromUV,
+    const std::string& cacheDirectory
 )
 {
     if (Part::Tools::isShapeEmpty(shape)) {
@@ -1093,7 +1094,8 @@ void ViewProviderPartExt::setupCoinGeometry(
     BRepTools::Clean(shape, Standard_True);
 #endif
 
-    BRepMesh_IncrementalMesh(shape, meshParams);
+    // re-use the triangulation of an unchanged shape
+    Part::TessellationCache::instance().mesh(shape, meshParams, cacheDirectory);
 
     // We must reset the location here because the transformation data
     // are set in the placement property
@@ -1497,7 +1499,8 @@ void ViewProviderPartExt::updateVisual()
             nodeset,
             Deviation.getValue(),
             AngularDeflection.getValue(),
-            NormalsFromUV
+            NormalsFromUV,
+            Part::TessellationCache::directoryOf(pcObject ? pcObject->getDocument() : nullptr)
         );
 
         lastRenderedShape = shape;
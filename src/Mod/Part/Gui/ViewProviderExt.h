@@ -189,7 +189,8 @@ public:
         SoBrepPointSet* nodeset,
         double deviation,
         double angularDeflection,
-        bool normalsFromUV = false
+        bool normalsFromUV = false,
+        const std::string& cacheDirectory = {}
     );
 
     static void setupCoinGeometry(
@@ -26,6 +26,7 @@
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 
+#include "Filter.h"
 #include "Points.h"
 #include "PointsPy.h"
 #include "Properties.h"
@@ -58,6 +59,7 @@ PyMOD_INIT_FUNC(Points)
     // add data types
     Points::Feature                 ::init();
     Points::Structured              ::init();
+    Points::Filter                  ::init();
     Points::FeatureCustom           ::init();
     Points::StructuredCustom        ::init();
     Points::FeaturePython           ::init();
@@ -75,6 +75,15 @@ private:
 
         return std::make_tuple(useColor, checkState, minDistance);
     }
+    double readVoxelSize() const
+    {
+        Base::Reference<ParameterGrp> hGrp = App::GetApplication()
+                                                 .GetUserParameter()
+                                                 .GetGroup("BaseApp")
+                                                 ->GetGroup("Preferences")
+                                                 ->GetGroup("Mod/Points");
+        return hGrp->GetFloat("ImportVoxelSize", 0.0);
+    }
     Py::Object open(const Py::Tuple& args)
     {
         char* Name {};
@@ -115,6 +124,7 @@ private:
                 throw Py::RuntimeError("Unsupported file extension");
             }
 
+            reader->setVoxelSize(readVoxelSize());
             reader->read(EncodedName);
 
             App::Document* pcDoc = App::GetApplication().newDocument();
@@ -242,6 +252,7 @@ private:
                 throw Py::RuntimeError("Unsupported file extension");
             }
 
+            reader->setVoxelSize(readVoxelSize());
             reader->read(EncodedName);
 
             App::Document* pcDoc = App::GetApplication().getDocument(DocName);
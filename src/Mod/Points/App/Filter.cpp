@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <limits>
+
+#include "Filter.h"
+#include "PointsFilter.h"
+#include "Properties.h"
+#include "Tools.h"
+
+
+using namespace Points;
+
+namespace
+{
+const App::PropertyLength::Constraints floatRange = {0.0, std::numeric_limits<float>::max(), 1.0};
+const App::PropertyIntegerConstraint::Constraints intRange
+    = {1, std::numeric_limits<int>::max(), 1};
+const App::PropertyFloatConstraint::Constraints ratioRange = {0.0, 100.0, 0.1};
+}  // namespace
+
+PROPERTY_SOURCE(Points::Filter, Points::Feature)
+
+const char* Filter::MethodEnums[] = {
+    "VoxelGrid",
+    "RadiusOutlier",
+    "StatisticalOutlier",
+    "NormalSpace",
+    nullptr
+};
+
+Filter::Filter()
+{
+    ADD_PROPERTY_TYPE(Source, (nullptr), "Filter", App::Prop_None, "The point cloud to filter");
+    ADD_PROPERTY_TYPE(Method, (0L), "Filter", App::Prop_None, "The filter to apply");
+    ADD_PROPERTY_TYPE(VoxelSize, (1.0), "Filter", App::Prop_None, "Edge length of the voxels");
+    ADD_PROPERTY_TYPE(Radius, (1.0), "Filter", App::Prop_None, "Search radius for neighbours");
+    ADD_PROPERTY_TYPE(
+        MinNeighbours,
+        (2),
+        "Filter",
+        App::Prop_None,
+        "Minimum number of neighbours within the radius"
+    );
+    ADD_PROPERTY_TYPE(
+        Neighbours,
+        (8),
+        "Filter",
+        App::Prop_None,
+        "Number of neighbours for the mean distance"
+    );
+    ADD_PROPERTY_TYPE(
+        StdDevRatio,
+        (1.0),
+        "Filter",
+        App::Prop_None,
+        "Allowed deviation from the mean distance in multiples of the standard deviation"
+    );
+    ADD_PROPERTY_TYPE(Samples, (10000), "Filter", App::Prop_None, "Number of points to keep");
+    Method.setEnums(MethodEnums);
+    VoxelSize.setConstraints(&floatRange);
+    Radius.setConstraints(&floatRange);
+    MinNeighbours.setConstraints(&intRange);
+    Neighbours.setConstraints(&intRange);
+    StdDevRatio.setConstraints(&ratioRange);
+    Samples.setConstraints(&intRange);
+}
+
+short Filter::mustExecute() const
+{
+    if (Source.isTouched() || Method.isTouched() || VoxelSize.isTouched() || Radius.isTouched()
+        || MinNeighbours.isTouched() || Neighbours.isTouched() || StdDevRatio.isTouched()
+        || Samples.isTouched()) {
+        return 1;
+    }
+    if (Source.getValue() && Source.getValue()->isTouched()) {
+        return 1;
+    }
+    return 0;
+}
+
+App::DocumentObjectExecReturn* Filter::execute()
+{
+    auto source = freecad_cast<Points::Feature*>(Source.getValue());
+    if (!source) {
+        return new App::DocumentObjectExecReturn("No point cloud specified.\n");
+    }
+
+    const PointKernel& kernel = source->Points.getValue();
+    const std::vector<Base::Vector3f>& points = kernel.getBasicPoints();
+    PointsFilter filter(points);
+
+    std::vector<unsigned long> indices;
+    switch (Method.getValue()) {
+        case 0:
+            if (VoxelSize.getValue() <= 0.0) {
+                return new App::DocumentObjectExecReturn(
+                    "The voxel size must be greater than zero.\n"
+                );
+            }
+            indices = filter.VoxelGrid(VoxelSize.getValue());
+            break;
+        case 1:
+            indices = filter.RadiusOutliers(Radius.getValue(), MinNeighbours.getValue());
+            break;
+        case 2:
+            indices = filter.StatisticalOutliers(Neighbours.getValue(), StdDevRatio.getValue());
+            break;
+        case 3: {
+            auto normals = freecad_cast<PropertyNormalList*>(source->getPropertyByName("Normal"));
+            if (!normals || normals->getSize() != int(points.size())) {
+                return new App::DocumentObjectExecReturn("The point cloud has no normals.\n");
+            }
+            indices = filter.NormalSpaceSampling(normals->getValues(), Samples.getValue());
+        } break;
+        default:
+            return new App::DocumentObjectExecReturn("Unknown filter method.\n");
+    }
+
+    PointKernel result;
+    result.setBasicPoints(PointsFilter::Select(points, indices));
+    result.setTransform(kernel.getTransform());
+    this->Points.setValue(result);
+
+    selectProperty<PropertyGreyValueList>(this, source, "Intensity", indices);
+    selectProperty<App::PropertyColorList>(this, source, "Color", indices);
+    selectProperty<PropertyNormalList>(this, source, "Normal", indices);
+
+    return App::DocumentObject::StdReturn;
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <App/PropertyLinks.h>
+#include <App/PropertyStandard.h>
+#include <App/PropertyUnits.h>
+
+#include "PointsFeature.h"
+
+
+namespace Points
+{
+
+/*! The Filter class keeps a subset of the points of the Source object. Depending on Method the
+  cloud is downsampled to one point per voxel or to an evenly spread set of normals, or the
+  outliers are removed. The per-point properties Intensity, Color and Normal of the source are
+  filtered along with the points.
+ */
+class PointsExport Filter: public Feature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::Filter);
+
+public:
+    /// Constructor
+    Filter();
+
+    App::PropertyLink Source;
+    App::PropertyEnumeration Method;
+    App::PropertyLength VoxelSize;
+    App::PropertyLength Radius;
+    App::PropertyIntegerConstraint MinNeighbours;
+    App::PropertyIntegerConstraint Neighbours;
+    App::PropertyFloatConstraint StdDevRatio;
+    App::PropertyIntegerConstraint Samples;
+
+    /** @name methods override Feature */
+    //@{
+    short mustExecute() const override;
+    /// recalculate the Feature
+    App::DocumentObjectExecReturn* execute() override;
+    //@}
+
+private:
+    static const char* MethodEnums[];
+};
+
+}  // namespace Points
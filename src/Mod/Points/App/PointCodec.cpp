@@ -0,0 +1,395 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <zlib.h>
+
+#include <App/Application.h>
+#include <Base/Exception.h>
+#include <Base/Stream.h>
+
+#include "PointCodec.h"
+
+
+using namespace Points;
+
+namespace
+{
+// A legacy file that starts with this number of points would be larger than the 4 GiB that a
+// zip entry of a project file can hold, so the magic number cannot be ambiguous.
+const uint32_t CodecMagic = 0x43504346;  // "FCPC"
+const uint32_t CodecVersion = 1;
+// zlib cannot compress data by more than this factor
+const std::size_t MaxCompressionRatio = 1032;
+
+struct CodecHeader
+{
+    uint32_t components {};
+    uint32_t bits {};
+    uint64_t count {};
+    uint32_t chunkSize {};
+    uint32_t numChunks {};
+    std::vector<float> minimum;
+    std::vector<float> maximum;
+};
+
+inline uint32_t zigZag(uint32_t value)
+{
+    return (value << 1) ^ (0U - (value >> 31));
+}
+
+inline uint32_t unZigZag(uint32_t value)
+{
+    return (value >> 1) ^ (0U - (value & 1U));
+}
+
+inline uint32_t maxQuantized(uint32_t bits)
+{
+    return (1U << bits) - 1U;
+}
+
+// maps a value to the integer that is delta encoded
+inline uint32_t toWord(float value, const CodecHeader& header, uint32_t comp)
+{
+    if (header.bits == 0) {
+        uint32_t word {};
+        std::memcpy(&word, &value, sizeof(word));
+        return word;
+    }
+
+    float range = header.maximum[comp] - header.minimum[comp];
+    if (range <= 0.0F) {
+        return 0;
+    }
+
+    double scale = double(maxQuantized(header.bits)) / double(range);
+    return uint32_t(std::lround(double(value - header.minimum[comp]) * scale));
+}
+
+inline float fromWord(uint32_t word, const CodecHeader& header, uint32_t comp)
+{
+    if (header.bits == 0) {
+        float value {};
+        std::memcpy(&value, &word, sizeof(value));
+        return value;
+    }
+
+    double range = double(header.maximum[comp]) - double(header.minimum[comp]);
+    double scale = range / double(maxQuantized(header.bits));
+    return float(double(header.minimum[comp]) + double(word) * scale);
+}
+
+/*
+ * Within a chunk the values of each component are delta encoded and the bytes of the deltas are
+ * stored in four planes, from the least to the most significant byte. The upper planes of
+ * coherent data are mostly zero which makes them compress well.
+ */
+template<typename Getter>
+std::string encodeChunk(const Getter& get, std::size_t first, std::size_t last, const CodecHeader& header)
+{
+    std::size_t num = last - first;
+    std::vector<unsigned char> raw(num * header.components * 4);
+    unsigned char* plane = raw.data();
+    for (uint32_t comp = 0; comp < header.components; comp++) {
+        uint32_t prev = 0;
+        for (std::size_t i = 0; i < num; i++) {
+            uint32_t word = toWord(get(first + i, comp), header, comp);
+            uint32_t delta = zigZag(word - prev);
+            prev = word;
+            for (std::size_t byte = 0; byte < 4; byte++) {
+                plane[byte * num + i] = static_cast<unsigned char>(delta >> (8 * byte));
+            }
+        }
+        plane += 4 * num;
+    }
+
+    uLongf size = compressBound(uLong(raw.size()));
+    std::string blob(size, '\0');
+    int ret = compress2(
+        reinterpret_cast<Bytef*>(blob.data()),  // NOLINT
+        &size,
+        raw.data(),
+        uLong(raw.size()),
+        Z_BEST_SPEED
+    );
+    if (ret != Z_OK) {
+        throw Base::RuntimeError("Failed to compress point data");
+    }
+    blob.resize(size);
+    return blob;
+}
+
+template<typename Setter>
+void decodeChunk(
+    const Setter& set,
+    const std::string& blob,
+    std::size_t first,
+    std::size_t last,
+    const CodecHeader& header
+)
+{
+    std::size_t num = last - first;
+    if (num * header.components * 4 > blob.size() * MaxCompressionRatio) {
+        throw Base::BadFormatError("Corrupted point data");
+    }
+
+    std::vector<unsigned char> raw(num * header.components * 4);
+    uLongf size = uLongf(raw.size());
+    int ret = uncompress(
+        raw.data(),
+        &size,
+        reinterpret_cast<const Bytef*>(blob.data()),  // NOLINT
+        uLong(blob.size())
+    );
+    if (ret != Z_OK || size != raw.size()) {
+        throw Base::BadFormatError("Corrupted point data");
+    }
+
+    const unsigned char* plane = raw.data();
+    for (uint32_t comp = 0; comp < header.components; comp++) {
+        uint32_t prev = 0;
+        for (std::size_t i = 0; i < num; i++) {
+            uint32_t delta = 0;
+            for (std::size_t byte = 0; byte < 4; byte++) {
+                delta |= uint32_t(plane[byte * num + i]) << (8 * byte);
+            }
+            prev += unZigZag(delta);
+            set(first + i, comp, fromWord(prev, header, comp));
+        }
+        plane += 4 * num;
+    }
+}
+
+template<typename Getter>
+void writeChunks(
+    Base::OutputStream& str,
+    const Getter& get,
+    std::size_t count,
+    uint32_t components,
+    int bits,
+    uint32_t chunkSize
+)
+{
+    CodecHeader header;
+    header.components = components;
+    header.bits = uint32_t(std::clamp(bits, 0, 31));
+    header.count = count;
+    header.chunkSize = std::max<uint32_t>(chunkSize, 1);
+    header.numChunks = uint32_t((count + header.chunkSize - 1) / header.chunkSize);
+
+    if (header.bits > 0) {
+        header.minimum.assign(components, std::numeric_limits<float>::max());
+        header.maximum.assign(components, -std::numeric_limits<float>::max());
+        for (std::size_t i = 0; i < count && header.bits > 0; i++) {
+            for (uint32_t comp = 0; comp < components; comp++) {
+                float value = get(i, comp);
+                if (!std::isfinite(value)) {
+                    // NaN or infinite values cannot be quantized
+                    header.bits = 0;
+                    break;
+                }
+                header.minimum[comp] = std::min(header.minimum[comp], value);
+                header.maximum[comp] = std::max(header.maximum[comp], value);
+            }
+        }
+    }
+
+    str << CodecMagic << CodecVersion << header.components << header.bits << header.count
+        << header.chunkSize << header.numChunks;
+    if (header.bits > 0) {
+        for (uint32_t comp = 0; comp < components; comp++) {
+            str << header.minimum[comp] << header.maximum[comp];
+        }
+    }
+
+    std::vector<std::string> blobs(header.numChunks);
+    std::vector<uint32_t> chunks(header.numChunks);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    QtConcurrent::blockingMap(chunks, [&](uint32_t chunk) {
+        std::size_t first = std::size_t(chunk) * header.chunkSize;
+        std::size_t last = std::min<std::size_t>(first + header.chunkSize, count);
+        blobs[chunk] = encodeChunk(get, first, last, header);
+    });
+
+    for (const auto& blob : blobs) {
+        str << uint32_t(blob.size());
+        str.write(blob.data(), int(blob.size()));
+    }
+}
+
+CodecHeader readHeader(Base::InputStream& str, uint32_t components)
+{
+    uint32_t version {};
+    CodecHeader header;
+    str >> version;
+    if (!str || version != CodecVersion) {
+        throw Base::BadFormatError("Unsupported point data format");
+    }
+
+    str >> header.components >> header.bits >> header.count >> header.chunkSize >> header.numChunks;
+    if (header.components != components || header.bits > 31 || header.chunkSize == 0
+        || header.numChunks != (header.count + header.chunkSize - 1) / header.chunkSize) {
+        throw Base::BadFormatError("Invalid point data header");
+    }
+
+    if (header.bits > 0) {
+        header.minimum.resize(components);
+        header.maximum.resize(components);
+        for (uint32_t comp = 0; comp < components; comp++) {
+            str >> header.minimum[comp] >> header.maximum[comp];
+        }
+    }
+    if (!str) {
+        throw Base::BadFormatError("Truncated point data header");
+    }
+
+    return header;
+}
+
+/*
+ * The compressed chunks are read at once and then decoded in parallel. They are added one by one
+ * and checked against the number of values before anything is allocated for the values, so a
+ * corrupted header cannot allocate more memory than the stream contains.
+ */
+std::vector<std::string> readChunks(Base::InputStream& str, const CodecHeader& header)
+{
+    // a chunk never exceeds the compressed size of a full chunk
+    uLong maxSize = compressBound(uLong(header.chunkSize) * header.components * 4);
+    const std::size_t step = 1 << 20;
+    std::vector<std::string> blobs;
+    std::size_t total = 0;
+    for (uint32_t chunk = 0; chunk < header.numChunks; chunk++) {
+        uint32_t size {};
+        str >> size;
+        if (!str || size > maxSize) {
+            throw Base::BadFormatError("Corrupted point data");
+        }
+
+        std::string blob;
+        while (blob.size() < size) {
+            std::size_t offset = blob.size();
+            std::size_t num = std::min<std::size_t>(size - offset, step);
+            blob.resize(offset + num);
+            str.read(blob.data() + offset, int(num));
+            if (!str) {
+                throw Base::BadFormatError("Truncated point data");
+            }
+        }
+
+        total += size;
+        blobs.push_back(std::move(blob));
+    }
+
+    if (header.count > total * MaxCompressionRatio / (header.components * 4)) {
+        throw Base::BadFormatError("Corrupted point data");
+    }
+
+    return blobs;
+}
+
+template<typename Setter>
+void decodeChunks(
+    const std::vector<std::string>& blobs,
+    const CodecHeader& header,
+    const Setter& set
+)
+{
+    std::vector<uint32_t> chunks(header.numChunks);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    QtConcurrent::blockingMap(chunks, [&](uint32_t chunk) {
+        std::size_t first = std::size_t(chunk) * header.chunkSize;
+        std::size_t last = std::min<std::size_t>(first + header.chunkSize, header.count);
+        decodeChunk(set, blobs[chunk], first, last, header);
+    });
+}
+}  // namespace
+
+PointCodec::PointCodec(int bits, uint32_t chunkSize)
+    : bits(bits)
+    , chunkSize(chunkSize)
+{}
+
+uint32_t PointCodec::magic()
+{
+    return CodecMagic;
+}
+
+bool PointCodec::isEnabled()
+{
+    auto hGrp(
+        App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Points")
+    );
+    return hGrp->GetBool("CompressedFormat", false);
+}
+
+PointCodec PointCodec::fromParameters()
+{
+    auto hGrp(
+        App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Points")
+    );
+    return PointCodec(int(hGrp->GetInt("QuantizationBits", 0)));
+}
+
+void PointCodec::write(Base::OutputStream& str, const std::vector<Base::Vector3f>& values) const
+{
+    auto get = [&values](std::size_t index, uint32_t comp) {
+        return values[index][static_cast<unsigned short>(comp)];
+    };
+    writeChunks(str, get, values.size(), 3, bits, chunkSize);
+}
+
+void PointCodec::write(Base::OutputStream& str, const std::vector<float>& values) const
+{
+    auto get = [&values](std::size_t index, uint32_t) {
+        return values[index];
+    };
+    writeChunks(str, get, values.size(), 1, bits, chunkSize);
+}
+
+void PointCodec::read(Base::InputStream& str, std::vector<Base::Vector3f>& values) const
+{
+    CodecHeader header = readHeader(str, 3);
+    std::vector<std::string> blobs = readChunks(str, header);
+    values.resize(header.count);
+    auto set = [&values](std::size_t index, uint32_t comp, float value) {
+        values[index][static_cast<unsigned short>(comp)] = value;
+    };
+    decodeChunks(blobs, header, set);
+}
+
+void PointCodec::read(Base::InputStream& str, std::vector<float>& values) const
+{
+    CodecHeader header = readHeader(str, 1);
+    std::vector<std::string> blobs = readChunks(str, header);
+    values.resize(header.count);
+    auto set = [&values](std::size_t index, uint32_t, float value) {
+        values[index] = value;
+    };
+    decodeChunks(blobs, header, set);
+}
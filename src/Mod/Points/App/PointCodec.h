@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <Base/Vector3D.h>
+#include <Mod/Points/PointsGlobal.h>
+
+namespace Base
+{
+class InputStream;
+class OutputStream;
+}  // namespace Base
+
+namespace Points
+{
+
+/** The PointCodec class writes and reads point coordinates or per-point values in a chunked,
+ * compressed format.
+ * The values are split into chunks of a fixed number of points. Inside a chunk each component is
+ * delta encoded, its bytes are grouped by significance and the result is deflated. As the chunks
+ * are independent of each other they are encoded and decoded in parallel.
+ * If a number of quantization bits is set the values are stored as integers relative to their
+ * bounding range which makes the format lossy but much more compact. Non-finite values are always
+ * stored losslessly.
+ */
+class PointsExport PointCodec
+{
+public:
+    /** The first 32-bit word written by this codec. It distinguishes the format from the legacy
+     * format of the document files that starts with the number of points. It is followed by the
+     * format version which is checked when reading.
+     * A legacy file with magic() points cannot exist because it would exceed the 4 GiB limit of
+     * an entry in a project file.
+     */
+    static uint32_t magic();
+    /// Returns true if the codec is enabled in the user parameters for saving documents
+    static bool isEnabled();
+    /// Creates a codec with the settings of the user parameters
+    static PointCodec fromParameters();
+
+    /*!
+     * \param bits The number of bits per quantized component. 0 means lossless, the maximum is 31.
+     * \param chunkSize The number of points per chunk.
+     */
+    explicit PointCodec(int bits = 0, uint32_t chunkSize = 65536);
+
+    void write(Base::OutputStream&, const std::vector<Base::Vector3f>&) const;
+    void write(Base::OutputStream&, const std::vector<float>&) const;
+    /// Reads the data after the magic number
+    void read(Base::InputStream&, std::vector<Base::Vector3f>&) const;
+    /// Reads the data after the magic number
+    void read(Base::InputStream&, std::vector<float>&) const;
+
+private:
+    int bits;
+    uint32_t chunkSize;
+};
+
+}  // namespace Points
@@ -32,6 +32,7 @@
 #include <Base/Stream.h>
 #include <Base/Writer.h>
 
+#include "PointCodec.h"
 #include "Points.h"
 #include "PointsAlgos.h"
 
@@ -199,9 +200,14 @@ void PointKernel::Save(Base::Writer& writer) const
 void PointKernel::SaveDocFile(Base::Writer& writer) const
 {
     Base::OutputStream str(writer.Stream());
+    // store the data without transforming it
+    if (PointCodec::isEnabled()) {
+        PointCodec::fromParameters().write(str, _Points);
+        return;
+    }
+
     uint32_t uCt = (uint32_t)size();
     str << uCt;
-    // store the data without transforming it
     for (const auto& pnt : _Points) {
         str << pnt.x << pnt.y << pnt.z;
     }
@@ -229,6 +235,11 @@ void PointKernel::RestoreDocFile(Base::Reader& reader)
     Base::InputStream str(reader);
     uint32_t uCt = 0;
     str >> uCt;
+    if (uCt == PointCodec::magic()) {
+        PointCodec().read(str, _Points);
+        return;
+    }
+
     _Points.resize(uCt);
     for (unsigned long i = 0; i < uCt; i++) {
         float x {};
@@ -60,6 +60,34 @@ class Points(object):
     def fromValid(self) -> Any:
         """Get a new point object from points with valid coordinates (i.e. that are not NaN)"""
         ...
+
+    @constmethod
+    def voxelFilter(self, size: float, /) -> list[int]:
+        """voxelFilter(size) -> list of int
+Divides the space into cubes of the given edge length and returns the index of the point
+closest to the centroid of each non-empty cube. Use fromSegment() to get the filtered points.
+Raises ValueError if size isn't positive."""
+        ...
+
+    @constmethod
+    def radiusOutlierFilter(self, radius: float, minNeighbours: int, /) -> list[int]:
+        """radiusOutlierFilter(radius, minNeighbours) -> list of int
+Returns the indices of the points that have at least minNeighbours other points within radius."""
+        ...
+
+    @constmethod
+    def statisticalOutlierFilter(self, neighbours: int, stdDevRatio: float, /) -> list[int]:
+        """statisticalOutlierFilter(neighbours, stdDevRatio) -> list of int
+Returns the indices of the points whose mean distance to their nearest neighbours doesn't
+exceed the global mean by more than stdDevRatio times the standard deviation."""
+        ...
+
+    @constmethod
+    def normalSpaceSampling(self, normals: list, samples: int, bins: int = 8, /) -> list[int]:
+        """normalSpaceSampling(normals, samples, [bins=8]) -> list of int
+Returns the indices of about the given number of points whose normals are spread as evenly
+as possible over the directions. The normals must be given for each point."""
+        ...
     CountPoints: Final[int]
     """Return the number of vertices of the points object."""
 
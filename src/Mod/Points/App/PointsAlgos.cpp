@@ -27,8 +27,11 @@
 #ifdef FC_OS_LINUX
 # include <unistd.h>
 #endif
+#include <array>
+#include <cmath>
 #include <memory>
 #include <sstream>
+#include <unordered_set>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
@@ -41,6 +44,7 @@
 #include <Base/FileInfo.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
+#include <Base/Tools.h>
 
 #include "PointsAlgos.h"
 #include <E57Format.h>
@@ -133,6 +137,7 @@ Reader::~Reader() = default;
 
 void Reader::clear()
 {
+    points.clear();
     intensity.clear();
     colors.clear();
     normals.clear();
@@ -193,6 +198,66 @@ int Reader::getHeight() const
     return height;
 }
 
+void Reader::setVoxelSize(double size)
+{
+    voxelSize = size;
+}
+
+double Reader::getVoxelSize() const
+{
+    return voxelSize;
+}
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+/** Keeps the first point of each voxel of a regular grid. With a voxel size of zero every point
+ * is kept.
+ */
+class VoxelFilter
+{
+public:
+    explicit VoxelFilter(double size)
+        : size {size}
+    {}
+
+    bool accept(const Base::Vector3d& pnt)
+    {
+        if (size <= 0.0) {
+            return true;
+        }
+        if (!std::isfinite(pnt.x) || !std::isfinite(pnt.y) || !std::isfinite(pnt.z)) {
+            return false;
+        }
+
+        Voxel voxel {
+            static_cast<int64_t>(std::floor(pnt.x / size)),
+            static_cast<int64_t>(std::floor(pnt.y / size)),
+            static_cast<int64_t>(std::floor(pnt.z / size))
+        };
+        return voxels.insert(voxel).second;
+    }
+
+private:
+    using Voxel = std::array<int64_t, 3>;
+    struct VoxelHash
+    {
+        std::size_t operator()(const Voxel& voxel) const
+        {
+            std::size_t seed = 0;
+            for (int64_t value : voxel) {
+                Base::hash_combine(seed, value);
+            }
+            return seed;
+        }
+    };
+
+    double size;
+    std::unordered_set<Voxel, VoxelHash> voxels;
+};
+}  // namespace
+
 // ----------------------------------------------------------------------------
 
 AscReader::AscReader() = default;
@@ -573,17 +638,6 @@ void PlyReader::read(const std::string& filename)
     this->width = numPoints;
     this->height = 1;
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, offset, data);
-    }
-    else if (format == "binary_little_endian") {
-        readBinary(false, inp, offset, types, sizes, data);
-    }
-    else if (format == "binary_big_endian") {
-        readBinary(true, inp, offset, types, sizes, data);
-    }
-
     std::vector<std::string>::iterator it;
     Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
 
@@ -670,64 +724,73 @@ void PlyReader::read(const std::string& filename)
         alpha = std::distance(fields.begin(), it);
     }
 
-    // transfer the data
     bool hasData = (x != max_size && y != max_size && z != max_size);
     bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
     bool hasIntensity = (greyvalue != max_size);
     bool hasColor = (red != max_size && green != max_size && blue != max_size);
+    bool hasUCharColor = hasColor && types[red] == "uchar";
+    bool hasFloatColor = hasColor && types[red] == "float";
+    if (!hasData) {
+        return;
+    }
 
-    if (hasData) {
+    // the arrays can only be reserved if no point gets filtered out
+    VoxelFilter filter(voxelSize);
+    if (voxelSize <= 0.0) {
         points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
+        if (hasNormal) {
+            normals.reserve(numPoints);
         }
-    }
-
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+        if (hasIntensity) {
+            intensity.reserve(numPoints);
         }
-    }
-
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(static_cast<float>(data(i, greyvalue)));
+        if (hasUCharColor || hasFloatColor) {
+            colors.reserve(numPoints);
         }
     }
 
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        float a = 1.0;
-        if (types[red] == "uchar") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
-                }
-                colors.emplace_back(
-                    static_cast<float>(r) / 255.0F,
-                    static_cast<float>(g) / 255.0F,
-                    static_cast<float>(b) / 255.0F,
-                    static_cast<float>(a) / 255.0F
-                );
+    // transfer the data block by block
+    auto addBlock = [&](const Eigen::MatrixXd& data, Eigen::Index rows) {
+        for (Eigen::Index i = 0; i < rows; i++) {
+            Base::Vector3d pnt(data(i, x), data(i, y), data(i, z));
+            if (!filter.accept(pnt)) {
+                continue;
             }
-        }
-        else if (types[red] == "float") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
+
+            points.push_back(pnt);
+            if (hasNormal) {
+                normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+            }
+            if (hasIntensity) {
+                intensity.push_back(static_cast<float>(data(i, greyvalue)));
+            }
+
+            if (hasUCharColor || hasFloatColor) {
                 float r = static_cast<float>(data(i, red));
                 float g = static_cast<float>(data(i, green));
                 float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
+                float a = alpha != max_size ? static_cast<float>(data(i, alpha)) : 1.0F;
+                if (hasUCharColor) {
+                    colors.emplace_back(r / 255.0F, g / 255.0F, b / 255.0F, a / 255.0F);
+                }
+                else {
+                    colors.emplace_back(r, g, b, a);
                 }
-                colors.emplace_back(r, g, b, a);
             }
         }
+    };
+
+    if (format == "ascii") {
+        readAscii(inp, offset, numPoints, Eigen::Index(fields.size()), addBlock);
+    }
+    else if (format == "binary_little_endian") {
+        readBinary(false, inp, offset, types, sizes, numPoints, addBlock);
+    }
+    else if (format == "binary_big_endian") {
+        readBinary(true, inp, offset, types, sizes, numPoints, addBlock);
     }
+
+    this->width = int(points.size());
 }
 
 std::size_t PlyReader::readHeader(
@@ -902,14 +965,20 @@ std::size_t PlyReader::readHeader(
     return numPoints;
 }
 
-void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd& data)
+void PlyReader::readAscii(
+    std::istream& inp,
+    std::size_t offset,
+    Eigen::Index numPoints,
+    Eigen::Index numFields,
+    const BlockHandler& handler
+)
 {
     std::string line;
     Eigen::Index row = 0;
-    Eigen::Index numPoints = Eigen::Index(data.rows());
-    Eigen::Index numFields = Eigen::Index(data.cols());
+    Eigen::Index blockRow = 0;
+    Eigen::MatrixXd data(std::min(numPoints, BlockSize), numFields);
     std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
+    while (row < numPoints && std::getline(inp, line)) {
         if (line.empty()) {
             continue;
         }
@@ -928,10 +997,18 @@ void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd
         Eigen::Index size = Eigen::Index(list.size());
         for (Eigen::Index col = 0; col < size && col < numFields; col++) {
             double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
+            data(blockRow, col) = value;
         }
 
         ++row;
+        if (++blockRow == data.rows()) {
+            handler(data, blockRow);
+            blockRow = 0;
+        }
+    }
+
+    if (blockRow > 0) {
+        handler(data, blockRow);
     }
 }
 
@@ -941,11 +1018,11 @@ void PlyReader::readBinary(
     std::size_t offset,
     const std::vector<std::string>& types,
     const std::vector<int>& sizes,
-    Eigen::MatrixXd& data
+    Eigen::Index numPoints,
+    const BlockHandler& handler
 )
 {
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
+    Eigen::Index numFields = Eigen::Index(types.size());
 
     int neededSize = 0;
     ConverterPtr convert_float32(new ConverterT<float>);
@@ -1026,11 +1103,16 @@ void PlyReader::readBinary(
 
     Base::InputStream str(inp);
     str.setByteOrder(swapByteOrder ? Base::Stream::BigEndian : Base::Stream::LittleEndian);
-    for (Eigen::Index i = 0; i < numPoints; i++) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            double value = converters[j]->toDouble(str);
-            data(i, j) = value;
+    Eigen::MatrixXd data(std::min(numPoints, BlockSize), numFields);
+    for (Eigen::Index first = 0; first < numPoints; first += BlockSize) {
+        Eigen::Index rows = std::min(BlockSize, numPoints - first);
+        for (Eigen::Index i = 0; i < rows; i++) {
+            for (Eigen::Index j = 0; j < numFields; j++) {
+                double value = converters[j]->toDouble(str);
+                data(i, j) = value;
+            }
         }
+        handler(data, rows);
     }
 }
 
@@ -1053,33 +1135,6 @@ void PcdReader::read(const std::string& filename)
     std::vector<int> sizes;
     Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, fields, types, sizes));
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, data);
-    }
-    else if (format == "binary") {
-        readBinary(false, inp, types, sizes, data);
-    }
-    else if (format == "binary_compressed") {
-        unsigned int c {};
-        unsigned int u {};
-        Base::InputStream str(inp);
-        str >> c >> u;
-
-        std::vector<char> compressed(c);
-        inp.read(compressed.data(), c);
-        std::vector<char> uncompressed(u);
-        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) == u) {
-            DataStreambuf ibuf(uncompressed);
-            std::istream istr(nullptr);
-            istr.rdbuf(&ibuf);
-            readBinary(true, istr, types, sizes, data);
-        }
-        else {
-            throw Base::BadFormatError("Failed to decompress binary data");
-        }
-    }
-
     std::vector<std::string>::iterator it;
     Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
 
@@ -1151,46 +1206,58 @@ void PcdReader::read(const std::string& filename)
         rgba = std::distance(fields.begin(), it);
     }
 
-    // transfer the data
     bool hasData = (x != max_size && y != max_size && z != max_size);
     bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
     bool hasIntensity = (greyvalue != max_size);
     bool hasColor = (rgba != max_size);
+    bool hasPackedColor = hasColor && types[rgba] == "U";
+    bool hasFloatColor = hasColor && types[rgba] == "F";
+    if (!hasData) {
+        return;
+    }
 
-    if (hasData) {
+    // structured clouds must keep all points
+    double size = this->height > 1 ? 0.0 : voxelSize;
+    VoxelFilter filter(size);
+    if (size <= 0.0) {
         points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
+        if (hasNormal) {
+            normals.reserve(numPoints);
         }
-    }
-
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+        if (hasIntensity) {
+            intensity.reserve(numPoints);
         }
-    }
-
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(data(i, greyvalue));
+        if (hasPackedColor || hasFloatColor) {
+            colors.reserve(numPoints);
         }
     }
 
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        if (types[rgba] == "U") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
+    // transfer the data block by block
+    auto addBlock = [&](const Eigen::MatrixXd& data, Eigen::Index rows) {
+        for (Eigen::Index i = 0; i < rows; i++) {
+            Base::Vector3d pnt(data(i, x), data(i, y), data(i, z));
+            if (!filter.accept(pnt)) {
+                continue;
+            }
+
+            points.push_back(pnt);
+            if (hasNormal) {
+                normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+            }
+            if (hasIntensity) {
+                intensity.push_back(data(i, greyvalue));
+            }
+            if (hasPackedColor) {
                 uint32_t packed = static_cast<uint32_t>(data(i, rgba));
                 Base::Color col;
                 col.setPackedARGB(packed);
                 colors.emplace_back(col);
             }
-        }
-        else if (types[rgba] == "F") {
-            static_assert(sizeof(float) == sizeof(uint32_t), "float and uint32_t have different sizes");
-            for (Eigen::Index i = 0; i < numPoints; i++) {
+            else if (hasFloatColor) {
+                static_assert(
+                    sizeof(float) == sizeof(uint32_t),
+                    "float and uint32_t have different sizes"
+                );
                 float f = static_cast<float>(data(i, rgba));
                 uint32_t packed {};
                 std::memcpy(&packed, &f, sizeof(packed));
@@ -1199,6 +1266,37 @@ void PcdReader::read(const std::string& filename)
                 colors.emplace_back(col);
             }
         }
+    };
+
+    if (format == "ascii") {
+        readAscii(inp, numPoints, Eigen::Index(fields.size()), addBlock);
+    }
+    else if (format == "binary") {
+        readBinary(false, inp, types, sizes, numPoints, addBlock);
+    }
+    else if (format == "binary_compressed") {
+        unsigned int c {};
+        unsigned int u {};
+        Base::InputStream str(inp);
+        str >> c >> u;
+
+        std::vector<char> uncompressed(u);
+        {
+            std::vector<char> compressed(c);
+            inp.read(compressed.data(), c);
+            if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) != u) {
+                throw Base::BadFormatError("Failed to decompress binary data");
+            }
+        }
+
+        DataStreambuf ibuf(uncompressed);
+        std::istream istr(nullptr);
+        istr.rdbuf(&ibuf);
+        readBinary(true, istr, types, sizes, numPoints, addBlock);
+    }
+
+    if (size > 0.0) {
+        this->width = int(points.size());
     }
 }
 
@@ -1275,14 +1373,19 @@ std::size_t PcdReader::readHeader(
     return points;
 }
 
-void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
+void PcdReader::readAscii(
+    std::istream& inp,
+    Eigen::Index numPoints,
+    Eigen::Index numFields,
+    const BlockHandler& handler
+)
 {
     std::string line;
     Eigen::Index row = 0;
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
+    Eigen::Index blockRow = 0;
+    Eigen::MatrixXd data(std::min(numPoints, BlockSize), numFields);
     std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
+    while (row < numPoints && std::getline(inp, line)) {
         if (line.empty()) {
             continue;
         }
@@ -1296,10 +1399,18 @@ void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
         Eigen::Index size = Eigen::Index(list.size());
         for (Eigen::Index col = 0; col < size && col < numFields; col++) {
             double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
+            data(blockRow, col) = value;
         }
 
         ++row;
+        if (++blockRow == data.rows()) {
+            handler(data, blockRow);
+            blockRow = 0;
+        }
+    }
+
+    if (blockRow > 0) {
+        handler(data, blockRow);
     }
 }
 
@@ -1308,11 +1419,11 @@ void PcdReader::readBinary(
     std::istream& inp,
     const std::vector<std::string>& types,
     const std::vector<int>& sizes,
-    Eigen::MatrixXd& data
+    Eigen::Index numPoints,
+    const BlockHandler& handler
 )
 {
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
+    Eigen::Index numFields = Eigen::Index(types.size());
 
     int neededSize = 0;
     ConverterPtr convert_float32(new ConverterT<float>);
@@ -1392,20 +1503,40 @@ void PcdReader::readBinary(
     }
 
     Base::InputStream str(inp);
+    Eigen::MatrixXd data(std::min(numPoints, BlockSize), numFields);
     if (transpose) {
+        // the values are stored field by field, so each field of a block is read from its own
+        // position
+        std::vector<std::streamoff> fieldStart(numFields);
+        std::streamoff start = inp.tellg();
         for (Eigen::Index j = 0; j < numFields; j++) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
+            fieldStart[j] = start;
+            start += converters[j]->getSizeOf() * static_cast<std::streamoff>(numPoints);
+        }
+
+        for (Eigen::Index first = 0; first < numPoints; first += BlockSize) {
+            Eigen::Index rows = std::min(BlockSize, numPoints - first);
+            for (Eigen::Index j = 0; j < numFields; j++) {
+                std::streamoff offset = converters[j]->getSizeOf() * static_cast<std::streamoff>(first);
+                inp.seekg(fieldStart[j] + offset);
+                for (Eigen::Index i = 0; i < rows; i++) {
+                    double value = converters[j]->toDouble(str);
+                    data(i, j) = value;
+                }
             }
+            handler(data, rows);
         }
     }
     else {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            for (Eigen::Index j = 0; j < numFields; j++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
+        for (Eigen::Index first = 0; first < numPoints; first += BlockSize) {
+            Eigen::Index rows = std::min(BlockSize, numPoints - first);
+            for (Eigen::Index i = 0; i < rows; i++) {
+                for (Eigen::Index j = 0; j < numFields; j++) {
+                    double value = converters[j]->toDouble(str);
+                    data(i, j) = value;
+                }
             }
+            handler(data, rows);
         }
     }
 }
@@ -1417,6 +1548,18 @@ namespace
 class E57ReaderImp
 {
 public:
+    // The decoded points go directly into these arrays
+    struct Target
+    {
+        PointKernel& points;
+        std::vector<Base::Vector3f>& normals;
+        std::vector<Base::Color>& colors;
+        std::vector<float>& intensity;
+        VoxelFilter& filter;
+        // the capacity to reserve or zero if points get filtered out
+        std::size_t reserve;
+    };
+
     E57ReaderImp(const std::string& filename, bool color, bool state, double distance)
         : imfi(filename, "r")
         , useColor {color}
@@ -1424,50 +1567,47 @@ public:
         , minDistance {distance}
     {}
 
-    void read()
+    int countScans()
     {
         e57::StructureNode root = imfi.root();
         if (root.isDefined("data3D")) {
             e57::VectorNode data3D(root.get("data3D"));
-            readData3D(data3D);
+            return int(data3D.childCount());
         }
+        return 0;
     }
 
-    std::vector<Base::Color> getColors() const
-    {
-        return colors;
-    }
-
-    std::vector<float> getItensity() const
+    // the number of records of all scans
+    std::size_t countRecords()
     {
-        return intensity;
+        std::size_t count = 0;
+        e57::StructureNode root = imfi.root();
+        if (root.isDefined("data3D")) {
+            e57::VectorNode data3D(root.get("data3D"));
+            for (int64_t child = 0; child < data3D.childCount(); child++) {
+                e57::StructureNode scan_data(data3D.get(child));
+                e57::CompressedVectorNode cvn(scan_data.get("points"));
+                count += static_cast<std::size_t>(cvn.childCount());
+            }
+        }
+        return count;
     }
 
-    const PointKernel& getPoints() const
+    void readScan(int child, Target& target)
     {
-        return points;
-    }
+        e57::StructureNode root = imfi.root();
+        e57::VectorNode data3D(root.get("data3D"));
+        e57::StructureNode scan_data(data3D.get(child));
+        Base::Placement plm;
+        bool hasPlacement = getPlacement(scan_data, plm);
 
-    const std::vector<Base::Vector3f>& getNormals() const
-    {
-        return normals;
+        e57::CompressedVectorNode cvn(scan_data.get("points"));
+        e57::StructureNode prototype(cvn.prototype());
+        Proto proto = readProto(prototype);
+        processProto(cvn, proto, hasPlacement, plm, target);
     }
 
 private:
-    void readData3D(const e57::VectorNode& data3D)
-    {
-        for (int child = 0; child < data3D.childCount(); ++child) {
-            e57::StructureNode scan_data(data3D.get(child));
-            Base::Placement plm;
-            bool hasPlacement = getPlacement(scan_data, plm);
-
-            e57::CompressedVectorNode cvn(scan_data.get("points"));
-            e57::StructureNode prototype(cvn.prototype());
-            Proto proto = readProto(prototype);
-            processProto(cvn, proto, hasPlacement, plm);
-        }
-    }
-
     struct Proto
     {
         bool inty = false;
@@ -1717,7 +1857,8 @@ private:
         e57::CompressedVectorNode& cvn,
         const Proto& proto,
         bool hasPlacement,
-        const Base::Placement& plm
+        const Base::Placement& plm,
+        Target& target
     )
     {
         if (proto.cnt_xyz != 3) {
@@ -1732,7 +1873,24 @@ private:
         bool hasNormal = (proto.cnt_nor == 3);
         bool hasState = proto.inv_state && checkState;
         bool filter = false;
+        Base::Rotation rot = plm.getRotation();
+
+        // the number of records is an upper bound of the number of points
+        if (target.reserve > 0) {
+            target.points.reserve(target.reserve);
+            if (hasColor) {
+                target.colors.reserve(target.reserve);
+            }
+            if (hasItensity) {
+                target.intensity.reserve(target.reserve);
+            }
+            if (hasNormal) {
+                target.normals.reserve(target.reserve);
+            }
+        }
 
+        // Each block of at most buf_size records is decoded into the buffers of the
+        // prototype and passed on to the target arrays.
         while ((count = cvr.read())) {
             for (size_t i = 0; i < count; ++i) {
                 filter = false;
@@ -1742,62 +1900,60 @@ private:
                     }
                 }
 
-                pt = getCoord(proto, i, hasPlacement, plm);
+                pt = getCoord(proto, i);
 
+                // the placement doesn't change distances, so filter in the coordinates of the scan
                 if ((!filter) && (cnt_pts > 0)) {
                     if (Base::Distance(last, pt) < minDistance) {
                         filter = true;
                     }
                 }
-                if (!filter) {
-                    cnt_pts++;
-                    points.push_back(pt);
-                    last = pt;
-                    if (hasColor) {
-                        colors.push_back(getColor(proto, i));
-                    }
-                    if (hasItensity) {
-                        intensity.push_back(proto.intensity[i]);
-                    }
-                    if (hasNormal) {
-                        normals.push_back(getNormal(proto, i, hasPlacement, plm.getRotation()));
+                if (filter) {
+                    continue;
+                }
+
+                cnt_pts++;
+                last = pt;
+                if (hasPlacement) {
+                    plm.multVec(pt, pt);
+                }
+                if (!target.filter.accept(pt)) {
+                    continue;
+                }
+
+                target.points.push_back(pt);
+                if (hasColor) {
+                    target.colors.push_back(getColor(proto, i));
+                }
+                if (hasItensity) {
+                    target.intensity.push_back(static_cast<float>(proto.intensity[i]));
+                }
+                if (hasNormal) {
+                    Base::Vector3f normal = getNormal(proto, i);
+                    if (hasPlacement) {
+                        rot.multVec(normal, normal);
                     }
+                    target.normals.push_back(normal);
                 }
             }
         }
     }
 
-    Base::Vector3d getCoord(
-        const Proto& proto,
-        size_t index,
-        bool hasPlacement,
-        const Base::Placement& plm
-    ) const
+    Base::Vector3d getCoord(const Proto& proto, size_t index) const
     {
         Base::Vector3d pt;
         pt.x = proto.xData[index];
         pt.y = proto.yData[index];
         pt.z = proto.zData[index];
-        if (hasPlacement) {
-            plm.multVec(pt, pt);
-        }
         return pt;
     }
 
-    Base::Vector3f getNormal(
-        const Proto& proto,
-        size_t index,
-        bool hasPlacement,
-        const Base::Rotation& rot
-    ) const
+    Base::Vector3f getNormal(const Proto& proto, size_t index) const
     {
         Base::Vector3f pt;
         pt.x = proto.xNormal[index];
         pt.y = proto.yNormal[index];
         pt.z = proto.zNormal[index];
-        if (hasPlacement) {
-            rot.multVec(pt, pt);
-        }
         return pt;
     }
 
@@ -1865,10 +2021,6 @@ private:
     bool checkState;
     double minDistance;
     const size_t buf_size = 1024;
-    std::vector<Base::Color> colors;
-    std::vector<float> intensity;
-    PointKernel points;
-    std::vector<Base::Vector3f> normals;
 };
 }  // namespace
 
@@ -1880,13 +2032,22 @@ E57Reader::E57Reader(bool Color, bool State, double Distance)
 
 void E57Reader::read(const std::string& filename)
 {
+    clear();
+
     try {
+        // libE57Format initializes and terminates Xerces with each image file, which is not thread
+        // safe. So the scans are read one after the other from a single reader.
         E57ReaderImp reader(filename, useColor, checkState, minDistance);
-        reader.read();
-        points = reader.getPoints();
-        normals = reader.getNormals();
-        colors = reader.getColors();
-        intensity = reader.getItensity();
+        int numScans = reader.countScans();
+
+        // the arrays can only be reserved if no point gets filtered out
+        VoxelFilter filter(voxelSize);
+        std::size_t reserve = voxelSize <= 0.0 ? reader.countRecords() : 0;
+        E57ReaderImp::Target target {points, normals, colors, intensity, filter, reserve};
+        for (int scan = 0; scan < numScans; scan++) {
+            reader.readScan(scan, target);
+        }
+
         width = points.size();
         height = 1;
     }
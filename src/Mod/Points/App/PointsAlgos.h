@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include <Eigen/Core>
 
 #include "Points.h"
@@ -65,6 +67,11 @@ public:
     bool isStructured() const;
     int getWidth() const;
     int getHeight() const;
+    /** Subsamples unstructured point clouds on a voxel grid while reading. Of all points inside a
+     * voxel only the first one is kept. A size of zero disables the subsampling.
+     */
+    void setVoxelSize(double);
+    double getVoxelSize() const;
 
     Reader(const Reader&) = delete;
     Reader(Reader&&) = delete;
@@ -72,6 +79,11 @@ public:
     Reader& operator=(Reader&&) = delete;
 
 protected:
+    /// Receives a block of rows of the file, one column per field
+    using BlockHandler = std::function<void(const Eigen::MatrixXd& data, Eigen::Index rows)>;
+    /// The number of rows that are decoded at once
+    static constexpr Eigen::Index BlockSize = 65536;
+
     // NOLINTBEGIN
     PointKernel points;
     std::vector<float> intensity;
@@ -79,6 +91,7 @@ protected:
     std::vector<Base::Vector3f> normals;
     int width {0};
     int height {1};
+    double voxelSize {0.0};
     // NOLINTEND
 };
 
@@ -104,14 +117,21 @@ private:
         std::vector<std::string>& types,
         std::vector<int>& sizes
     );
-    void readAscii(std::istream&, std::size_t offset, Eigen::MatrixXd& data);
+    void readAscii(
+        std::istream&,
+        std::size_t offset,
+        Eigen::Index numPoints,
+        Eigen::Index numFields,
+        const BlockHandler& handler
+    );
     void readBinary(
         bool swapByteOrder,
         std::istream&,
         std::size_t offset,
         const std::vector<std::string>& types,
         const std::vector<int>& sizes,
-        Eigen::MatrixXd& data
+        Eigen::Index numPoints,
+        const BlockHandler& handler
     );
 };
 
@@ -129,13 +149,19 @@ private:
         std::vector<std::string>& types,
         std::vector<int>& sizes
     );
-    void readAscii(std::istream&, Eigen::MatrixXd& data);
+    void readAscii(
+        std::istream&,
+        Eigen::Index numPoints,
+        Eigen::Index numFields,
+        const BlockHandler& handler
+    );
     void readBinary(
         bool transpose,
         std::istream&,
         const std::vector<std::string>& types,
         const std::vector<int>& sizes,
-        Eigen::MatrixXd& data
+        Eigen::Index numPoints,
+        const BlockHandler& handler
     );
 };
 
@@ -0,0 +1,309 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+#include <Base/Converter.h>
+#include <Base/Exception.h>
+
+#include "PointsFilter.h"
+
+
+using namespace Points;
+
+namespace
+{
+const std::size_t ChunkSize = 4096;
+
+inline bool isFinite(const Base::Vector3f& pnt)
+{
+    return std::isfinite(pnt.x) && std::isfinite(pnt.y) && std::isfinite(pnt.z);
+}
+
+// calls func(first, last) for consecutive ranges of [0, count) in parallel
+template<typename Func>
+void forEachChunk(std::size_t count, Func&& func)
+{
+    std::vector<std::size_t> chunks((count + ChunkSize - 1) / ChunkSize);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    QtConcurrent::blockingMap(chunks, [count, &func](std::size_t chunk) {
+        std::size_t first = chunk * ChunkSize;
+        func(first, std::min(first + ChunkSize, count));
+    });
+}
+
+std::size_t coprimeStride(std::size_t count)
+{
+    // a stride close to the golden ratio visits the elements of a bin in a well spread order
+    std::size_t stride = std::max<std::size_t>(1, std::size_t(double(count) * 0.618));
+    while (std::gcd(stride, count) != 1) {
+        stride++;
+    }
+    return stride;
+}
+}  // namespace
+
+PointsFilter::PointsFilter(const std::vector<Base::Vector3f>& points)
+    : _points(points)
+{}
+
+const PointsOctree& PointsFilter::GetOctree() const
+{
+    if (_octree.IsEmpty()) {
+        _octree.Build(_points);
+    }
+    return _octree;
+}
+
+std::vector<unsigned long> PointsFilter::VoxelGrid(double size) const
+{
+    if (size <= 0.0) {
+        throw Base::ValueError("The voxel size must be greater than zero");
+    }
+
+    std::vector<unsigned long> result;
+    using Voxel = std::tuple<int64_t, int64_t, int64_t>;
+    std::vector<std::pair<Voxel, unsigned long>> keys(_points.size());
+    std::vector<char> valid(_points.size());
+    forEachChunk(_points.size(), [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; i++) {
+            const Base::Vector3f& pnt = _points[i];
+            valid[i] = isFinite(pnt);
+            if (valid[i]) {
+                Voxel voxel(
+                    static_cast<int64_t>(std::floor(double(pnt.x) / size)),
+                    static_cast<int64_t>(std::floor(double(pnt.y) / size)),
+                    static_cast<int64_t>(std::floor(double(pnt.z) / size))
+                );
+                keys[i] = std::make_pair(voxel, i);
+            }
+        }
+    });
+
+    std::size_t numValid = 0;
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        if (valid[i]) {
+            keys[numValid++] = keys[i];
+        }
+    }
+    keys.resize(numValid);
+    std::sort(keys.begin(), keys.end());
+
+    // the ranges of the points of the same voxel
+    std::vector<std::size_t> voxels;
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        if (i == 0 || keys[i].first != keys[i - 1].first) {
+            voxels.push_back(i);
+        }
+    }
+    voxels.push_back(keys.size());
+
+    result.resize(voxels.size() - 1);
+    forEachChunk(result.size(), [&](std::size_t first, std::size_t last) {
+        for (std::size_t v = first; v < last; v++) {
+            std::size_t begin = voxels[v];
+            std::size_t end = voxels[v + 1];
+            Base::Vector3d centroid;
+            for (std::size_t i = begin; i < end; i++) {
+                centroid += Base::convertTo<Base::Vector3d>(_points[keys[i].second]);
+            }
+            centroid /= double(end - begin);
+
+            // the keys are sorted, so the smallest index wins a tie
+            unsigned long best = keys[begin].second;
+            double bestDist = std::numeric_limits<double>::max();
+            for (std::size_t i = begin; i < end; i++) {
+                double dist = Base::DistanceP2(
+                    Base::convertTo<Base::Vector3d>(_points[keys[i].second]),
+                    centroid
+                );
+                if (dist < bestDist) {
+                    best = keys[i].second;
+                    bestDist = dist;
+                }
+            }
+            result[v] = best;
+        }
+    });
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<unsigned long> PointsFilter::RadiusOutliers(double radius, int minNeighbours) const
+{
+    const PointsOctree& octree = GetOctree();
+    std::vector<char> keep(_points.size());
+    forEachChunk(_points.size(), [&](std::size_t first, std::size_t last) {
+        std::vector<unsigned long> neighbours;
+        for (std::size_t i = first; i < last; i++) {
+            if (!isFinite(_points[i])) {
+                continue;
+            }
+            neighbours.clear();
+            octree.InSphere(_points, _points[i], float(radius), neighbours);
+            // the point itself is part of the result
+            keep[i] = int(neighbours.size()) > minNeighbours;
+        }
+    });
+
+    std::vector<unsigned long> result;
+    for (std::size_t i = 0; i < keep.size(); i++) {
+        if (keep[i]) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+std::vector<unsigned long> PointsFilter::StatisticalOutliers(
+    int neighbours,
+    double stdDevRatio
+) const
+{
+    std::vector<unsigned long> result;
+    if (neighbours <= 0) {
+        return result;
+    }
+
+    const PointsOctree& octree = GetOctree();
+    const float maxDist = std::numeric_limits<float>::max();
+    std::vector<double> meanDist(_points.size(), -1.0);
+    forEachChunk(_points.size(), [&](std::size_t first, std::size_t last) {
+        std::vector<unsigned long> indices;
+        std::vector<float> dists;
+        for (std::size_t i = first; i < last; i++) {
+            if (!isFinite(_points[i])) {
+                continue;
+            }
+
+            // the point itself is among the nearest points
+            std::size_t k = std::size_t(neighbours) + 1;
+            octree.FindNearest(_points, _points[i], k, maxDist, indices, dists);
+            double sum = 0.0;
+            int count = 0;
+            bool skipped = false;
+            for (std::size_t j = 0; j < indices.size(); j++) {
+                if (!skipped && indices[j] == i) {
+                    skipped = true;
+                    continue;
+                }
+                if (count < neighbours) {
+                    sum += dists[j];
+                    count++;
+                }
+            }
+            meanDist[i] = count > 0 ? sum / count : 0.0;
+        }
+    });
+
+    double sum = 0.0;
+    double sumSq = 0.0;
+    std::size_t count = 0;
+    for (double dist : meanDist) {
+        if (dist >= 0.0) {
+            sum += dist;
+            sumSq += dist * dist;
+            count++;
+        }
+    }
+    if (count == 0) {
+        return result;
+    }
+
+    double mean = sum / double(count);
+    double variance = std::max(0.0, sumSq / double(count) - mean * mean);
+    double threshold = mean + stdDevRatio * std::sqrt(variance);
+    for (std::size_t i = 0; i < meanDist.size(); i++) {
+        if (meanDist[i] >= 0.0 && meanDist[i] <= threshold) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+std::vector<unsigned long> PointsFilter::NormalSpaceSampling(
+    const std::vector<Base::Vector3f>& normals,
+    std::size_t numSamples,
+    int bins
+) const
+{
+    std::vector<unsigned long> result;
+    if (normals.size() != _points.size() || bins <= 0) {
+        return result;
+    }
+
+    // sort the points into the bins of their normal direction
+    using Bin = std::tuple<int, int, int>;
+    std::vector<std::pair<Bin, unsigned long>> keys;
+    keys.reserve(_points.size());
+    for (std::size_t i = 0; i < _points.size(); i++) {
+        Base::Vector3f normal = normals[i];
+        if (!isFinite(_points[i]) || !isFinite(normal) || normal.Sqr() == 0.0F) {
+            continue;
+        }
+        normal.Normalize();
+        auto toBin = [bins](float value) {
+            return std::clamp(int((value + 1.0F) * 0.5F * float(bins)), 0, bins - 1);
+        };
+        keys.emplace_back(Bin(toBin(normal.x), toBin(normal.y), toBin(normal.z)), i);
+    }
+
+    if (numSamples >= keys.size()) {
+        for (const auto& key : keys) {
+            result.push_back(key.second);
+        }
+        return result;
+    }
+
+    std::sort(keys.begin(), keys.end());
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;  // first position and size
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        if (i == 0 || keys[i].first != keys[i - 1].first) {
+            ranges.emplace_back(i, 0);
+        }
+        ranges.back().second++;
+    }
+
+    // pick the points from the bins in turn
+    std::vector<std::size_t> strides;
+    for (const auto& range : ranges) {
+        strides.push_back(coprimeStride(range.second));
+    }
+    for (std::size_t round = 0; result.size() < numSamples; round++) {
+        for (std::size_t b = 0; b < ranges.size() && result.size() < numSamples; b++) {
+            auto [first, size] = ranges[b];
+            if (round < size) {
+                result.push_back(keys[first + (round * strides[b]) % size].second);
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include <Base/Vector3D.h>
+#include <Mod/Points/PointsGlobal.h>
+
+#include "PointsOctree.h"
+
+
+namespace Points
+{
+
+/**
+ * The PointsFilter class implements downsampling and denoising filters for point clouds.
+ * The filters don't modify the points but return the sorted indices of the points to keep, so the
+ * caller can apply them to the points and to any per-point property like colors, normals or
+ * intensities. Non-finite points are never kept.
+ *
+ * The per-point work runs in parallel and the results don't depend on the number of threads.
+ */
+class PointsExport PointsFilter
+{
+public:
+    explicit PointsFilter(const std::vector<Base::Vector3f>& points);
+
+    /** Divides the space into cubes of the edge length \a size and keeps of each non-empty cube
+     * the point that is closest to the centroid of its points.
+     * Throws a Base::ValueError if \a size isn't positive. */
+    std::vector<unsigned long> VoxelGrid(double size) const;
+    /** Keeps the points that have at least \a minNeighbours other points within the distance \a
+     * radius. */
+    std::vector<unsigned long> RadiusOutliers(double radius, int minNeighbours) const;
+    /** Computes for each point the mean distance to its \a neighbours nearest points and removes
+     * the points whose mean distance exceeds the global mean by more than \a stdDevRatio times
+     * the standard deviation. */
+    std::vector<unsigned long> StatisticalOutliers(int neighbours, double stdDevRatio) const;
+    /** Selects about \a numSamples points so that the directions of their normals are spread as
+     * evenly as possible. The normals are sorted into \a bins intervals per axis and the points
+     * are picked from the bins in turn. */
+    std::vector<unsigned long> NormalSpaceSampling(
+        const std::vector<Base::Vector3f>& normals,
+        std::size_t numSamples,
+        int bins = 8
+    ) const;
+
+    /** Returns the elements of \a values at the positions \a indices. */
+    template<typename T>
+    static std::vector<T> Select(
+        const std::vector<T>& values,
+        const std::vector<unsigned long>& indices
+    )
+    {
+        std::vector<T> result;
+        result.reserve(indices.size());
+        for (unsigned long index : indices) {
+            result.push_back(values[index]);
+        }
+        return result;
+    }
+
+private:
+    const PointsOctree& GetOctree() const;
+
+private:
+    const std::vector<Base::Vector3f>& _points;
+    mutable PointsOctree _octree;
+};
+
+}  // namespace Points
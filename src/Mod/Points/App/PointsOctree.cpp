@@ -0,0 +1,458 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <queue>
+
+#include "PointsOctree.h"
+
+
+using namespace Points;
+
+namespace
+{
+const std::size_t ChunkSize = 65536;
+
+// spreads the lower 21 bits of a value so that two zero bits follow each bit
+inline uint64_t spreadBits(uint64_t value)
+{
+    value &= 0x1fffffULL;
+    value = (value | (value << 32)) & 0x1f00000000ffffULL;
+    value = (value | (value << 16)) & 0x1f0000ff0000ffULL;
+    value = (value | (value << 8)) & 0x100f00f00f00f00fULL;
+    value = (value | (value << 4)) & 0x10c30c30c30c30c3ULL;
+    value = (value | (value << 2)) & 0x1249249249249249ULL;
+    return value;
+}
+
+inline float distanceToBox(const Base::BoundBox3f& box, const Base::Vector3f& pnt)
+{
+    float dx = std::max({box.MinX - pnt.x, 0.0F, pnt.x - box.MaxX});
+    float dy = std::max({box.MinY - pnt.y, 0.0F, pnt.y - box.MaxY});
+    float dz = std::max({box.MinZ - pnt.z, 0.0F, pnt.z - box.MaxZ});
+    return dx * dx + dy * dy + dz * dz;
+}
+
+inline bool isFinite(const Base::Vector3f& pnt)
+{
+    return std::isfinite(pnt.x) && std::isfinite(pnt.y) && std::isfinite(pnt.z);
+}
+
+inline float maxLength(const Base::BoundBox3f& box)
+{
+    return std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+}
+}  // namespace
+
+PointsOctree::PointsOctree(const std::vector<Base::Vector3f>& points)
+{
+    Build(points);
+}
+
+void PointsOctree::Clear()
+{
+    _nodes.clear();
+    _indices.clear();
+    _depth = 0;
+}
+
+Base::BoundBox3f PointsOctree::GetBoundBox() const
+{
+    if (_nodes.empty()) {
+        return Base::BoundBox3f();
+    }
+    return _nodes.front().box;
+}
+
+void PointsOctree::Build(const std::vector<Base::Vector3f>& points)
+{
+    Clear();
+
+    Base::BoundBox3f bbox;
+    std::vector<uint32_t> valid;
+    valid.reserve(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (isFinite(points[i])) {
+            valid.push_back(uint32_t(i));
+            bbox.Add(points[i]);
+        }
+    }
+
+    if (valid.empty()) {
+        return;
+    }
+
+    // quantize the points to 21 bits per axis, interleave the bits and sort the codes
+    const double maxCoord = double((1U << MaxDepth) - 1U);
+    auto scaleOf = [maxCoord](float length) {
+        return length > 0.0F ? maxCoord / double(length) : 0.0;
+    };
+    const double scaleX = scaleOf(bbox.LengthX());
+    const double scaleY = scaleOf(bbox.LengthY());
+    const double scaleZ = scaleOf(bbox.LengthZ());
+    auto quantize = [maxCoord](float value, float minimum, double scale) {
+        double coord = std::clamp(double(value - minimum) * scale, 0.0, maxCoord);
+        return spreadBits(uint64_t(coord));
+    };
+
+    using Key = std::pair<uint64_t, uint32_t>;
+    std::vector<Key> keys(valid.size());
+    std::vector<std::size_t> chunks((keys.size() + ChunkSize - 1) / ChunkSize);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    QtConcurrent::blockingMap(chunks, [&](std::size_t chunk) {
+        std::size_t first = chunk * ChunkSize;
+        std::size_t last = std::min(first + ChunkSize, keys.size());
+        for (std::size_t i = first; i < last; i++) {
+            const Base::Vector3f& pnt = points[valid[i]];
+            uint64_t code = quantize(pnt.x, bbox.MinX, scaleX)
+                | (quantize(pnt.y, bbox.MinY, scaleY) << 1)
+                | (quantize(pnt.z, bbox.MinZ, scaleZ) << 2);
+            keys[i] = std::make_pair(code, valid[i]);
+        }
+        std::sort(keys.begin() + long(first), keys.begin() + long(last));
+    });
+
+    // merge the sorted chunks pairwise
+    for (std::size_t width = ChunkSize; width < keys.size(); width *= 2) {
+        std::vector<std::size_t> pairs;
+        for (std::size_t first = 0; first + width < keys.size(); first += 2 * width) {
+            pairs.push_back(first);
+        }
+        QtConcurrent::blockingMap(pairs, [&keys, width](std::size_t first) {
+            auto mid = keys.begin() + long(first + width);
+            auto last = keys.begin() + long(std::min(first + 2 * width, keys.size()));
+            std::inplace_merge(keys.begin() + long(first), mid, last);
+        });
+    }
+
+    std::vector<uint64_t> codes(keys.size());
+    _indices.resize(keys.size());
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        codes[i] = keys[i].first;
+        _indices[i] = keys[i].second;
+    }
+
+    // Split the nodes in breadth-first order. The codes of a node share all bits above its
+    // level, so the points of its octants are contiguous and sorted.
+    Node root;
+    root.count = uint32_t(_indices.size());
+    _nodes.push_back(root);
+    std::vector<int> levels(1, 0);
+    for (std::size_t i = 0; i < _nodes.size(); i++) {
+        int level = levels[i];
+        _depth = std::max(_depth, level + 1);
+        if (_nodes[i].count <= LeafSize || level == MaxDepth) {
+            continue;
+        }
+
+        int shift = 3 * (MaxDepth - 1 - level);
+        auto begin = codes.begin() + _nodes[i].first;
+        auto end = begin + _nodes[i].count;
+        uint32_t children = uint32_t(_nodes.size());
+        uint32_t numChildren = 0;
+        for (uint64_t octant = 0; octant < 8 && begin != end; octant++) {
+            auto next = std::partition_point(begin, end, [shift, octant](uint64_t code) {
+                return ((code >> shift) & 7U) <= octant;
+            });
+            if (next != begin) {
+                Node child;
+                child.first = uint32_t(begin - codes.begin());
+                child.count = uint32_t(next - begin);
+                _nodes.push_back(child);
+                levels.push_back(level + 1);
+                numChildren++;
+            }
+            begin = next;
+        }
+
+        _nodes[i].children = children;
+        _nodes[i].numChildren = numChildren;
+    }
+
+    // compute the tight boxes and representatives from the leaves to the root
+    auto closest = [&points](const Base::Vector3f& center, const uint32_t* first, const uint32_t* last) {
+        uint32_t best = *first;
+        float bestDist = Base::DistanceP2(points[best], center);
+        for (const uint32_t* it = first + 1; it != last; ++it) {
+            float dist = Base::DistanceP2(points[*it], center);
+            if (dist < bestDist || (dist == bestDist && *it < best)) {
+                best = *it;
+                bestDist = dist;
+            }
+        }
+        return best;
+    };
+
+    std::vector<uint32_t> samples;
+    for (std::size_t i = _nodes.size(); i-- > 0;) {
+        Node& node = _nodes[i];
+        if (node.numChildren == 0) {
+            const uint32_t* first = _indices.data() + node.first;
+            const uint32_t* last = first + node.count;
+            for (const uint32_t* it = first; it != last; ++it) {
+                node.box.Add(points[*it]);
+            }
+            node.sample = closest(node.box.GetCenter(), first, last);
+        }
+        else {
+            samples.clear();
+            for (uint32_t c = node.children; c < node.children + node.numChildren; c++) {
+                node.box.Add(_nodes[c].box);
+                samples.push_back(_nodes[c].sample);
+            }
+            node.sample = closest(node.box.GetCenter(), samples.data(), samples.data() + samples.size());
+        }
+    }
+}
+
+std::size_t PointsOctree::InSide(
+    const std::vector<Base::Vector3f>& points,
+    const Base::BoundBox3f& box,
+    std::vector<unsigned long>& indices
+) const
+{
+    return Sample(points, box, 0.0F, indices);
+}
+
+std::size_t PointsOctree::InSphere(
+    const std::vector<Base::Vector3f>& points,
+    const Base::Vector3f& center,
+    float radius,
+    std::vector<unsigned long>& indices
+) const
+{
+    if (_nodes.empty()) {
+        return 0;
+    }
+
+    std::size_t count = indices.size();
+    float radius2 = radius * radius;
+    std::vector<uint32_t> stack(1, 0);
+    while (!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+        if (distanceToBox(node.box, center) > radius2) {
+            continue;
+        }
+        if (node.numChildren == 0) {
+            for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                if (Base::DistanceP2(points[_indices[i]], center) <= radius2) {
+                    indices.push_back(_indices[i]);
+                }
+            }
+        }
+        else {
+            for (uint32_t c = node.children + node.numChildren; c-- > node.children;) {
+                stack.push_back(c);
+            }
+        }
+    }
+
+    return indices.size() - count;
+}
+
+bool PointsOctree::FindNearest(
+    const std::vector<Base::Vector3f>& points,
+    const Base::Vector3f& pnt,
+    float maxDist,
+    unsigned long& index,
+    float& dist
+) const
+{
+    if (_nodes.empty()) {
+        return false;
+    }
+
+    // visit the nodes in the order of their distance to the point
+    using Entry = std::pair<float, uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+    queue.emplace(distanceToBox(_nodes.front().box, pnt), 0);
+
+    float bestDist = maxDist * maxDist;
+    uint32_t best = 0;
+    bool found = false;
+    while (!queue.empty()) {
+        auto [nodeDist, nodeIndex] = queue.top();
+        queue.pop();
+        if (nodeDist > bestDist) {
+            break;
+        }
+
+        const Node& node = _nodes[nodeIndex];
+        if (node.numChildren == 0) {
+            for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                uint32_t candidate = _indices[i];
+                float candidateDist = Base::DistanceP2(points[candidate], pnt);
+                if (candidateDist < bestDist
+                    || (candidateDist == bestDist && (!found || candidate < best))) {
+                    best = candidate;
+                    bestDist = candidateDist;
+                    found = true;
+                }
+            }
+        }
+        else {
+            for (uint32_t c = node.children; c < node.children + node.numChildren; c++) {
+                float childDist = distanceToBox(_nodes[c].box, pnt);
+                if (childDist <= bestDist) {
+                    queue.emplace(childDist, c);
+                }
+            }
+        }
+    }
+
+    if (found) {
+        index = best;
+        dist = std::sqrt(bestDist);
+    }
+    return found;
+}
+
+std::size_t PointsOctree::FindNearest(
+    const std::vector<Base::Vector3f>& points,
+    const Base::Vector3f& pnt,
+    std::size_t k,
+    float maxDist,
+    std::vector<unsigned long>& indices,
+    std::vector<float>& dists
+) const
+{
+    indices.clear();
+    dists.clear();
+    if (_nodes.empty() || k == 0) {
+        return 0;
+    }
+
+    // the candidates are kept in a max-heap, ties are broken by the point index
+    using Entry = std::pair<float, uint32_t>;
+    std::vector<Entry> best;
+    best.reserve(k + 1);
+    float maxDist2 = maxDist * maxDist;
+    auto bound = [&best, k, maxDist2]() {
+        return best.size() < k ? maxDist2 : best.front().first;
+    };
+
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+    queue.emplace(distanceToBox(_nodes.front().box, pnt), 0);
+    while (!queue.empty()) {
+        auto [nodeDist, nodeIndex] = queue.top();
+        queue.pop();
+        if (nodeDist > bound()) {
+            break;
+        }
+
+        const Node& node = _nodes[nodeIndex];
+        if (node.numChildren == 0) {
+            for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                Entry candidate(Base::DistanceP2(points[_indices[i]], pnt), _indices[i]);
+                if (candidate.first > maxDist2) {
+                    continue;
+                }
+                if (best.size() < k) {
+                    best.push_back(candidate);
+                    std::push_heap(best.begin(), best.end());
+                }
+                else if (candidate < best.front()) {
+                    std::pop_heap(best.begin(), best.end());
+                    best.back() = candidate;
+                    std::push_heap(best.begin(), best.end());
+                }
+            }
+        }
+        else {
+            for (uint32_t c = node.children; c < node.children + node.numChildren; c++) {
+                float childDist = distanceToBox(_nodes[c].box, pnt);
+                if (childDist <= bound()) {
+                    queue.emplace(childDist, c);
+                }
+            }
+        }
+    }
+
+    std::sort_heap(best.begin(), best.end());
+    for (const auto& [dist, index] : best) {
+        indices.push_back(index);
+        dists.push_back(std::sqrt(dist));
+    }
+    return best.size();
+}
+
+std::size_t PointsOctree::Sample(
+    const std::vector<Base::Vector3f>& points,
+    const Base::BoundBox3f& box,
+    float spacing,
+    std::vector<unsigned long>& indices
+) const
+{
+    if (_nodes.empty()) {
+        return 0;
+    }
+
+    std::size_t count = indices.size();
+    std::vector<uint32_t> stack(1, 0);
+    while (!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+        if (!box.Intersect(node.box)) {
+            continue;
+        }
+        if (spacing > 0.0F && maxLength(node.box) <= spacing) {
+            if (box.IsInBox(points[node.sample])) {
+                indices.push_back(node.sample);
+            }
+        }
+        else if (spacing <= 0.0F && box.IsInBox(node.box)) {
+            indices.insert(
+                indices.end(),
+                _indices.begin() + node.first,
+                _indices.begin() + node.first + node.count
+            );
+        }
+        else if (node.numChildren == 0) {
+            for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                if (box.IsInBox(points[_indices[i]])) {
+                    indices.push_back(_indices[i]);
+                }
+            }
+        }
+        else {
+            for (uint32_t c = node.children + node.numChildren; c-- > node.children;) {
+                stack.push_back(c);
+            }
+        }
+    }
+
+    return indices.size() - count;
+}
+
+std::size_t PointsOctree::Sample(
+    const std::vector<Base::Vector3f>& points,
+    float spacing,
+    std::vector<unsigned long>& indices
+) const
+{
+    return Sample(points, GetBoundBox(), spacing, indices);
+}
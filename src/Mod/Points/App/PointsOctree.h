@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+#include <Mod/Points/PointsGlobal.h>
+
+namespace Points
+{
+
+/**
+ * The PointsOctree class is a level-of-detail index for point clouds.
+ * The points are sorted along a Morton curve and the octree is derived from the sorted codes, so
+ * every node refers to a contiguous range of the sorted point indices. Each node keeps the tight
+ * bounding box of its points and a representative point that lies closest to the centre of the
+ * box. The representatives allow one to extract a subset of the cloud with a given spacing without
+ * touching the single points.
+ *
+ * Computing and sorting the codes runs in parallel. Non-finite points are not indexed.
+ * The octree doesn't keep a reference to the points, so the caller must pass the same points to
+ * the queries as to Build().
+ */
+class PointsExport PointsOctree
+{
+public:
+    /// The maximum number of points of a leaf node
+    static constexpr uint32_t LeafSize = 32;
+    /// The maximum depth of the octree
+    static constexpr int MaxDepth = 21;
+
+    PointsOctree() = default;
+    explicit PointsOctree(const std::vector<Base::Vector3f>& points);
+
+    /** @name Construction */
+    //@{
+    /// Rebuilds the octree for the given points
+    void Build(const std::vector<Base::Vector3f>& points);
+    /// Removes all data
+    void Clear();
+    /// Returns true if no point is indexed
+    bool IsEmpty() const
+    {
+        return _nodes.empty();
+    }
+    /// Returns the number of indexed points
+    std::size_t Size() const
+    {
+        return _indices.size();
+    }
+    /// Returns the number of nodes
+    std::size_t CountNodes() const
+    {
+        return _nodes.size();
+    }
+    /// Returns the depth of the octree
+    int GetDepth() const
+    {
+        return _depth;
+    }
+    /// Returns the bounding box of the indexed points
+    Base::BoundBox3f GetBoundBox() const;
+    //@}
+
+    /** @name Search */
+    //@{
+    /** Adds the indices of all points inside the box \a box to \a indices. The indices are in
+     * Morton order. Returns the number of added indices. */
+    std::size_t InSide(
+        const std::vector<Base::Vector3f>& points,
+        const Base::BoundBox3f& box,
+        std::vector<unsigned long>& indices
+    ) const;
+    /** Adds the indices of all points inside the sphere around \a center with radius \a radius to
+     * \a indices. Returns the number of added indices. */
+    std::size_t InSphere(
+        const std::vector<Base::Vector3f>& points,
+        const Base::Vector3f& center,
+        float radius,
+        std::vector<unsigned long>& indices
+    ) const;
+    /** Searches for the nearest point of \a pnt within the distance \a maxDist. If a point is found
+     * its index and distance are set and true is returned. */
+    bool FindNearest(
+        const std::vector<Base::Vector3f>& points,
+        const Base::Vector3f& pnt,
+        float maxDist,
+        unsigned long& index,
+        float& dist
+    ) const;
+    /** Searches for the \a k nearest points of \a pnt within the distance \a maxDist. The indices
+     * and distances are sorted by increasing distance. Returns the number of found points. */
+    std::size_t FindNearest(
+        const std::vector<Base::Vector3f>& points,
+        const Base::Vector3f& pnt,
+        std::size_t k,
+        float maxDist,
+        std::vector<unsigned long>& indices,
+        std::vector<float>& dists
+    ) const;
+    //@}
+
+    /** @name Level of detail */
+    //@{
+    /** Adds a subset of the points inside the box \a box to \a indices whose spacing is roughly \a
+     * spacing. A node that is smaller than the spacing contributes its representative point only.
+     * If \a spacing is zero all points inside the box are added. Returns the number of added
+     * indices. */
+    std::size_t Sample(
+        const std::vector<Base::Vector3f>& points,
+        const Base::BoundBox3f& box,
+        float spacing,
+        std::vector<unsigned long>& indices
+    ) const;
+    /** Adds a subset of all points to \a indices whose spacing is roughly \a spacing. */
+    std::size_t Sample(
+        const std::vector<Base::Vector3f>& points,
+        float spacing,
+        std::vector<unsigned long>& indices
+    ) const;
+    //@}
+
+private:
+    struct Node
+    {
+        Base::BoundBox3f box;
+        uint32_t first {0};     /**< First position in _indices */
+        uint32_t count {0};     /**< Number of points */
+        uint32_t children {0};  /**< Index of the first child, 0 for a leaf */
+        uint32_t numChildren {0};
+        uint32_t sample {0};    /**< Index of the representative point */
+    };
+
+    std::vector<Node> _nodes;
+    std::vector<uint32_t> _indices;
+    int _depth {0};
+};
+
+}  // namespace Points
@@ -22,6 +22,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <boost/math/special_functions/fpclassify.hpp>
 
 
@@ -31,6 +32,7 @@
 #include <Base/VectorPy.h>
 
 #include "Points.h"
+#include "PointsFilter.h"
 // inclusion of the generated files (generated out of PointsPy.xml)
 #include "PointsPy.h"
 #include "PointsPy.cpp"
@@ -244,6 +246,92 @@ PyObject* PointsPy::fromValid(PyObject* args) const
     }
 }
 
+namespace
+{
+Py::List toIndexList(const std::vector<unsigned long>& indices)
+{
+    Py::List list;
+    for (unsigned long index : indices) {
+        list.append(Py::Long(index));
+    }
+    return list;
+}
+}  // namespace
+
+PyObject* PointsPy::voxelFilter(PyObject* args) const
+{
+    double size {};
+    if (!PyArg_ParseTuple(args, "d", &size)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        PointsFilter filter(getPointKernelPtr()->getBasicPoints());
+        return Py::new_reference_to(toIndexList(filter.VoxelGrid(size)));
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::radiusOutlierFilter(PyObject* args) const
+{
+    double radius {};
+    int minNeighbours {};
+    if (!PyArg_ParseTuple(args, "di", &radius, &minNeighbours)) {
+        return nullptr;
+    }
+
+    PointsFilter filter(getPointKernelPtr()->getBasicPoints());
+    return Py::new_reference_to(toIndexList(filter.RadiusOutliers(radius, minNeighbours)));
+}
+
+PyObject* PointsPy::statisticalOutlierFilter(PyObject* args) const
+{
+    int neighbours {};
+    double stdDevRatio {};
+    if (!PyArg_ParseTuple(args, "id", &neighbours, &stdDevRatio)) {
+        return nullptr;
+    }
+
+    PointsFilter filter(getPointKernelPtr()->getBasicPoints());
+    return Py::new_reference_to(toIndexList(filter.StatisticalOutliers(neighbours, stdDevRatio)));
+}
+
+PyObject* PointsPy::normalSpaceSampling(PyObject* args) const
+{
+    PyObject* obj {};
+    int samples {};
+    int bins = 8;
+    if (!PyArg_ParseTuple(args, "Oi|i", &obj, &samples, &bins)) {
+        return nullptr;
+    }
+
+    try {
+        std::vector<Base::Vector3f> normals;
+        Py::Sequence list(obj);
+        normals.reserve(list.size());
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            Base::Vector3d normal = Py::Vector(*it).toVector();
+            normals.push_back(Base::convertTo<Base::Vector3f>(normal));
+        }
+
+        const PointKernel* points = getPointKernelPtr();
+        if (normals.size() != points->size()) {
+            PyErr_SetString(PyExc_ValueError, "expect a normal for each point");
+            return nullptr;
+        }
+
+        PointsFilter filter(points->getBasicPoints());
+        std::size_t numSamples = static_cast<std::size_t>(std::max(samples, 0));
+        std::vector<unsigned long> indices = filter.NormalSpaceSampling(normals, numSamples, bins);
+        return Py::new_reference_to(toIndexList(indices));
+    }
+    catch (const Py::Exception&) {
+        PyErr_SetString(PyExc_TypeError, "expect a list of vectors");
+        return nullptr;
+    }
+}
+
 Py::Long PointsPy::getCountPoints() const
 {
     return Py::Long((long)getPointKernelPtr()->size());
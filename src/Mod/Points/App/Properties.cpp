@@ -35,6 +35,7 @@
 #include <Base/VectorPy.h>
 #include <Base/Writer.h>
 
+#include "PointCodec.h"
 #include "Points.h"
 #include "Properties.h"
 
@@ -148,6 +149,11 @@ void PropertyGreyValueList::Restore(Base::XMLReader& reader)
 void PropertyGreyValueList::SaveDocFile(Base::Writer& writer) const
 {
     Base::OutputStream str(writer.Stream());
+    if (PointCodec::isEnabled()) {
+        PointCodec::fromParameters().write(str, _lValueList);
+        return;
+    }
+
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
     for (float it : _lValueList) {
@@ -160,6 +166,13 @@ void PropertyGreyValueList::RestoreDocFile(Base::Reader& reader)
     Base::InputStream str(reader);
     uint32_t uCt = 0;
     str >> uCt;
+    if (uCt == PointCodec::magic()) {
+        std::vector<float> values;
+        PointCodec().read(str, values);
+        setValues(values);
+        return;
+    }
+
     std::vector<float> values(uCt);
     for (float& value : values) {
         str >> value;
@@ -320,6 +333,11 @@ void PropertyNormalList::Restore(Base::XMLReader& reader)
 void PropertyNormalList::SaveDocFile(Base::Writer& writer) const
 {
     Base::OutputStream str(writer.Stream());
+    if (PointCodec::isEnabled()) {
+        PointCodec::fromParameters().write(str, _lValueList);
+        return;
+    }
+
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
     for (const auto& it : _lValueList) {
@@ -332,6 +350,13 @@ void PropertyNormalList::RestoreDocFile(Base::Reader& reader)
     Base::InputStream str(reader);
     uint32_t uCt = 0;
     str >> uCt;
+    if (uCt == PointCodec::magic()) {
+        std::vector<Base::Vector3f> values;
+        PointCodec().read(str, values);
+        setValues(values);
+        return;
+    }
+
     std::vector<Base::Vector3f> values(uCt);
     for (auto& value : values) {
         str >> value.x >> value.y >> value.z;
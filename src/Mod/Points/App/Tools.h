@@ -25,6 +25,8 @@
 
 #include <App/DocumentObject.h>
 #include <algorithm>
+#include <type_traits>
+#include <vector>
 
 namespace Points
 {
@@ -62,4 +64,51 @@ bool copyProperty(
     return false;
 }
 
+/** Adds the property \a propertyName to \a target with the values of the same-named property of
+ * \a source at the positions \a indices. Returns false if \a source has no such
+ * property or it doesn't have a value for each index. In this case a dynamic property
+ * \a propertyName of \a target that was added by an earlier call is removed. */
+template<typename PropertyT>
+bool selectProperty(
+    App::DocumentObject* target,
+    const App::DocumentObject* source,
+    const char* propertyName,
+    const std::vector<unsigned long>& indices
+)
+{
+    auto source_prop = freecad_cast<PropertyT*>(source->getPropertyByName(propertyName));
+    if (!source_prop) {
+        target->removeDynamicProperty(propertyName);
+        return false;
+    }
+
+    // the property must have a value per point
+    const auto& source_values = source_prop->getValues();
+    if (std::any_of(indices.begin(), indices.end(), [&](unsigned long index) {
+            return index >= source_values.size();
+        })) {
+        target->removeDynamicProperty(propertyName);
+        return false;
+    }
+
+    auto target_prop = freecad_cast<PropertyT*>(target->getPropertyByName(propertyName));
+    if (!target_prop) {
+        target_prop = freecad_cast<PropertyT*>(
+            target->addDynamicProperty(PropertyT::getClassTypeId().getName(), propertyName)
+        );
+    }
+    if (!target_prop) {
+        return false;
+    }
+
+    std::remove_const_t<std::remove_reference_t<decltype(source_values)>> values;
+    values.reserve(indices.size());
+    for (unsigned long index : indices) {
+        values.push_back(source_values[index]);
+    }
+
+    target_prop->setValues(values);
+    return true;
+}
+
 }  // namespace Points
@@ -23,6 +23,8 @@
  ***************************************************************************/
 
 #include <boost/math/special_functions/fpclassify.hpp>
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 #include <Inventor/errors/SoDebugError.h>
@@ -36,6 +38,7 @@
 #include <Inventor/nodes/SoNormal.h>
 #include <Inventor/nodes/SoPointSet.h>
 
+#include <App/Application.h>
 #include <App/Document.h>
 #include <Base/Vector3D.h>
 #include <Gui/Application.h>
@@ -43,6 +46,7 @@
 #include <Gui/Selection/SoFCSelection.h>
 #include <Gui/View3DInventorViewer.h>
 #include <Mod/Points/App/PointsFeature.h>
+#include <Mod/Points/App/PointsOctree.h>
 #include <Mod/Points/App/Properties.h>
 
 #include "ViewProvider.h"
@@ -113,13 +117,14 @@ void ViewProviderPoints::onChanged(const App::Property* prop)
 void ViewProviderPoints::setVertexColorMode(App::PropertyColorList* pcProperty)
 {
     const std::vector<Base::Color>& val = pcProperty->getValues();
+    std::size_t count = displayIndices.empty() ? val.size() : displayIndices.size();
 
-    pcColorMat->diffuseColor.setNum(val.size());
+    pcColorMat->diffuseColor.setNum(count);
     SbColor* col = pcColorMat->diffuseColor.startEditing();
 
-    std::size_t i = 0;
-    for (const auto& it : val) {
-        col[i++].setValue(it.r, it.g, it.b);
+    for (std::size_t i = 0; i < count; i++) {
+        const Base::Color& it = val[displayIndices.empty() ? i : displayIndices[i]];
+        col[i].setValue(it.r, it.g, it.b);
     }
 
     pcColorMat->diffuseColor.finishEditing();
@@ -128,13 +133,14 @@ void ViewProviderPoints::setVertexColorMode(App::PropertyColorList* pcProperty)
 void ViewProviderPoints::setVertexGreyvalueMode(Points::PropertyGreyValueList* pcProperty)
 {
     const std::vector<float>& val = pcProperty->getValues();
+    std::size_t count = displayIndices.empty() ? val.size() : displayIndices.size();
 
-    pcColorMat->diffuseColor.setNum(val.size());
+    pcColorMat->diffuseColor.setNum(count);
     SbColor* col = pcColorMat->diffuseColor.startEditing();
 
-    std::size_t i = 0;
-    for (float it : val) {
-        col[i++].setValue(it, it, it);
+    for (std::size_t i = 0; i < count; i++) {
+        float it = val[displayIndices.empty() ? i : displayIndices[i]];
+        col[i].setValue(it, it, it);
     }
 
     pcColorMat->diffuseColor.finishEditing();
@@ -143,13 +149,14 @@ void ViewProviderPoints::setVertexGreyvalueMode(Points::PropertyGreyValueList* p
 void ViewProviderPoints::setVertexNormalMode(Points::PropertyNormalList* pcProperty)
 {
     const std::vector<Base::Vector3f>& val = pcProperty->getValues();
+    std::size_t count = displayIndices.empty() ? val.size() : displayIndices.size();
 
-    pcPointsNormal->vector.setNum(val.size());
+    pcPointsNormal->vector.setNum(count);
     SbVec3f* norm = pcPointsNormal->vector.startEditing();
 
-    std::size_t i = 0;
-    for (const auto& it : val) {
-        norm[i++].setValue(it.x, it.y, it.z);
+    for (std::size_t i = 0; i < count; i++) {
+        const Base::Vector3f& it = val[displayIndices.empty() ? i : displayIndices[i]];
+        norm[i].setValue(it.x, it.y, it.z);
     }
 
     pcPointsNormal->vector.finishEditing();
@@ -157,7 +164,8 @@ void ViewProviderPoints::setVertexNormalMode(Points::PropertyNormalList* pcPrope
 
 void ViewProviderPoints::setDisplayMode(const char* ModeName)
 {
-    int numPoints = pcPointsCoord->point.getNum();
+    // the colors, grey values and normals refer to all points of the cloud
+    int numPoints = displayIndices.empty() ? pcPointsCoord->point.getNum() : numCloudPoints;
 
     if (strcmp("Color", ModeName) == 0) {
         std::map<std::string, App::Property*> Map;
@@ -370,8 +378,26 @@ void ViewProviderPoints::clipPointsCallback(void*, SoEventCallback* n)
 
 PROPERTY_SOURCE(PointsGui::ViewProviderScattered, PointsGui::ViewProviderPoints)
 
+App::PropertyIntegerConstraint::Constraints ViewProviderScattered::pointRange
+    = {0, std::numeric_limits<int>::max(), 100000};
+
 ViewProviderScattered::ViewProviderScattered()
 {
+    static const char* osgroup = "Object Style";
+
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Points"
+    );
+    long maxPoints = hGrp->GetInt("MaxDisplayPoints", 0);
+    ADD_PROPERTY_TYPE(
+        MaxDisplayPoints,
+        (maxPoints),
+        osgroup,
+        App::Prop_None,
+        "Maximum number of displayed points, 0 shows all points"
+    );
+    MaxDisplayPoints.setConstraints(&pointRange);
+
     pcPoints = new SoPointSet();
     pcPoints->ref();
 }
@@ -427,12 +453,64 @@ void ViewProviderScattered::attach(App::DocumentObject* pcObj)
     }
 }
 
+void ViewProviderScattered::onChanged(const App::Property* prop)
+{
+    if (prop == &MaxDisplayPoints) {
+        if (auto fea = dynamic_cast<Points::Feature*>(pcObject)) {
+            updateData(&fea->Points);
+        }
+    }
+    else {
+        ViewProviderPoints::onChanged(prop);
+    }
+}
+
+void ViewProviderScattered::createPoints(const Points::PropertyPointKernel* prop)
+{
+    const std::vector<Base::Vector3f>& points = prop->getValue().getBasicPoints();
+    auto maxPoints = static_cast<std::size_t>(MaxDisplayPoints.getValue());
+    displayIndices.clear();
+    numCloudPoints = static_cast<int>(points.size());
+
+    Points::PointsOctree octree;
+    if (maxPoints > 0 && points.size() > maxPoints) {
+        octree.Build(points);
+    }
+    if (octree.IsEmpty()) {
+        ViewProviderPointsBuilder builder;
+        builder.createPoints(prop, pcPointsCoord, pcPoints);
+        return;
+    }
+
+    // Thin out the cloud with the level of detail of the octree. Start with the spacing of the
+    // points on a square as large as the bounding box and widen it until few enough points remain.
+    float spacing = std::max(
+        octree.GetBoundBox().CalcDiagonalLength() / std::sqrt(float(maxPoints)),
+        std::numeric_limits<float>::min()
+    );
+    octree.Sample(points, spacing, displayIndices);
+    while (displayIndices.size() > maxPoints) {
+        spacing *= 1.05F * std::sqrt(float(displayIndices.size()) / float(maxPoints));
+        displayIndices.clear();
+        octree.Sample(points, spacing, displayIndices);
+    }
+
+    pcPointsCoord->point.setNum(static_cast<int>(displayIndices.size()));
+    SbVec3f* vec = pcPointsCoord->point.startEditing();
+    for (std::size_t i = 0; i < displayIndices.size(); i++) {
+        const Base::Vector3f& pnt = points[displayIndices[i]];
+        vec[i].setValue(pnt.x, pnt.y, pnt.z);
+    }
+
+    pcPoints->numPoints = static_cast<int>(displayIndices.size());
+    pcPointsCoord->point.finishEditing();
+}
+
 void ViewProviderScattered::updateData(const App::Property* prop)
 {
     ViewProviderPoints::updateData(prop);
     if (prop->is<Points::PropertyPointKernel>()) {
-        ViewProviderPointsBuilder builder;
-        builder.createPoints(prop, pcPointsCoord, pcPoints);
+        createPoints(static_cast<const Points::PropertyPointKernel*>(prop));
 
         // The number of points might have changed, so force also a resize of the Inventor internals
         setActiveMode();
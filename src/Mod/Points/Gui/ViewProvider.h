@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <vector>
 #include <Inventor/SbVec2f.h>
 
 #include <Gui/ViewProviderBuilder.h>
@@ -54,6 +55,7 @@ namespace Points
 {
 class PropertyGreyValueList;
 class PropertyNormalList;
+class PropertyPointKernel;
 class PointKernel;
 class Feature;
 }  // namespace Points
@@ -113,6 +115,10 @@ protected:
     SoMaterial* pcColorMat;
     SoNormal* pcPointsNormal;
     SoDrawStyle* pcPointStyle;
+    /// The indices of the displayed points if only a subset of the point cloud is shown
+    std::vector<unsigned long> displayIndices;
+    /// The number of points of the point cloud if only a subset of it is shown
+    int numCloudPoints {0};
 
 private:
     static App::PropertyFloatConstraint::Constraints floatRange;
@@ -131,6 +137,8 @@ public:
     ViewProviderScattered();
     ~ViewProviderScattered() override;
 
+    App::PropertyIntegerConstraint MaxDisplayPoints;
+
     /**
      * Extracts the point data from the feature \a pcFeature and creates
      * an Inventor node \a SoNode with these data.
@@ -140,10 +148,17 @@ public:
     void updateData(const App::Property*) override;
 
 protected:
+    void onChanged(const App::Property* prop) override;
     void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer) override;
 
+private:
+    void createPoints(const Points::PropertyPointKernel*);
+
 protected:
     SoPointSet* pcPoints;
+
+private:
+    static App::PropertyIntegerConstraint::Constraints pointRange;
 };
 
 /**
@@ -27,6 +27,7 @@
 #include <TColgp_Array1OfPnt.hxx>
 
 
+#include <App/DocumentObjectPy.h>
 #include <Base/Console.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
@@ -34,7 +35,9 @@
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Mod/Mesh/App/MeshPy.h>
 #include <Mod/Part/App/BSplineSurfacePy.h>
+#include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/PointsPy.h>
+#include <Mod/Points/App/Properties.h>
 #if defined(HAVE_PCL_FILTERS)
 # include <pcl/filters/passthrough.h>
 # include <pcl/filters/voxel_grid.h>
@@ -96,6 +99,14 @@ public:
             "UVDirs: set the u,v parameter directions as tuple of two vectors\n"
             "        If not set then they will be determined by computing a best-fit plane\n"
         );
+        add_keyword_method("viewTriangulation",&Module::viewTriangulation,
+            "viewTriangulation(Points, Width, Height, [Viewpoint, AngleTolerance, MaxEdgeLength])\n"
+            "Triangulates a structured point cloud with Width columns and Height rows.\n"
+            "Invalid points are skipped. Triangles with an edge longer than MaxEdgeLength\n"
+            "are skipped, too. If Viewpoint is set then edges that are seen from it under an\n"
+            "angle smaller than AngleTolerance (in degrees) are treated as depth discontinuity.\n"
+            "A value of 0 disables the corresponding check.\n"
+        );
 #if defined(HAVE_PCL_SURFACE)
         add_keyword_method("triangulate",&Module::triangulate,
             "triangulate(PointKernel,searchRadius[,mu=2.5])."
@@ -103,9 +114,6 @@ public:
         add_keyword_method("poissonReconstruction",&Module::poissonReconstruction,
             "poissonReconstruction(PointKernel)."
         );
-        add_keyword_method("viewTriangulation",&Module::viewTriangulation,
-            "viewTriangulation(PointKernel, width, height)."
-        );
         add_keyword_method("gridProjection",&Module::gridProjection,
             "gridProjection(PointKernel)."
         );
@@ -125,11 +133,16 @@ public:
         add_keyword_method("filterVoxelGrid",&Module::filterVoxelGrid,
             "filterVoxelGrid(dim)."
         );
+#endif
         add_keyword_method("normalEstimation",&Module::normalEstimation,
-            "normalEstimation(Points,[KSearch=0, SearchRadius=0]) -> Normals\n"
+            "normalEstimation(Points,[KSearch=0, SearchRadius=0, Orient=True]) -> Normals\n"
             "KSearch is an int and used to search the k-nearest neighbours in\n"
             "the k-d tree. Alternatively, SearchRadius (a float) can be used\n"
-            "as spatial distance to determine the neighbours of a point\n"
+            "as spatial distance to determine the neighbours of a point.\n"
+            "If neither is set the 10 nearest neighbours are used.\n"
+            "If Orient is True the normals are oriented consistently.\n"
+            "If a points feature is passed instead of a points object the\n"
+            "normals are written to its Normal property and None is returned.\n"
             "Example:\n"
             "\n"
             "import ReverseEngineering as Reen\n"
@@ -143,7 +156,6 @@ public:
             "f.ViewObject.Proxy=0\n"
             "f.ViewObject.DisplayMode=1\n"
         );
-#endif
 #if defined(HAVE_PCL_SEGMENTATION)
         add_keyword_method("regionGrowingSegmentation",&Module::regionGrowingSegmentation,
             "regionGrowingSegmentation()."
@@ -455,6 +467,67 @@ private:
             throw Py::RuntimeError("Unknown C++ exception");
         }
     }
+   /*
+import ReverseEngineering as Reen
+import Points
+import Mesh
+import random
+import math
+r=random.Random()
+p=Points.Points()
+pts=[]
+for i in range(21):
+  for j in range(21):
+    pts.append(App.Vector(i,j,r.random()))
+p.addPoints(pts)
+m=Reen.viewTriangulation(p,21,21)
+Mesh.show(m)
+def boxmueller():
+  r1,r2=random.random(),random.random()
+  return math.sqrt(-2*math.log(r1))*math.cos(2*math.pi*r2)
+p=Points.Points()
+pts=[]
+for i in range(21):
+  for j in range(21):
+    pts.append(App.Vector(i,j,r.gauss(5,0.05)))
+p.addPoints(pts)
+m=Reen.viewTriangulation(p,21,21)
+Mesh.show(m)
+    */
+    Py::Object viewTriangulation(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject *pts;
+        int width = 0;
+        int height = 0;
+        PyObject *view = nullptr;
+        double angle = 0.0;
+        double maxEdge = 0.0;
+
+        static const std::array<const char*,7> kwds_view {"Points", "Width", "Height", "Viewpoint",
+                                                          "AngleTolerance", "MaxEdgeLength", NULL};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|iiOdd", kwds_view,
+                                        &(Points::PointsPy::Type), &pts,
+                                        &width, &height, &view, &angle, &maxEdge))
+            throw Py::Exception();
+
+        Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
+
+        try {
+            std::unique_ptr<Mesh::MeshObject> mesh(new Mesh::MeshObject());
+            ImageTriangulation tria(width, height, *points, *mesh);
+            tria.setMaxEdgeLength(float(maxEdge));
+            if (view) {
+                Base::Vector3d pos = Py::Vector(view).toVector();
+                tria.setViewpoint(Base::convertTo<Base::Vector3f>(pos), float(angle));
+            }
+            tria.perform();
+
+            return Py::asObject(new Mesh::MeshPy(mesh.release()));
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+    }
 #if defined(HAVE_PCL_SURFACE)
     /*
 import ReverseEngineering as Reen
@@ -550,58 +623,6 @@ Mesh.show(m)
 
         return Py::asObject(new Mesh::MeshPy(mesh));
     }
-   /*
-import ReverseEngineering as Reen
-import Points
-import Mesh
-import random
-import math
-r=random.Random()
-p=Points.Points()
-pts=[]
-for i in range(21):
-  for j in range(21):
-    pts.append(App.Vector(i,j,r.random()))
-p.addPoints(pts)
-m=Reen.viewTriangulation(p,21,21)
-Mesh.show(m)
-def boxmueller():
-  r1,r2=random.random(),random.random()
-  return math.sqrt(-2*math.log(r1))*math.cos(2*math.pi*r2)
-p=Points.Points()
-pts=[]
-for i in range(21):
-  for j in range(21):
-    pts.append(App.Vector(i,j,r.gauss(5,0.05)))
-p.addPoints(pts)
-m=Reen.viewTriangulation(p,21,21)
-Mesh.show(m)
-    */
-    Py::Object viewTriangulation(const Py::Tuple& args, const Py::Dict& kwds)
-    {
-        PyObject *pts;
-        int width;
-        int height;
-
-        static const std::array<const char*,4> kwds_view {"Points", "Width", "Height", NULL};
-        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|ii", kwds_view,
-                                        &(Points::PointsPy::Type), &pts,
-                                        &width, &height))
-            throw Py::Exception();
-
-        Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
-
-        try {
-            Mesh::MeshObject* mesh = new Mesh::MeshObject();
-            ImageTriangulation view(width, height, *points, *mesh);
-            view.perform();
-
-            return Py::asObject(new Mesh::MeshPy(mesh));
-        }
-        catch (const Base::Exception& e) {
-            throw Py::RuntimeError(e.what());
-        }
-    }
     Py::Object gridProjection(const Py::Tuple& args, const Py::Dict& kwds)
     {
         PyObject *pts;
@@ -798,25 +819,53 @@ Mesh.show(m)
         return Py::asObject(new Points::PointsPy(points_sample));
     }
 #endif
-#if defined(HAVE_PCL_FILTERS)
     Py::Object normalEstimation(const Py::Tuple& args, const Py::Dict& kwds)
     {
         PyObject *pts;
         int ksearch=0;
         double searchRadius=0;
+        PyObject *orient=Py_True;
 
-        static const std::array<const char*,4> kwds_normals {"Points", "KSearch", "SearchRadius", NULL};
-        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|id", kwds_normals,
-                                        &(Points::PointsPy::Type), &pts,
-                                        &ksearch, &searchRadius))
+        static const std::array<const char*,5> kwds_normals {"Points", "KSearch", "SearchRadius", "Orient", NULL};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O|idO!", kwds_normals,
+                                        &pts, &ksearch, &searchRadius,
+                                        &PyBool_Type, &orient))
             throw Py::Exception();
 
-        Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
+        Points::Feature* feature = nullptr;
+        const Points::PointKernel* points = nullptr;
+        if (PyObject_TypeCheck(pts, &(Points::PointsPy::Type))) {
+            points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
+        }
+        else if (PyObject_TypeCheck(pts, &(App::DocumentObjectPy::Type))) {
+            feature = freecad_cast<Points::Feature*>(static_cast<App::DocumentObjectPy*>(pts)->getDocumentObjectPtr());
+            if (feature) {
+                points = &feature->Points.getValue();
+            }
+        }
+        if (!points) {
+            throw Py::TypeError("Points object or points feature expected");
+        }
 
-        std::vector<Base::Vector3d> normals;
         NormalEstimation estimate(*points);
         estimate.setKSearch(ksearch);
         estimate.setSearchRadius(searchRadius);
+        estimate.setOrientNormals(Base::asBoolean(orient));
+
+        if (feature) {
+            auto prop = freecad_cast<Points::PropertyNormalList*>(feature->getPropertyByName("Normal"));
+            if (!prop) {
+                prop = freecad_cast<Points::PropertyNormalList*>(
+                    feature->addDynamicProperty("Points::PropertyNormalList", "Normal"));
+            }
+            if (!prop) {
+                throw Py::RuntimeError("Cannot add the Normal property");
+            }
+            estimate.perform(*prop);
+            return Py::None();
+        }
+
+        std::vector<Base::Vector3d> normals;
         estimate.perform(normals);
 
         Py::List list;
@@ -826,7 +875,6 @@ Mesh.show(m)
 
         return list;
     }
-#endif
 #if defined(HAVE_PCL_SEGMENTATION)
     Py::Object regionGrowingSegmentation(const Py::Tuple& args, const Py::Dict& kwds)
     {
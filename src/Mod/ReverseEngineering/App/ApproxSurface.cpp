@@ -22,14 +22,15 @@
  *                                                                         *
  ***************************************************************************/
 
-#include <QFuture>
-#include <QFutureWatcher>
+#include <QThreadPool>
 #include <QtConcurrentMap>
+#include <algorithm>
+#include <functional>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
 
 #include <Geom_BSplineSurface.hxx>
 #include <Precision.hxx>
-#include <math_Gauss.hxx>
-#include <math_Householder.hxx>
 
 #include <Base/Sequencer.h>
 #include <Base/Tools.h>
@@ -39,7 +40,22 @@
 
 
 using namespace Reen;
-namespace sp = std::placeholders;
+
+namespace
+{
+// Splits the index range [first, last] into about as many chunks as threads are available
+std::vector<int> makeChunks(int first, int last)
+{
+    int count = last - first + 1;
+    int numThreads = QThreadPool::globalInstance()->maxThreadCount();
+    int numChunks = std::clamp(numThreads, 1, std::max(count, 1));
+    std::vector<int> chunks(numChunks + 1);
+    for (int i = 0; i <= numChunks; i++) {
+        chunks[i] = first + int(static_cast<long long>(count) * i / numChunks);
+    }
+    return chunks;
+}
+}  // namespace
 
 // SplineBasisfunction
 
@@ -977,10 +993,14 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
         static_cast<size_t>(iIter) * static_cast<size_t>(_pvcPoints->Length())
     );
 
-    do {
-        fMaxScalar = 1.0;
-        fMaxDiff = 0.0;
+    // the points are projected in parallel, each chunk keeps its own maximum deviations
+    std::vector<int> chunks = makeChunks(_pvcPoints->Lower(), _pvcPoints->Upper());
+    std::vector<double> chunkDiff(chunks.size() - 1);
+    std::vector<double> chunkScalar(chunks.size() - 1);
+    std::vector<int> chunkIndex(chunks.size() - 1);
+    std::generate(chunkIndex.begin(), chunkIndex.end(), Base::iotaGen<int>(0));
 
+    do {
         Handle(Geom_BSplineSurface) pclBSplineSurf = new Geom_BSplineSurface(
             _vCtrlPntsOfSurf,
             _vUKnots,
@@ -991,50 +1011,58 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
             _usVOrder - 1
         );
 
-        for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-            double fDeltaU, fDeltaV, fU, fV;
-            const gp_Pnt& pnt = (*_pvcPoints)(ii);
-            gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
-            gp_Pnt PntX;
-            gp_Vec Xu, Xv, Xuv, Xuu, Xvv;
-            // Calculate the first two derivatives and point at (u,v)
-            gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
-            pclBSplineSurf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
-            gp_Vec X(PntX.X(), PntX.Y(), PntX.Z());
-            gp_Vec ErrorVec = X - P;
-
-            // Calculate Xu x Xv the normal in X(u,v)
-            gp_Dir clNormal = Xu ^ Xv;
-
-            // Check, if X = P
-            if (!(X.IsEqual(P, 0.001, 0.001))) {
-                ErrorVec.Normalize();
-                if (fabs(clNormal * ErrorVec) < fMaxScalar) {
-                    fMaxScalar = fabs(clNormal * ErrorVec);
+        QtConcurrent::blockingMap(chunkIndex, [&](int chunk) {
+            double fChunkDiff = 0.0, fChunkScalar = 1.0;
+            for (int ii = chunks[chunk]; ii < chunks[chunk + 1]; ii++) {
+                double fDeltaU, fDeltaV, fU, fV;
+                const gp_Pnt& pnt = (*_pvcPoints)(ii);
+                gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
+                gp_Pnt PntX;
+                gp_Vec Xu, Xv, Xuv, Xuu, Xvv;
+                // Calculate the first two derivatives and point at (u,v)
+                gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
+                pclBSplineSurf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
+                gp_Vec X(PntX.X(), PntX.Y(), PntX.Z());
+                gp_Vec ErrorVec = X - P;
+
+                // Calculate Xu x Xv the normal in X(u,v)
+                gp_Dir clNormal = Xu ^ Xv;
+
+                // Check, if X = P
+                if (!(X.IsEqual(P, 0.001, 0.001))) {
+                    ErrorVec.Normalize();
+                    if (fabs(clNormal * ErrorVec) < fChunkScalar) {
+                        fChunkScalar = fabs(clNormal * ErrorVec);
+                    }
                 }
-            }
 
-            fDeltaU = ((P - X) * Xu) / ((P - X) * Xuu - Xu * Xu);
-            if (fabs(fDeltaU) < Precision::Confusion()) {
-                fDeltaU = 0.0;
-            }
-            fDeltaV = ((P - X) * Xv) / ((P - X) * Xvv - Xv * Xv);
-            if (fabs(fDeltaV) < Precision::Confusion()) {
-                fDeltaV = 0.0;
-            }
+                fDeltaU = ((P - X) * Xu) / ((P - X) * Xuu - Xu * Xu);
+                if (fabs(fDeltaU) < Precision::Confusion()) {
+                    fDeltaU = 0.0;
+                }
+                fDeltaV = ((P - X) * Xv) / ((P - X) * Xvv - Xv * Xv);
+                if (fabs(fDeltaV) < Precision::Confusion()) {
+                    fDeltaV = 0.0;
+                }
 
-            // Replace old u/v values with new ones
-            fU = uvValue.X() - fDeltaU;
-            fV = uvValue.Y() - fDeltaV;
-            if (fU <= 1.0 && fU >= 0.0 && fV <= 1.0 && fV >= 0.0) {
-                uvValue.SetX(fU);
-                uvValue.SetY(fV);
-                fMaxDiff = std::max<double>(fabs(fDeltaU), fMaxDiff);
-                fMaxDiff = std::max<double>(fabs(fDeltaV), fMaxDiff);
+                // Replace old u/v values with new ones
+                fU = uvValue.X() - fDeltaU;
+                fV = uvValue.Y() - fDeltaV;
+                if (fU <= 1.0 && fU >= 0.0 && fV <= 1.0 && fV >= 0.0) {
+                    uvValue.SetX(fU);
+                    uvValue.SetY(fV);
+                    fChunkDiff = std::max<double>(fabs(fDeltaU), fChunkDiff);
+                    fChunkDiff = std::max<double>(fabs(fDeltaV), fChunkDiff);
+                }
             }
 
-            seq.next();
-        }
+            chunkDiff[chunk] = fChunkDiff;
+            chunkScalar[chunk] = fChunkScalar;
+        });
+
+        fMaxDiff = *std::max_element(chunkDiff.begin(), chunkDiff.end());
+        fMaxScalar = *std::min_element(chunkScalar.begin(), chunkScalar.end());
+        seq.setProgress(static_cast<size_t>(i + 1) * static_cast<size_t>(_pvcPoints->Length()));
 
         if (_bSmoothing) {
             fWeight *= 0.5f;
@@ -1050,227 +1078,190 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
 
 bool BSplineParameterCorrection::SolveWithoutSmoothing()
 {
-    unsigned ulSize = _pvcPoints->Length();
-    unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
-    math_Matrix Xx(0, ulDim - 1, 0, 0);
-    math_Matrix Xy(0, ulDim - 1, 0, 0);
-    math_Matrix Xz(0, ulDim - 1, 0, 0);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
-
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        unsigned ulIdx = 0;
-
-        // Pre-calculation of the values of the base functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
-        }
+    return SolveNormalEquations(0.0);
+}
 
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
+bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
+{
+    return SolveNormalEquations(fWeight);
+}
+
+namespace Reen
+{
+/*!
+ * The normal equations of the least-squares fit, or a part of them. A point only has
+ * non-zero basis functions for the uOrder * vOrder control points of its knot span,
+ * so a row of the system matrix has at most (2 * uOrder - 1) * (2 * vOrder - 1)
+ * non-zero entries. They are stored densely per row, ordered by the offset of the
+ * column to the row in u and v direction.
+ */
+class NormalEquations
+{
+public:
+    NormalEquations(unsigned uCtrl, unsigned vCtrl, unsigned uOrder, unsigned vOrder)
+        : uCtrl(int(uCtrl))
+        , vCtrl(int(vCtrl))
+        , uDegree(int(uOrder) - 1)
+        , vDegree(int(vOrder) - 1)
+        , uWidth(2 * uDegree + 1)
+        , vWidth(2 * vDegree + 1)
+        , values(std::size_t(uCtrl) * vCtrl * uWidth * vWidth, 0.0)
+        , rhs(std::size_t(uCtrl) * vCtrl * 3, 0.0)
+    {}
+
+    /// Adds the equation of a point whose knot spans start at the control point (j0, k0)
+    void addPoint(int j0, int k0, const double* basisU, const double* basisV, const gp_Pnt& pnt)
+    {
+        for (int a = 0; a <= uDegree; a++) {
+            for (int b = 0; b <= vDegree; b++) {
+                double weight = basisU[a] * basisV[b];
+                if (weight == 0.0) {
+                    continue;
                 }
-            }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
+                std::size_t row = std::size_t(j0 + a) * vCtrl + std::size_t(k0 + b);
+                rhs[row * 3] += weight * pnt.X();
+                rhs[row * 3 + 1] += weight * pnt.Y();
+                rhs[row * 3 + 2] += weight * pnt.Z();
+
+                double* entries = &values[row * uWidth * vWidth];
+                for (int c = 0; c <= uDegree; c++) {
+                    int du = c - a + uDegree;
+                    for (int d = 0; d <= vDegree; d++) {
+                        int dv = d - b + vDegree;
+                        entries[du * vWidth + dv] += weight * basisU[c] * basisV[d];
+                    }
                 }
             }
         }
     }
 
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
-    }
-
-    // Solve the over-determined LGS with Householder-Transformation
-    math_Householder hhX(M, bx);
-    math_Householder hhY(M, by);
-    math_Householder hhZ(M, bz);
-
-    if (!(hhX.IsDone() && hhY.IsDone() && hhZ.IsDone())) {
-        // LGS could not be solved
-        return false;
+    void add(const NormalEquations& other)
+    {
+        auto sum = std::plus<>();
+        std::transform(values.begin(), values.end(), other.values.begin(), values.begin(), sum);
+        std::transform(rhs.begin(), rhs.end(), other.rhs.begin(), rhs.begin(), sum);
     }
-    Xx = hhX.AllValues();
-    Xy = hhY.AllValues();
-    Xz = hhZ.AllValues();
 
-    unsigned ulIdx = 0;
-    for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            _vCtrlPntsOfSurf(j, k) = gp_Pnt(Xx(ulIdx, 0), Xy(ulIdx, 0), Xz(ulIdx, 0));
-            ulIdx++;
+    /// Converts the stored entries into a sparse matrix
+    void getMatrix(std::vector<Eigen::Triplet<double>>& triplets) const
+    {
+        for (int j = 0; j < uCtrl; j++) {
+            for (int k = 0; k < vCtrl; k++) {
+                std::size_t row = std::size_t(j) * vCtrl + k;
+                const double* entries = &values[row * uWidth * vWidth];
+                for (int du = 0; du < uWidth; du++) {
+                    int col_j = j + du - uDegree;
+                    if (col_j < 0 || col_j >= uCtrl) {
+                        continue;
+                    }
+                    for (int dv = 0; dv < vWidth; dv++) {
+                        int col_k = k + dv - vDegree;
+                        double value = entries[du * vWidth + dv];
+                        if (col_k >= 0 && col_k < vCtrl && value != 0.0) {
+                            triplets.emplace_back(int(row), col_j * vCtrl + col_k, value);
+                        }
+                    }
+                }
+            }
         }
     }
 
-    return true;
-}
-
-namespace Reen
-{
-class ScalarProduct
-{
-public:
-    explicit ScalarProduct(const math_Matrix& mat)
-        : mat(mat)
-    {}
-    std::vector<double> multiply(int col) const
+    Eigen::MatrixXd getRightHandSide() const
     {
-        math_Vector vec = mat.Col(col);
-        std::vector<double> out(mat.ColNumber());
-        for (int n = mat.LowerCol(); n <= mat.UpperCol(); n++) {
-            out[n] = vec * mat.Col(n);
+        Eigen::MatrixXd b(uCtrl * vCtrl, 3);
+        for (int i = 0; i < uCtrl * vCtrl; i++) {
+            b(i, 0) = rhs[std::size_t(i) * 3];
+            b(i, 1) = rhs[std::size_t(i) * 3 + 1];
+            b(i, 2) = rhs[std::size_t(i) * 3 + 2];
         }
-        return out;
+        return b;
     }
 
 private:
-    const math_Matrix& mat;
+    int uCtrl;
+    int vCtrl;
+    int uDegree;
+    int vDegree;
+    int uWidth;
+    int vWidth;
+    std::vector<double> values;
+    std::vector<double> rhs;
 };
 }  // namespace Reen
 
-bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
+bool BSplineParameterCorrection::SolveNormalEquations(double fWeight)
 {
-    unsigned ulSize = _pvcPoints->Length();
-    unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
-    math_Vector Xx(0, ulDim - 1);
-    math_Vector Xy(0, ulDim - 1);
-    math_Vector Xz(0, ulDim - 1);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
-    math_Vector Mbx(0, ulDim - 1);
-    math_Vector Mby(0, ulDim - 1);
-    math_Vector Mbz(0, ulDim - 1);
-
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        int ulIdx = 0;
-
-        // Pre-calculation of the values of the basis functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
-        }
-
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
-                }
-            }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
-                }
+    int uDegree = int(_usUOrder) - 1;
+    int vDegree = int(_usVOrder) - 1;
+    double uFirst = _vUKnots(_vUKnots.Lower());
+    double uLast = _vUKnots(_vUKnots.Upper());
+    double vFirst = _vVKnots(_vVKnots.Lower());
+    double vLast = _vVKnots(_vVKnots.Upper());
+
+    // Each chunk of points is accumulated into its own system
+    std::vector<int> chunks = makeChunks(_pvcPoints->Lower(), _pvcPoints->Upper());
+    std::vector<NormalEquations> partial(
+        chunks.size() - 1,
+        NormalEquations(_usUCtrlpoints, _usVCtrlpoints, _usUOrder, _usVOrder)
+    );
+    std::vector<int> chunkIndex(partial.size());
+    std::generate(chunkIndex.begin(), chunkIndex.end(), Base::iotaGen<int>(0));
+
+    QtConcurrent::blockingMap(chunkIndex, [&](int chunk) {
+        TColStd_Array1OfReal basisU(0, uDegree);
+        TColStd_Array1OfReal basisV(0, vDegree);
+        for (int ii = chunks[chunk]; ii < chunks[chunk + 1]; ii++) {
+            const gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
+            double fU = uvValue.X();
+            double fV = uvValue.Y();
+            // outside of the knot vectors all basis functions are zero
+            if (fU < uFirst || fU > uLast || fV < vFirst || fV > vLast) {
+                continue;
             }
-        }
-    }
 
-    // The product of its transform and itself results in the quadratic
-    // system matrix (slowly)
-#if 0
-    math_Matrix MTM = M.TMultiply(M);
-#elif 0
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    for (unsigned m = 0; m < ulDim; m++) {
-        math_Vector Mm = M.Col(m);
-        for (unsigned n = m; n < ulDim; n++) {
-            MTM(m, n) = MTM(n, m) = Mm * M.Col(n);
-        }
-    }
-#else  // multi-threaded
-    std::vector<int> columns(ulDim);
-    std::generate(columns.begin(), columns.end(), Base::iotaGen<int>(0));
-    ScalarProduct scalar(M);
-    // NOLINTBEGIN
-    QFuture<std::vector<double>> future
-        = QtConcurrent::mapped(columns, std::bind(&ScalarProduct::multiply, &scalar, sp::_1));
-    // NOLINTEND
-    QFutureWatcher<std::vector<double>> watcher;
-    watcher.setFuture(future);
-    watcher.waitForFinished();
-
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    int rowIndex = 0;
-    for (const auto& it : future) {
-        int colIndex = 0;
-        for (std::vector<double>::const_iterator jt = it.begin(); jt != it.end(); ++jt, colIndex++) {
-            MTM(rowIndex, colIndex) = *jt;
+            int j0 = _clUSpline.FindSpan(fU) - uDegree;
+            int k0 = _clVSpline.FindSpan(fV) - vDegree;
+            _clUSpline.AllBasisFunctions(fU, basisU);
+            _clVSpline.AllBasisFunctions(fV, basisV);
+            partial[chunk].addPoint(j0, k0, &basisU(0), &basisV(0), (*_pvcPoints)(ii));
         }
-        rowIndex++;
-    }
-#endif
+    });
 
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
-    }
-    for (unsigned i = 0; i < ulDim; i++) {
-        math_Vector Mi = M.Col(i);
-        Mbx(i) = Mi * bx;
-        Mby(i) = Mi * by;
-        Mbz(i) = Mi * bz;
+    for (std::size_t i = 1; i < partial.size(); i++) {
+        partial[0].add(partial[i]);
     }
 
-    // Solve the LGS with the LU decomposition
-    math_Gauss mgGaussX(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussY(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussZ(MTM + fWeight * _clSmoothMatrix);
-
-    mgGaussX.Solve(Mbx, Xx);
-    if (!mgGaussX.IsDone()) {
-        return false;
+    int ulDim = int(_usUCtrlpoints * _usVCtrlpoints);
+    std::vector<Eigen::Triplet<double>> triplets;
+    partial[0].getMatrix(triplets);
+    if (fWeight != 0.0) {
+        for (int m = 0; m < ulDim; m++) {
+            for (int n = 0; n < ulDim; n++) {
+                double value = _clSmoothMatrix(m, n);
+                if (value != 0.0) {
+                    triplets.emplace_back(m, n, fWeight * value);
+                }
+            }
+        }
     }
 
-    mgGaussY.Solve(Mby, Xy);
-    if (!mgGaussY.IsDone()) {
+    Eigen::SparseMatrix<double> MTM(ulDim, ulDim);
+    MTM.setFromTriplets(triplets.begin(), triplets.end());
+
+    // Solve the LGS with the Cholesky decomposition
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver(MTM);
+    if (solver.info() != Eigen::Success) {
         return false;
     }
-
-    mgGaussZ.Solve(Mbz, Xz);
-    if (!mgGaussZ.IsDone()) {
+    Eigen::MatrixXd X = solver.solve(partial[0].getRightHandSide());
+    if (solver.info() != Eigen::Success || !X.allFinite()) {
         return false;
     }
 
     unsigned ulIdx = 0;
     for (unsigned j = 0; j < _usUCtrlpoints; j++) {
         for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            _vCtrlPntsOfSurf(j, k) = gp_Pnt(Xx(ulIdx), Xy(ulIdx), Xz(ulIdx));
+            _vCtrlPntsOfSurf(j, k) = gp_Pnt(X(ulIdx, 0), X(ulIdx, 1), X(ulIdx, 2));
             ulIdx++;
         }
     }
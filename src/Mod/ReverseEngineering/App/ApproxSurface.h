@@ -413,16 +413,23 @@ protected:
     void DoParameterCorrection(int iIter) override;
 
     /**
-     * Solve an overdetermined LGS with the help of the Householder-Tansformation
+     * Solve the overdetermined LGS in the least-squares sense
      */
     bool SolveWithoutSmoothing() override;
 
     /**
-     * Solve a regular system of equations by LU decomposition. Depending on the weighting,
-     * smoothing terms are included
+     * Solve the least-squares problem including the smoothing terms scaled by the weighting
      */
     bool SolveWithSmoothing(double fWeight) override;
 
+    /**
+     * Assembles the normal equations of the least-squares problem in parallel and solves them
+     * by a sparse Cholesky decomposition. As each point only affects the control points of
+     * one knot span the system matrix is sparse. If \a fWeight is not zero the smoothing terms
+     * are added.
+     */
+    bool SolveNormalEquations(double fWeight);
+
 public:
     /**
      * Setting the knot vector
@@ -23,7 +23,19 @@
  ***************************************************************************/
 
 
+#include <QtConcurrentMap>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <tuple>
+#include <Eigen/Eigenvalues>
+
+#include <Base/Converter.h>
+#include <Mod/Mesh/App/Core/KDTree.h>
 #include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/Properties.h>
 
 #include "Segmentation.h"
 
@@ -161,56 +173,211 @@ void Segmentation::perform(int ksearch)
 
 // ----------------------------------------------------------------------------
 
-#if defined(HAVE_PCL_FILTERS)
 NormalEstimation::NormalEstimation(const Points::PointKernel& pts)
     : myPoints(pts)
     , kSearch(0)
     , searchRadius(0)
+    , orientNormals(true)
 {}
 
 void NormalEstimation::perform(std::vector<Base::Vector3d>& normals)
 {
-    // Copy the points
-    pcl::PointCloud<PointXYZ>::Ptr cloud(new pcl::PointCloud<PointXYZ>);
-    cloud->reserve(myPoints.size());
-    for (Points::PointKernel::const_iterator it = myPoints.begin(); it != myPoints.end(); ++it) {
-        cloud->push_back(pcl::PointXYZ(it->x, it->y, it->z));
+    std::vector<Base::Vector3f> result;
+    compute(result);
+
+    normals.reserve(result.size());
+    for (const auto& it : result) {
+        normals.push_back(Base::convertTo<Base::Vector3d>(it));
     }
+}
 
-    cloud->width = int(cloud->points.size());
-    cloud->height = 1;
+void NormalEstimation::perform(Points::PropertyNormalList& normals)
+{
+    std::vector<Base::Vector3f> result;
+    compute(result);
+
+    // the property keeps the normals in the local coordinate system of the points
+    Base::Matrix4D mat = myPoints.getTransform();
+    mat.setCol(3, Base::Vector3d());
+    mat.inverseGauss();
+    for (auto& it : result) {
+        mat.multVec(it, it);
+        if (it.Sqr() > 0.0F) {
+            it.Normalize();
+        }
+    }
 
-# if 0
-    // Build a passthrough filter to remove spurious NaNs
-    pcl::PointCloud<PointXYZ>::Ptr cloud_filtered (new pcl::PointCloud<PointXYZ>);
-    pcl::PassThrough<PointXYZ> pass;
-    pass.setInputCloud (cloud);
-    pass.setFilterFieldName ("z");
-    pass.setFilterLimits (0, 1.5);
-    pass.filter (*cloud_filtered);
-# endif
+    normals.setValues(result);
+}
 
-    // Estimate point normals
-    pcl::PointCloud<pcl::Normal>::Ptr cloud_normals(new pcl::PointCloud<pcl::Normal>);
-    pcl::search::KdTree<PointXYZ>::Ptr tree(new pcl::search::KdTree<PointXYZ>());
-    pcl::NormalEstimation<PointXYZ, pcl::Normal> ne;
-    ne.setSearchMethod(tree);
-    // ne.setInputCloud (cloud_filtered);
-    ne.setInputCloud(cloud);
-    if (kSearch > 0) {
-        ne.setKSearch(kSearch);
+void NormalEstimation::compute(std::vector<Base::Vector3f>& normals) const
+{
+    // Copy the points and skip the invalid ones for the search
+    std::vector<Base::Vector3f> points;
+    std::vector<Base::Vector3f> valid;
+    std::vector<unsigned long> validIndex;
+    points.reserve(myPoints.size());
+    for (Points::PointKernel::const_iterator it = myPoints.begin(); it != myPoints.end(); ++it) {
+        Base::Vector3f pnt = Base::convertTo<Base::Vector3f>(*it);
+        points.push_back(pnt);
+        if (std::isfinite(pnt.x) && std::isfinite(pnt.y) && std::isfinite(pnt.z)) {
+            validIndex.push_back(points.size() - 1);
+            valid.push_back(pnt);
+        }
     }
-    if (searchRadius > 0) {
-        ne.setRadiusSearch(searchRadius);
+
+    normals.assign(points.size(), Base::Vector3f());
+    if (valid.empty()) {
+        return;
+    }
+
+    MeshCore::MeshStaticKDTree tree(valid);
+
+    // Search the neighbours of each point, the point itself is among them
+    std::vector<std::size_t> offsets;
+    std::vector<MeshCore::PointIndex> found;
+    if (kSearch > 0 || searchRadius <= 0) {
+        std::size_t k = kSearch > 0 ? std::size_t(kSearch) : 10;
+        float maxDist = searchRadius > 0 ? float(searchRadius) : std::numeric_limits<float>::max();
+        std::vector<float> dists;
+        tree.FindNearest(valid, k, maxDist, found, dists);
+
+        offsets.resize(valid.size() + 1);
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < valid.size(); i++) {
+            offsets[i] = pos;
+            for (std::size_t j = i * k; j < (i + 1) * k; j++) {
+                if (found[j] != MeshCore::POINT_INDEX_MAX) {
+                    found[pos++] = found[j];
+                }
+            }
+        }
+        offsets.back() = pos;
+        found.resize(pos);
+    }
+    else {
+        tree.FindInRange(valid, float(searchRadius), offsets, found);
     }
-    ne.compute(*cloud_normals);
 
-    normals.reserve(cloud_normals->size());
-    for (pcl::PointCloud<pcl::Normal>::const_iterator it = cloud_normals->begin();
-         it != cloud_normals->end();
-         ++it) {
-        normals.push_back(Base::Vector3d(it->normal_x, it->normal_y, it->normal_z));
+    std::vector<unsigned long> neighbours(found.begin(), found.end());
+
+    // Fit a plane to each neighbourhood
+    std::vector<Base::Vector3f> validNormals(valid.size());
+    std::vector<std::size_t> chunks((valid.size() + 1023) / 1024);
+    std::iota(chunks.begin(), chunks.end(), 0);
+    QtConcurrent::blockingMap(chunks, [&](std::size_t chunk) {
+        std::size_t last = std::min((chunk + 1) * 1024, valid.size());
+        for (std::size_t i = chunk * 1024; i < last; i++) {
+            std::size_t count = offsets[i + 1] - offsets[i];
+            if (count < 3) {
+                continue;
+            }
+
+            Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+            for (std::size_t j = offsets[i]; j < offsets[i + 1]; j++) {
+                const Base::Vector3f& pnt = valid[neighbours[j]];
+                mean += Eigen::Vector3d(pnt.x, pnt.y, pnt.z);
+            }
+            mean /= double(count);
+
+            Eigen::Matrix3d covMat = Eigen::Matrix3d::Zero();
+            for (std::size_t j = offsets[i]; j < offsets[i + 1]; j++) {
+                const Base::Vector3f& pnt = valid[neighbours[j]];
+                Eigen::Vector3d diff = Eigen::Vector3d(pnt.x, pnt.y, pnt.z) - mean;
+                covMat += diff * diff.transpose();
+            }
+
+            // the eigenvector of the smallest eigenvalue is the normal
+            Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eig;
+            eig.computeDirect(covMat);
+            Eigen::Vector3d normal = eig.eigenvectors().col(0);
+            validNormals[i].Set(float(normal.x()), float(normal.y()), float(normal.z()));
+            validNormals[i].Normalize();
+        }
+    });
+
+    if (orientNormals) {
+        orient(valid, offsets, neighbours, validNormals);
+    }
+
+    for (std::size_t i = 0; i < valid.size(); i++) {
+        normals[validIndex[i]] = validNormals[i];
     }
 }
 
-#endif  // HAVE_PCL_FILTERS
+void NormalEstimation::orient(
+    const std::vector<Base::Vector3f>& points,
+    const std::vector<std::size_t>& offsets,
+    const std::vector<unsigned long>& neighbours,
+    std::vector<Base::Vector3f>& normals
+) const
+{
+    // Make the neighbourhood graph symmetric
+    std::size_t numPoints = points.size();
+    std::vector<std::size_t> degree(numPoints + 1, 0);
+    for (std::size_t i = 0; i < numPoints; i++) {
+        for (std::size_t j = offsets[i]; j < offsets[i + 1]; j++) {
+            if (neighbours[j] != i) {
+                degree[i + 1]++;
+                degree[neighbours[j] + 1]++;
+            }
+        }
+    }
+    std::partial_sum(degree.begin(), degree.end(), degree.begin());
+    std::vector<unsigned long> edges(degree.back());
+    std::vector<std::size_t> fill(degree.begin(), degree.end() - 1);
+    for (std::size_t i = 0; i < numPoints; i++) {
+        for (std::size_t j = offsets[i]; j < offsets[i + 1]; j++) {
+            unsigned long n = neighbours[j];
+            if (n != i) {
+                edges[fill[i]++] = n;
+                edges[fill[n]++] = i;
+            }
+        }
+    }
+
+    // Each connected part starts at its highest point with a normal pointing upwards
+    std::vector<unsigned long> seeds(numPoints);
+    std::iota(seeds.begin(), seeds.end(), 0);
+    std::stable_sort(seeds.begin(), seeds.end(), [&points](unsigned long a, unsigned long b) {
+        return points[a].z > points[b].z;
+    });
+
+    // Prim's algorithm where the weight of an edge is 1 - |n1 * n2| so that the orientation is
+    // first propagated between nearly parallel normals
+    using Edge = std::tuple<float, unsigned long, unsigned long>;  // weight, from, to
+    std::priority_queue<Edge, std::vector<Edge>, std::greater<>> queue;
+    std::vector<bool> visited(numPoints, false);
+    auto visit = [&](unsigned long index) {
+        visited[index] = true;
+        const Base::Vector3f& normal = normals[index];
+        for (std::size_t j = degree[index]; j < degree[index + 1]; j++) {
+            unsigned long n = edges[j];
+            if (!visited[n]) {
+                float weight = 1.0F - std::fabs(normal * normals[n]);
+                queue.emplace(weight, index, n);
+            }
+        }
+    };
+
+    for (unsigned long seed : seeds) {
+        if (visited[seed]) {
+            continue;
+        }
+        if (normals[seed].z < 0.0F) {
+            normals[seed] = -normals[seed];
+        }
+        visit(seed);
+        while (!queue.empty()) {
+            auto [weight, from, to] = queue.top();
+            queue.pop();
+            if (visited[to]) {
+                continue;
+            }
+            if (normals[from] * normals[to] < 0.0F) {
+                normals[to] = -normals[to];
+            }
+            visit(to);
+        }
+    }
+}
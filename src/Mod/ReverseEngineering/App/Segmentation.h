@@ -33,6 +33,7 @@
 namespace Points
 {
 class PointKernel;
+class PropertyNormalList;
 }
 
 namespace Reen
@@ -52,6 +53,14 @@ private:
     std::list<std::vector<int>>& myClusters;
 };
 
+/*!
+ * The NormalEstimation class computes the normals of a point cloud by principal component
+ * analysis of the neighbourhood of each point. The neighbours are searched in a static kd-tree
+ * and the normals are computed in parallel. Afterwards the normals are oriented consistently by
+ * propagating the orientation along a minimum spanning tree of the neighbourhood graph, where
+ * each connected part of the cloud starts with a normal pointing in +z direction.
+ * Points with too few valid neighbours get a null vector.
+ */
 class NormalEstimation
 {
 public:
@@ -73,15 +82,37 @@ public:
         searchRadius = radius;
     }
 
+    /** \brief Set whether the normals are oriented consistently.
+     * \param[in] on if false the sign of each normal is arbitrary
+     */
+    inline void setOrientNormals(bool on)
+    {
+        orientNormals = on;
+    }
+
     /** \brief Perform the normal estimation.
      * \param[out] the estimated normals
      */
     void perform(std::vector<Base::Vector3d>& normals);
+    /** \brief Perform the normal estimation.
+     * \param[out] the property the estimated normals are written to
+     */
+    void perform(Points::PropertyNormalList& normals);
+
+private:
+    void compute(std::vector<Base::Vector3f>& normals) const;
+    void orient(
+        const std::vector<Base::Vector3f>& points,
+        const std::vector<std::size_t>& offsets,
+        const std::vector<unsigned long>& neighbours,
+        std::vector<Base::Vector3f>& normals
+    ) const;
 
 private:
     const Points::PointKernel& myPoints;
     int kSearch;
     double searchRadius;
+    bool orientNormals;
 };
 
 }  // namespace Reen
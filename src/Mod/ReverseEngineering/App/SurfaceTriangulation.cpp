@@ -23,7 +23,14 @@
  ***************************************************************************/
 
 
+#include <array>
+#include <cmath>
+#include <numeric>
+
+#include <QtConcurrentMap>
+
 #include <Base/Exception.h>
+#include <Base/Tools.h>
 #include <Mod/Mesh/App/Core/Algorithm.h>
 #include <Mod/Mesh/App/Core/Elements.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -417,90 +424,6 @@ void GridReconstruction::perform(const std::vector<Base::Vector3f>& normals)
 
 // ----------------------------------------------------------------------------
 
-ImageTriangulation::ImageTriangulation(
-    int width,
-    int height,
-    const Points::PointKernel& pts,
-    Mesh::MeshObject& mesh
-)
-    : width(width)
-    , height(height)
-    , myPoints(pts)
-    , myMesh(mesh)
-{}
-
-void ImageTriangulation::perform()
-{
-    if (myPoints.size() != static_cast<std::size_t>(width * height)) {
-        throw Base::RuntimeError("Number of points doesn't match with given width and height");
-    }
-
-    // construct dataset
-    pcl::PointCloud<pcl::PointXYZ>::Ptr cloud_organized(new pcl::PointCloud<pcl::PointXYZ>());
-    cloud_organized->width = width;
-    cloud_organized->height = height;
-    cloud_organized->points.resize(cloud_organized->width * cloud_organized->height);
-
-    const std::vector<Base::Vector3f>& points = myPoints.getBasicPoints();
-
-    int npoints = 0;
-    for (size_t i = 0; i < cloud_organized->height; i++) {
-        for (size_t j = 0; j < cloud_organized->width; j++) {
-            const Base::Vector3f& p = points[npoints];
-            cloud_organized->points[npoints].x = p.x;
-            cloud_organized->points[npoints].y = p.y;
-            cloud_organized->points[npoints].z = p.z;
-            npoints++;
-        }
-    }
-
-    OrganizedFastMesh<PointXYZ> ofm;
-
-    // Set parameters
-    ofm.setInputCloud(cloud_organized);
-    // This parameter is not yet implemented (pcl 1.7)
-    ofm.setMaxEdgeLength(1.5);
-    ofm.setTrianglePixelSize(1);
-    ofm.setTriangulationType(OrganizedFastMesh<PointXYZ>::TRIANGLE_ADAPTIVE_CUT);
-    ofm.storeShadowedFaces(true);
-
-    // Reconstruct
-    PolygonMesh mesh;
-    ofm.reconstruct(mesh);
-
-    MeshConversion::convert(mesh, myMesh);
-
-    // remove invalid points
-    //
-    MeshCore::MeshKernel& kernel = myMesh.getKernel();
-    const MeshCore::MeshFacetArray& face = kernel.GetFacets();
-    MeshCore::MeshAlgorithm meshAlg(kernel);
-    meshAlg.SetPointFlag(MeshCore::MeshPoint::INVALID);
-    std::vector<MeshCore::PointIndex> validPoints;
-    validPoints.reserve(face.size() * 3);
-    for (MeshCore::MeshFacetArray::_TConstIterator it = face.begin(); it != face.end(); ++it) {
-        validPoints.push_back(it->_aulPoints[0]);
-        validPoints.push_back(it->_aulPoints[1]);
-        validPoints.push_back(it->_aulPoints[2]);
-    }
-
-    // remove duplicates
-    std::sort(validPoints.begin(), validPoints.end());
-    validPoints.erase(std::unique(validPoints.begin(), validPoints.end()), validPoints.end());
-    meshAlg.ResetPointsFlag(validPoints, MeshCore::MeshPoint::INVALID);
-
-    unsigned long countInvalid = meshAlg.CountPointFlag(MeshCore::MeshPoint::INVALID);
-    if (countInvalid > 0) {
-        std::vector<MeshCore::PointIndex> invalidPoints;
-        invalidPoints.reserve(countInvalid);
-        meshAlg.GetPointsFlag(invalidPoints, MeshCore::MeshPoint::INVALID);
-
-        kernel.DeletePoints(invalidPoints);
-    }
-}
-
-// ----------------------------------------------------------------------------
-
 Reen::MarchingCubesRBF::MarchingCubesRBF(const Points::PointKernel& pts, Mesh::MeshObject& mesh)
     : myPoints(pts)
     , myMesh(mesh)
@@ -774,3 +697,307 @@ void MeshConversion::convert(const pcl::PolygonMesh& pclMesh, Mesh::MeshObject&
 }
 
 #endif  // HAVE_PCL_SURFACE
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+// The triangles a cell of four neighboured grid points can be split into. A cell with four
+// valid points is split along its shorter diagonal into either T1 and T2 or T3 and T4.
+enum CellTriangle : unsigned char
+{
+    T1 = 1,  // (p00, p10, p11)
+    T2 = 2,  // (p00, p11, p01)
+    T3 = 4,  // (p00, p10, p01)
+    T4 = 8   // (p01, p10, p11)
+};
+
+// the corners of the triangles given as (row, column) offsets inside the cell
+const std::array<std::array<std::array<int, 2>, 3>, 4> cellCorners {{
+    {{{0, 0}, {1, 0}, {1, 1}}},
+    {{{0, 0}, {1, 1}, {0, 1}}},
+    {{{0, 0}, {1, 0}, {0, 1}}},
+    {{{0, 1}, {1, 0}, {1, 1}}},
+}};
+
+// the cell sides, the diagonal is shared with the other triangle of the same cell
+enum CellSide
+{
+    Left,
+    Right,
+    Top,
+    Bottom,
+    Diagonal
+};
+
+// the side of the cell each triangle edge lies on
+const std::array<std::array<CellSide, 3>, 4> cellEdges {{
+    {Left, Bottom, Diagonal},
+    {Diagonal, Right, Top},
+    {Left, Diagonal, Top},
+    {Diagonal, Bottom, Right},
+}};
+
+int countTriangles(unsigned char mask)
+{
+    return (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + ((mask >> 3) & 1);
+}
+
+bool isValid(const Base::Vector3f& pnt)
+{
+    return std::isfinite(pnt.x) && std::isfinite(pnt.y) && std::isfinite(pnt.z);
+}
+}  // namespace
+
+Reen::ImageTriangulation::ImageTriangulation(
+    int width,
+    int height,
+    const Points::PointKernel& pts,
+    Mesh::MeshObject& mesh
+)
+    : width(width)
+    , height(height)
+    , myPoints(pts)
+    , myMesh(mesh)
+{}
+
+void Reen::ImageTriangulation::setMaxEdgeLength(float length)
+{
+    maxEdgeLength = length;
+}
+
+void Reen::ImageTriangulation::setViewpoint(const Base::Vector3f& pnt, float degrees)
+{
+    viewpoint = pnt;
+    sqrCosTolerance = 0.0F;
+    if (degrees > 0.0F) {
+        float cosTolerance = std::cos(Base::toRadians(degrees));
+        sqrCosTolerance = cosTolerance * cosTolerance;
+    }
+}
+
+bool Reen::ImageTriangulation::acceptEdge(const Base::Vector3f& p1, const Base::Vector3f& p2) const
+{
+    Base::Vector3f edge = p2 - p1;
+    float sqrLength = edge.Sqr();
+    if (maxEdgeLength > 0.0F && sqrLength > maxEdgeLength * maxEdgeLength) {
+        return false;
+    }
+
+    // at a depth discontinuity the edge points (nearly) along the viewing ray
+    if (sqrCosTolerance > 0.0F) {
+        Base::Vector3f ray = p1 - viewpoint;
+        float dot = ray * edge;
+        if (dot * dot > sqrCosTolerance * ray.Sqr() * sqrLength) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Reen::ImageTriangulation::perform()
+{
+    if (width < 0 || height < 0
+        || myPoints.size() != static_cast<std::size_t>(width) * static_cast<std::size_t>(height)) {
+        throw Base::RuntimeError("Number of points doesn't match with given width and height");
+    }
+
+    const std::vector<Base::Vector3f>& points = myPoints.getBasicPoints();
+    const std::size_t cols = std::size_t(width);
+    const std::size_t rows = std::size_t(height);
+    const std::size_t cellCols = cols > 0 ? cols - 1 : 0;
+    const std::size_t cellRows = rows > 0 ? rows - 1 : 0;
+
+    std::vector<std::size_t> rowIndexes(rows);
+    std::iota(rowIndexes.begin(), rowIndexes.end(), 0);
+
+    // decide for every cell which triangles it is split into
+    std::vector<unsigned char> cells(cellRows * cellCols, 0);
+    QtConcurrent::blockingMap(rowIndexes, [&](std::size_t row) {
+        if (row >= cellRows) {
+            return;
+        }
+        for (std::size_t col = 0; col < cellCols; col++) {
+            const Base::Vector3f& p00 = points[row * cols + col];
+            const Base::Vector3f& p01 = points[row * cols + col + 1];
+            const Base::Vector3f& p10 = points[(row + 1) * cols + col];
+            const Base::Vector3f& p11 = points[(row + 1) * cols + col + 1];
+            bool v00 = isValid(p00);
+            bool v01 = isValid(p01);
+            bool v10 = isValid(p10);
+            bool v11 = isValid(p11);
+
+            unsigned char candidates = 0;
+            if (v00 && v01 && v10 && v11) {
+                if (Base::DistanceP2(p00, p11) <= Base::DistanceP2(p01, p10)) {
+                    candidates = T1 | T2;
+                }
+                else {
+                    candidates = T3 | T4;
+                }
+            }
+            else if (v00 && v10 && v11) {
+                candidates = T1;
+            }
+            else if (v00 && v11 && v01) {
+                candidates = T2;
+            }
+            else if (v00 && v10 && v01) {
+                candidates = T3;
+            }
+            else if (v01 && v10 && v11) {
+                candidates = T4;
+            }
+
+            unsigned char mask = 0;
+            for (int k = 0; k < 4; k++) {
+                if ((candidates & (1 << k)) == 0) {
+                    continue;
+                }
+
+                const auto& corners = cellCorners[k];
+                std::array<const Base::Vector3f*, 3> tria {};
+                for (int i = 0; i < 3; i++) {
+                    tria[i] = &points[(row + corners[i][0]) * cols + col + corners[i][1]];
+                }
+                if (acceptEdge(*tria[0], *tria[1]) && acceptEdge(*tria[1], *tria[2])
+                    && acceptEdge(*tria[2], *tria[0])) {
+                    mask |= static_cast<unsigned char>(1 << k);
+                }
+            }
+            cells[row * cellCols + col] = mask;
+        }
+    });
+
+    // a point is kept if it's a corner of at least one triangle
+    auto cellAt = [&](std::size_t row, std::size_t col) {
+        return cells[row * cellCols + col];
+    };
+    auto isUsed = [&](std::size_t row, std::size_t col) {
+        bool used = false;
+        if (row < cellRows && col < cellCols) {
+            used = used || (cellAt(row, col) & (T1 | T2 | T3)) != 0;
+        }
+        if (row < cellRows && col > 0) {
+            used = used || (cellAt(row, col - 1) & (T2 | T3 | T4)) != 0;
+        }
+        if (row > 0 && col < cellCols) {
+            used = used || (cellAt(row - 1, col) & (T1 | T3 | T4)) != 0;
+        }
+        if (row > 0 && col > 0) {
+            used = used || (cellAt(row - 1, col - 1) & (T1 | T2 | T4)) != 0;
+        }
+        return used;
+    };
+
+    std::vector<std::size_t> pointOffsets(rows + 1, 0);
+    std::vector<std::size_t> facetOffsets(rows + 1, 0);
+    QtConcurrent::blockingMap(rowIndexes, [&](std::size_t row) {
+        std::size_t numPoints = 0;
+        std::size_t numFacets = 0;
+        for (std::size_t col = 0; col < cols; col++) {
+            if (isUsed(row, col)) {
+                numPoints++;
+            }
+            if (row < cellRows && col < cellCols) {
+                numFacets += countTriangles(cellAt(row, col));
+            }
+        }
+        pointOffsets[row + 1] = numPoints;
+        facetOffsets[row + 1] = numFacets;
+    });
+    for (std::size_t row = 0; row < rows; row++) {
+        pointOffsets[row + 1] += pointOffsets[row];
+        facetOffsets[row + 1] += facetOffsets[row];
+    }
+
+    // number the points and the first facet of every cell
+    MeshCore::MeshPointArray meshPoints(pointOffsets[rows]);
+    std::vector<MeshCore::PointIndex> pointIndexes(points.size(), MeshCore::POINT_INDEX_MAX);
+    std::vector<MeshCore::FacetIndex> cellFacets(cells.size(), MeshCore::FACET_INDEX_MAX);
+    QtConcurrent::blockingMap(rowIndexes, [&](std::size_t row) {
+        std::size_t pointIndex = pointOffsets[row];
+        std::size_t facetIndex = facetOffsets[row];
+        for (std::size_t col = 0; col < cols; col++) {
+            if (isUsed(row, col)) {
+                pointIndexes[row * cols + col] = MeshCore::PointIndex(pointIndex);
+                meshPoints[pointIndex++] = points[row * cols + col];
+            }
+            if (row < cellRows && col < cellCols) {
+                cellFacets[row * cellCols + col] = MeshCore::FacetIndex(facetIndex);
+                facetIndex += countTriangles(cellAt(row, col));
+            }
+        }
+    });
+
+    // The neighbourhood follows from the grid: a triangle edge is either the diagonal of its
+    // cell or a cell side that can only be shared with the adjacent cell.
+    auto facetOf = [&](std::size_t row, std::size_t col, int owners) {
+        unsigned char mask = cellAt(row, col);
+        for (int k = 0; k < 4; k++) {
+            if ((mask & owners & (1 << k)) != 0) {
+                return cellFacets[row * cellCols + col]
+                    + MeshCore::FacetIndex(countTriangles(mask & ((1 << k) - 1)));
+            }
+        }
+        return MeshCore::FACET_INDEX_MAX;
+    };
+
+    MeshCore::MeshFacetArray meshFacets(facetOffsets[rows]);
+    QtConcurrent::blockingMap(rowIndexes, [&](std::size_t row) {
+        if (row >= cellRows) {
+            return;
+        }
+        for (std::size_t col = 0; col < cellCols; col++) {
+            unsigned char mask = cellAt(row, col);
+            MeshCore::FacetIndex index = cellFacets[row * cellCols + col];
+            for (int k = 0; k < 4; k++) {
+                if ((mask & (1 << k)) == 0) {
+                    continue;
+                }
+
+                MeshCore::MeshFacet& facet = meshFacets[index++];
+                for (int i = 0; i < 3; i++) {
+                    const auto& corner = cellCorners[k][i];
+                    std::size_t pos = (row + corner[0]) * cols + col + corner[1];
+                    facet._aulPoints[i] = pointIndexes[pos];
+
+                    MeshCore::FacetIndex neighbour = MeshCore::FACET_INDEX_MAX;
+                    switch (cellEdges[k][i]) {
+                        case Left:
+                            if (col > 0) {
+                                neighbour = facetOf(row, col - 1, T2 | T4);
+                            }
+                            break;
+                        case Right:
+                            if (col + 1 < cellCols) {
+                                neighbour = facetOf(row, col + 1, T1 | T3);
+                            }
+                            break;
+                        case Top:
+                            if (row > 0) {
+                                neighbour = facetOf(row - 1, col, T1 | T4);
+                            }
+                            break;
+                        case Bottom:
+                            if (row + 1 < cellRows) {
+                                neighbour = facetOf(row + 1, col, T2 | T3);
+                            }
+                            break;
+                        case Diagonal:
+                            // T1 pairs with T2 and T3 with T4
+                            neighbour = facetOf(row, col, 1 << (k ^ 1));
+                            break;
+                    }
+                    facet._aulNeighbours[i] = neighbour;
+                }
+            }
+        }
+    });
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(meshPoints, meshFacets, false);
+    myMesh.swap(kernel);
+    myMesh.setTransform(myPoints.getTransform());
+}
@@ -161,14 +161,32 @@ private:
     Mesh::MeshObject& myMesh;
 };
 
+/** Triangulates an organized point cloud of \a width columns and \a height rows.
+ * Neighboured grid points are connected directly, invalid points are skipped. The
+ * triangulation doesn't depend on PCL.
+ */
 class ImageTriangulation
 {
 public:
     ImageTriangulation(int width, int height, const Points::PointKernel&, Mesh::MeshObject&);
+    /// Triangles with an edge longer than \a length are skipped, 0 disables the check
+    void setMaxEdgeLength(float length);
+    /** Sets the position of the scanner. An edge that is seen from \a pnt under an angle
+     * smaller than \a degrees is regarded as depth discontinuity and its triangles are skipped.
+     * An angle of 0 disables the check.
+     */
+    void setViewpoint(const Base::Vector3f& pnt, float degrees);
     void perform();
 
+private:
+    bool acceptEdge(const Base::Vector3f& p1, const Base::Vector3f& p2) const;
+
 private:
     int width, height;
+    float maxEdgeLength {0.0F};
+    Base::Vector3f viewpoint;
+    // squared cosine of the angle tolerance, 0 if disabled
+    float sqrCosTolerance {0.0F};
     const Points::PointKernel& myPoints;
     Mesh::MeshObject& myMesh;
 };
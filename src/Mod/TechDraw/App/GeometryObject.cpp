@@ -32,7 +32,6 @@
 #include <BRepBuilderAPI_Transform.hxx>
 #include <BRepLProp_CLProps.hxx>
 #include <BRepLib.hxx>
-#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
@@ -63,6 +62,7 @@
 
 #include <Base/Console.h>
 #include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/TessellationCache.h>
 
 #include "Cosmetic.h"
 #include "DrawUtil.h"
@@ -308,7 +308,7 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
     try {
         // HLRBRep_PolyAlgo will fail if the whole input shape has not been meshed.
         // meshing the faces is not sufficient.
-        BRepMesh_IncrementalMesh(inCopy, 0.10);
+        Part::TessellationCache::instance().mesh(inCopy, 0.10, 0.5);
 
         brep_hlrPoly = new HLRBRep_PolyAlgo();
         brep_hlrPoly->Load(inCopy);
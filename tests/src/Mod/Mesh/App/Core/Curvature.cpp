@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/Curvature.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include "MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class CurvatureTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        kernel = MeshTestHelpers::makeSphere(Base::Vector3f(0, 0, 0), 2.0F);
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(CurvatureTest, TestNeighboursOfFacet)
+{
+    MeshCore::MeshRefPointToFacets reference(kernel);
+    MeshCore::MeshPointNeighbourhood search(kernel);
+
+    std::vector<MeshCore::FacetIndex> facets;
+    for (float dist : {0.2F, 0.8F}) {
+        for (MeshCore::FacetIndex index = 0; index < kernel.CountFacets(); index++) {
+            std::vector<MeshCore::FacetIndex> expected;
+            MeshCore::FacetCollector collect(expected);
+            reference.Neighbours(index, dist, collect);
+            std::sort(expected.begin(), expected.end());
+
+            search.Neighbours(index, dist, facets);
+            EXPECT_EQ(facets, expected);
+        }
+    }
+}
+
+TEST_F(CurvatureTest, TestParallelGivesSameResult)
+{
+    MeshCore::MeshCurvature serial(kernel);
+    serial.ComputePerFace(false);
+    MeshCore::MeshCurvature parallel(kernel);
+    parallel.ComputePerFace(true);
+
+    const std::vector<MeshCore::CurvatureInfo>& info1 = serial.GetCurvature();
+    const std::vector<MeshCore::CurvatureInfo>& info2 = parallel.GetCurvature();
+    ASSERT_EQ(info1.size(), info2.size());
+    for (std::size_t i = 0; i < info1.size(); i++) {
+        EXPECT_FLOAT_EQ(info1[i].fMaxCurvature, info2[i].fMaxCurvature);
+        EXPECT_FLOAT_EQ(info1[i].fMinCurvature, info2[i].fMinCurvature);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include "MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class DecimationTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a wavy surface with some curvature so that the error metric matters
+        const int size = 40;
+        MeshCore::MeshPointArray points;
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                float x = float(i) / float(size);
+                float y = float(j) / float(size);
+                float z = 0.1F * std::sin(6.0F * x) * std::cos(4.0F * y);
+                points.emplace_back(x, y, z);
+            }
+        }
+
+        MeshCore::MeshFacetArray facets = MeshTestHelpers::triangulateGrid(size);
+
+        kernel.Adopt(points, facets, true);
+    }
+
+    const MeshCore::MeshKernel& GetKernel() const
+    {
+        return kernel;
+    }
+
+    // the largest distance of the original points to the decimated mesh
+    float MaxDeviation(const MeshCore::MeshKernel& decimated) const
+    {
+        MeshCore::MeshAlgorithm alg(decimated);
+        float maxDist = 0.0F;
+        for (std::size_t i = 0; i < kernel.CountPoints(); i++) {
+            Base::Vector3f pnt = kernel.GetPoint(i);
+            MeshCore::FacetIndex index {};
+            Base::Vector3f proj;
+            if (alg.NearestPointFromPoint(pnt, index, proj)) {
+                maxDist = std::max(maxDist, Base::Distance(pnt, proj));
+            }
+        }
+        return maxDist;
+    }
+
+private:
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(DecimationTest, TestTargetSize)
+{
+    MeshCore::MeshKernel kernel = GetKernel();
+    MeshCore::MeshSimplify simplify(kernel);
+    simplify.simplify(1000);
+    EXPECT_LE(kernel.CountFacets(), 1000);
+    EXPECT_GT(kernel.CountFacets(), 0);
+}
+
+TEST_F(DecimationTest, TestMatchesBaseline)
+{
+    // the values were recorded with the serial implementation before the setup ran in parallel
+    MeshCore::MeshKernel kernel = GetKernel();
+    MeshCore::MeshSimplify simplify(kernel);
+    simplify.setThreads(4);
+    simplify.simplify(0.0F, 0.75F);
+
+    ASSERT_EQ(kernel.CountPoints(), 435);
+    ASSERT_EQ(kernel.CountFacets(), 800);
+    double checksum = 0.0;
+    for (std::size_t i = 0; i < kernel.CountPoints(); i++) {
+        Base::Vector3f pnt = kernel.GetPoint(i);
+        checksum += pnt.x + 2 * pnt.y + 3 * pnt.z;
+    }
+    EXPECT_NEAR(checksum, 700.745942, 1e-4);
+    EXPECT_EQ(kernel.GetPoint(1), Base::Vector3f(0.0F, 0.15625F, 0.0F));
+}
+
+TEST_F(DecimationTest, TestParallelMatchesSerial)
+{
+    MeshCore::MeshKernel serial = GetKernel();
+    MeshCore::MeshSimplify simplify1(serial);
+    simplify1.setThreads(1);
+    simplify1.simplify(0.0F, 0.75F);
+
+    MeshCore::MeshKernel parallel = GetKernel();
+    MeshCore::MeshSimplify simplify2(parallel);
+    simplify2.setThreads(4);
+    simplify2.simplify(0.0F, 0.75F);
+
+    ASSERT_EQ(serial.CountPoints(), parallel.CountPoints());
+    ASSERT_EQ(serial.CountFacets(), parallel.CountFacets());
+    for (std::size_t i = 0; i < serial.CountPoints(); i++) {
+        EXPECT_EQ(serial.GetPoint(i), parallel.GetPoint(i));
+    }
+    for (std::size_t i = 0; i < serial.CountFacets(); i++) {
+        const MeshCore::MeshFacet& f1 = serial.GetFacets()[i];
+        const MeshCore::MeshFacet& f2 = parallel.GetFacets()[i];
+        EXPECT_EQ(f1._aulPoints[0], f2._aulPoints[0]);
+        EXPECT_EQ(f1._aulPoints[1], f2._aulPoints[1]);
+        EXPECT_EQ(f1._aulPoints[2], f2._aulPoints[2]);
+    }
+}
+
+TEST_F(DecimationTest, TestConcurrentDoesNotDependOnThreads)
+{
+    MeshCore::MeshKernel kernel1 = GetKernel();
+    MeshCore::MeshSimplify simplify1(kernel1);
+    simplify1.setThreads(1);
+    simplify1.setConcurrent(true);
+    simplify1.simplify(0.0F, 0.75F);
+
+    MeshCore::MeshKernel kernel2 = GetKernel();
+    MeshCore::MeshSimplify simplify2(kernel2);
+    simplify2.setThreads(4);
+    simplify2.setConcurrent(true);
+    simplify2.simplify(0.0F, 0.75F);
+
+    ASSERT_EQ(kernel1.CountPoints(), kernel2.CountPoints());
+    ASSERT_EQ(kernel1.CountFacets(), kernel2.CountFacets());
+    for (std::size_t i = 0; i < kernel1.CountPoints(); i++) {
+        EXPECT_EQ(kernel1.GetPoint(i), kernel2.GetPoint(i));
+    }
+    for (std::size_t i = 0; i < kernel1.CountFacets(); i++) {
+        const MeshCore::MeshFacet& f1 = kernel1.GetFacets()[i];
+        const MeshCore::MeshFacet& f2 = kernel2.GetFacets()[i];
+        EXPECT_EQ(f1._aulPoints[0], f2._aulPoints[0]);
+        EXPECT_EQ(f1._aulPoints[1], f2._aulPoints[1]);
+        EXPECT_EQ(f1._aulPoints[2], f2._aulPoints[2]);
+    }
+}
+
+TEST_F(DecimationTest, TestConcurrentQualityParity)
+{
+    MeshCore::MeshKernel serial = GetKernel();
+    MeshCore::MeshSimplify simplify1(serial);
+    simplify1.simplify(0.0F, 0.75F);
+
+    MeshCore::MeshKernel concurrent = GetKernel();
+    MeshCore::MeshSimplify simplify2(concurrent);
+    simplify2.setThreads(4);
+    simplify2.setConcurrent(true);
+    simplify2.simplify(0.0F, 0.75F);
+
+    // both reach the target and approximate the surface equally well
+    EXPECT_LE(concurrent.CountFacets(), 800);
+    EXPECT_GE(concurrent.CountFacets(), 790);
+    EXPECT_TRUE(MeshCore::MeshEvalTopology(concurrent).Evaluate());
+    EXPECT_NEAR(concurrent.GetSurface(), serial.GetSurface(), 0.01 * serial.GetSurface());
+    EXPECT_LE(MaxDeviation(concurrent), 1.5F * MaxDeviation(serial) + 1e-4F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
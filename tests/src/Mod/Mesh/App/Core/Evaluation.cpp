@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <set>
+#include <Mod/Mesh/App/Core/Degeneration.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include "MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SelfIntersectionTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a flat grid that is large enough to be checked in several batches
+        const int size = 40;
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                points.emplace_back(float(i), float(j), 0.0F);
+            }
+        }
+        facets = MeshTestHelpers::triangulateGrid(size);
+    }
+
+    MeshCore::MeshKernel MakeKernel(bool piercing) const
+    {
+        MeshCore::MeshPointArray pts = points;
+        MeshCore::MeshFacetArray fts = facets;
+        if (piercing) {
+            // vertical triangles that cut through the grid
+            for (int k = 0; k < 3; k++) {
+                auto start = MeshCore::PointIndex(pts.size());
+                float y = 10.5F + 7.0F * float(k);
+                pts.emplace_back(10.3F, y, -1.0F);
+                pts.emplace_back(14.7F, y, -1.0F);
+                pts.emplace_back(12.5F, y, 1.0F);
+                fts.emplace_back(start, start + 1, start + 2);
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel.Adopt(pts, fts, true);
+        return kernel;
+    }
+
+    // Checks all pairs of facets one after the other
+    static std::set<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> BruteForce(
+        const MeshCore::MeshKernel& kernel
+    )
+    {
+        std::set<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+        const MeshCore::MeshFacetArray& rFaces = kernel.GetFacets();
+        Base::Vector3f pt1, pt2;
+        for (MeshCore::FacetIndex i = 0; i < rFaces.size(); i++) {
+            MeshCore::MeshGeomFacet facet1 = kernel.GetFacet(i);
+            for (MeshCore::FacetIndex j = i + 1; j < rFaces.size(); j++) {
+                bool shared = false;
+                for (auto p1 : rFaces[i]._aulPoints) {
+                    for (auto p2 : rFaces[j]._aulPoints) {
+                        shared = shared || p1 == p2;
+                    }
+                }
+                if (shared) {
+                    continue;
+                }
+                MeshCore::MeshGeomFacet facet2 = kernel.GetFacet(j);
+                if (!(facet1.GetBoundBox() && facet2.GetBoundBox())) {
+                    continue;
+                }
+                if (facet1.IntersectWithFacet(facet2, pt1, pt2) == 2) {
+                    pairs.emplace(i, j);
+                }
+            }
+        }
+        return pairs;
+    }
+
+private:
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+};
+
+TEST_F(SelfIntersectionTest, TestNoIntersection)
+{
+    MeshCore::MeshKernel kernel = MakeKernel(false);
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_TRUE(eval.Evaluate());
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+    eval.GetIntersections(pairs);
+    EXPECT_TRUE(pairs.empty());
+}
+
+TEST_F(SelfIntersectionTest, TestMatchesBruteForce)
+{
+    MeshCore::MeshKernel kernel = MakeKernel(true);
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+    eval.GetIntersections(pairs);
+
+    std::set<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> found;
+    for (const auto& it : pairs) {
+        found.emplace(std::min(it.first, it.second), std::max(it.first, it.second));
+    }
+    auto expected = BruteForce(kernel);
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(found, expected);
+}
+
+class DuplicatePointsTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a flat grid whose right half uses copies of the points of the middle column
+        const int size = 40;
+        const int half = size / 2;
+        MeshCore::MeshPointArray points;
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                points.emplace_back(float(i), float(j), 0.0F);
+            }
+        }
+        for (int i = 0; i <= size; i++) {
+            duplicates.push_back(MeshCore::PointIndex(points.size()));
+            points.emplace_back(float(i), float(half), 0.0F);
+        }
+
+        MeshCore::MeshFacetArray facets = MeshTestHelpers::triangulateGrid(size);
+        for (std::size_t index = 0; index < facets.size(); index++) {
+            if (int(index / 2) % size < half) {
+                continue;
+            }
+            for (MeshCore::PointIndex& pos : facets[index]._aulPoints) {
+                if (int(pos) % (size + 1) == half) {
+                    pos = duplicates[pos / (size + 1)];
+                }
+            }
+        }
+
+        numPoints = (size + 1) * (size + 1);
+        kernel.Adopt(points, facets, true);
+    }
+
+    MeshCore::MeshKernel kernel;
+    std::vector<MeshCore::PointIndex> duplicates;
+    std::size_t numPoints = 0;
+};
+
+TEST_F(DuplicatePointsTest, TestEvaluate)
+{
+    MeshCore::MeshEvalDuplicatePoints eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+
+    // the point with the higher index of each pair is reported
+    std::vector<MeshCore::PointIndex> indices = eval.GetIndices();
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(indices, duplicates);
+}
+
+TEST_F(DuplicatePointsTest, TestFixup)
+{
+    MeshCore::MeshFixDuplicatePoints fix(kernel);
+    EXPECT_TRUE(fix.Fixup());
+    EXPECT_EQ(kernel.CountPoints(), numPoints);
+
+    MeshCore::MeshEvalDuplicatePoints eval(kernel);
+    EXPECT_TRUE(eval.Evaluate());
+    EXPECT_TRUE(MeshCore::MeshEvalTopology(kernel).Evaluate());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <Mod/Mesh/App/Core/FacetTree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class FacetTreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a wavy height field that is large enough to be built and queried in parallel
+        auto height = [](int i, int j) {
+            return 0.5F * std::sin(0.3F * float(i)) * std::cos(0.2F * float(j));
+        };
+        const int num = 80;
+        for (int i = 0; i < num; i++) {
+            for (int j = 0; j < num; j++) {
+                Base::Vector3f p00(float(i), float(j), height(i, j));
+                Base::Vector3f p10(float(i + 1), float(j), height(i + 1, j));
+                Base::Vector3f p01(float(i), float(j + 1), height(i, j + 1));
+                Base::Vector3f p11(float(i + 1), float(j + 1), height(i + 1, j + 1));
+                facets.emplace_back(p00, p10, p11);
+                facets.emplace_back(p00, p11, p01);
+            }
+        }
+    }
+
+    void TearDown() override
+    {}
+
+    const std::vector<MeshCore::MeshGeomFacet>& GetFacets() const
+    {
+        return facets;
+    }
+
+private:
+    std::vector<MeshCore::MeshGeomFacet> facets;
+};
+
+TEST_F(FacetTreeTest, TestEmpty)
+{
+    MeshCore::MeshFacetTree tree;
+    EXPECT_TRUE(tree.IsEmpty());
+
+    Base::Vector3f nearest;
+    float dist {};
+    EXPECT_EQ(
+        tree.FindNearest(Base::Vector3f(), std::numeric_limits<float>::max(), nearest, dist),
+        MeshCore::FACET_INDEX_MAX
+    );
+}
+
+TEST_F(FacetTreeTest, TestNearest)
+{
+    MeshCore::MeshFacetTree tree(GetFacets());
+    EXPECT_EQ(tree.Size(), GetFacets().size());
+
+    Base::Vector3f nearest;
+    float dist {};
+    Base::Vector3f pnt(0.8F, 0.2F, 0.3F);
+    MeshCore::FacetIndex index = tree.FindNearest(pnt, 1.F, nearest, dist);
+    EXPECT_EQ(index, 0);
+    EXPECT_EQ(tree.GetFacet(index)._aclPoints[2], GetFacets()[0]._aclPoints[2]);
+    EXPECT_NEAR(dist, Base::Distance(nearest, pnt), 1e-5F);
+    EXPECT_EQ(tree.FindNearest(pnt, 0.05F, nearest, dist), MeshCore::FACET_INDEX_MAX);
+}
+
+TEST_F(FacetTreeTest, TestBatched)
+{
+    const auto& facets = GetFacets();
+    MeshCore::MeshFacetTree tree(facets);
+
+    std::vector<Base::Vector3f> queries;
+    for (int i = 0; i < 200; i++) {
+        float x = float((i * 37) % 90) - 5.F;
+        float y = float((i * 53) % 90) - 5.F;
+        float z = float((i * 17) % 7) - 3.F;
+        queries.emplace_back(x + 0.3F, y + 0.6F, z);
+    }
+
+    std::vector<MeshCore::FacetIndex> indices;
+    std::vector<float> dists;
+    tree.FindNearest(queries, 4.F, indices, dists);
+    ASSERT_EQ(indices.size(), queries.size());
+
+    // brute force comparison
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        float minDist = std::numeric_limits<float>::max();
+        for (const auto& it : facets) {
+            minDist = std::min(minDist, it.DistanceToPoint(queries[i]));
+        }
+        if (minDist > 4.F) {
+            EXPECT_EQ(indices[i], MeshCore::FACET_INDEX_MAX);
+        }
+        else {
+            ASSERT_NE(indices[i], MeshCore::FACET_INDEX_MAX);
+            EXPECT_FLOAT_EQ(dists[i], minDist);
+            EXPECT_FLOAT_EQ(facets[indices[i]].DistanceToPoint(queries[i]), minDist);
+        }
+    }
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -92,4 +92,94 @@ TEST_F(KDTreeTest, TestKDTreeFindRange)
     tree.FindInRange(Base::Vector3f(0.5F, 0, 0), 0.6F, index);
     EXPECT_EQ(index, result);
 }
+
+TEST_F(KDTreeTest, TestStaticKDTreeEmpty)
+{
+    MeshCore::MeshStaticKDTree tree;
+    EXPECT_EQ(tree.IsEmpty(), true);
+
+    Base::Vector3f pnt;
+    Base::Vector3f nor;
+    float dist;
+    EXPECT_EQ(tree.FindNearest(pnt, nor, dist), MeshCore::POINT_INDEX_MAX);
+}
+
+TEST_F(KDTreeTest, TestStaticKDTreeNearest)
+{
+    MeshCore::MeshStaticKDTree tree(GetPoints());
+    EXPECT_EQ(tree.Size(), 8);
+
+    Base::Vector3f nor;
+    float dist;
+    EXPECT_EQ(tree.FindNearest(Base::Vector3f(0.9F, 0.1F, 0.1F), nor, dist), 4);
+    EXPECT_EQ(nor, Base::Vector3f(1.F, 0.F, 0.F));
+    EXPECT_EQ(
+        tree.FindNearest(Base::Vector3f(0.9F, 0.1F, 0.1F), 0.0F, nor, dist),
+        MeshCore::POINT_INDEX_MAX
+    );
+    EXPECT_EQ(tree.FindExact(Base::Vector3f(0.1F, 0, 0)), MeshCore::POINT_INDEX_MAX);
+    EXPECT_EQ(tree.FindExact(Base::Vector3f(1, 1, 1)), 7);
+}
+
+TEST_F(KDTreeTest, TestStaticKDTreeFindRange)
+{
+    MeshCore::MeshStaticKDTree tree(GetPoints());
+
+    std::vector<MeshCore::PointIndex> index;
+    std::vector<MeshCore::PointIndex> result = {0, 4};
+    tree.FindInRange(Base::Vector3f(0.5F, 0, 0), 0.6F, index);
+    EXPECT_EQ(index, result);
+}
+
+TEST_F(KDTreeTest, TestStaticKDTreeBatched)
+{
+    // a grid that is large enough to be built and queried in parallel
+    std::vector<Base::Vector3f> grid;
+    for (int i = 0; i < 40; i++) {
+        for (int j = 0; j < 40; j++) {
+            for (int k = 0; k < 10; k++) {
+                grid.emplace_back(float(i), float(j), float(k) * 0.5F);
+            }
+        }
+    }
+
+    MeshCore::MeshStaticKDTree tree(grid);
+    std::vector<Base::Vector3f> queries;
+    queries.emplace_back(0.1F, 0.1F, 0.1F);
+    queries.emplace_back(20.2F, 10.6F, 2.1F);
+    queries.emplace_back(-5.F, 0.F, 0.F);
+
+    std::vector<MeshCore::PointIndex> indices;
+    std::vector<float> dists;
+    tree.FindNearest(queries, 2, 2.0F, indices, dists);
+    ASSERT_EQ(indices.size(), 6);
+    EXPECT_EQ(indices[0], 0);
+    EXPECT_EQ(indices[1], 1);
+    EXPECT_EQ(indices[2], (20 * 40 + 11) * 10 + 4);
+    EXPECT_LE(dists[2], dists[3]);
+    EXPECT_EQ(indices[4], MeshCore::POINT_INDEX_MAX);
+    EXPECT_EQ(indices[5], MeshCore::POINT_INDEX_MAX);
+
+    std::vector<std::size_t> offsets;
+    tree.FindInRange(queries, 0.6F, offsets, indices);
+    ASSERT_EQ(offsets.size(), 4);
+    EXPECT_EQ(offsets[1] - offsets[0], 2);
+    EXPECT_EQ(offsets[3], offsets[2]);
+    EXPECT_EQ(indices.size(), offsets[3]);
+
+    // brute force comparison
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        std::vector<MeshCore::PointIndex> expected;
+        for (std::size_t j = 0; j < grid.size(); j++) {
+            if (Base::Distance(grid[j], queries[i]) <= 0.6F) {
+                expected.push_back(j);
+            }
+        }
+        std::vector<MeshCore::PointIndex> found(
+            indices.begin() + std::ptrdiff_t(offsets[i]),
+            indices.begin() + std::ptrdiff_t(offsets[i + 1])
+        );
+        EXPECT_EQ(found, expected);
+    }
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
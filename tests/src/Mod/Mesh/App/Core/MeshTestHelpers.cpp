@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cmath>
+#include <numbers>
+#include "MeshTestHelpers.h"
+
+namespace
+{
+MeshCore::PointIndex gridIndex(int size, int i, int j)
+{
+    return MeshCore::PointIndex(i * (size + 1) + j);
+}
+}  // namespace
+
+namespace MeshTestHelpers
+{
+
+MeshCore::MeshFacetArray triangulateGrid(int size)
+{
+    MeshCore::MeshFacetArray facets;
+    facets.reserve(2 * std::size_t(size) * std::size_t(size));
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            facets.emplace_back(
+                gridIndex(size, i, j),
+                gridIndex(size, i + 1, j),
+                gridIndex(size, i + 1, j + 1)
+            );
+            facets.emplace_back(
+                gridIndex(size, i, j),
+                gridIndex(size, i + 1, j + 1),
+                gridIndex(size, i, j + 1)
+            );
+        }
+    }
+
+    return facets;
+}
+
+MeshCore::MeshKernel makeSphere(const Base::Vector3f& center, float radius, int rings, int sectors)
+{
+    MeshCore::MeshPointArray points;
+    points.emplace_back(center + Base::Vector3f(0, 0, radius));
+    for (int i = 1; i < rings; i++) {
+        float theta = std::numbers::pi_v<float> * float(i) / float(rings);
+        for (int j = 0; j < sectors; j++) {
+            float phi = 2.0F * std::numbers::pi_v<float> * float(j) / float(sectors);
+            Base::Vector3f dir(
+                std::sin(theta) * std::cos(phi),
+                std::sin(theta) * std::sin(phi),
+                std::cos(theta)
+            );
+            points.emplace_back(center + radius * dir);
+        }
+    }
+    points.emplace_back(center - Base::Vector3f(0, 0, radius));
+
+    auto index = [sectors](int ring, int sector) {
+        return MeshCore::PointIndex(1 + (ring - 1) * sectors + sector % sectors);
+    };
+    auto bottom = MeshCore::PointIndex(points.size() - 1);
+    MeshCore::MeshFacetArray facets;
+    for (int j = 0; j < sectors; j++) {
+        facets.emplace_back(0, index(1, j), index(1, j + 1));
+        facets.emplace_back(bottom, index(rings - 1, j + 1), index(rings - 1, j));
+    }
+    for (int i = 1; i < rings - 1; i++) {
+        for (int j = 0; j < sectors; j++) {
+            facets.emplace_back(index(i, j), index(i + 1, j), index(i + 1, j + 1));
+            facets.emplace_back(index(i, j), index(i + 1, j + 1), index(i, j + 1));
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    return kernel;
+}
+
+}  // namespace MeshTestHelpers
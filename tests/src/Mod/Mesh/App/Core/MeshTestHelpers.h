@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <Base/Vector3D.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+namespace MeshTestHelpers
+{
+
+/**
+ * Triangulates a grid with \a size cells in each direction whose points are stored row by row.
+ * Each cell is split into two facets, the facets of the cell in row i and column j are at the
+ * positions 2 * (i * size + j) and 2 * (i * size + j) + 1.
+ */
+MeshCore::MeshFacetArray triangulateGrid(int size);
+
+/// Creates a closed, outward oriented sphere whose poles lie on the z-axis
+MeshCore::MeshKernel makeSphere(
+    const Base::Vector3f& center,
+    float radius,
+    int rings = 24,
+    int sectors = 48
+);
+
+}  // namespace MeshTestHelpers
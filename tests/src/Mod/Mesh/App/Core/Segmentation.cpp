@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Approximation.h>
+#include <Mod/Mesh/App/Core/Curvature.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Segmentation.h>
+#include "MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+// Forces the sequential code path of MeshSegmentAlgorithm
+class SerialPlanarSegment: public MeshCore::MeshCurvaturePlanarSegment
+{
+public:
+    using MeshCore::MeshCurvaturePlanarSegment::MeshCurvaturePlanarSegment;
+    bool IsStateless() const override
+    {
+        return false;
+    }
+};
+}  // namespace
+
+class SegmentationTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a flat grid where some points are marked as curved
+        const int size = 10;
+        MeshCore::MeshPointArray points;
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                bool curved = (i == 4) || (j == 6 && i > 6);
+                points.emplace_back(float(i), float(j), 0.0F);
+                MeshCore::CurvatureInfo ci {};
+                ci.fMaxCurvature = curved ? 1.0F : 0.0F;
+                ci.fMinCurvature = 0.0F;
+                info.push_back(ci);
+            }
+        }
+
+        MeshCore::MeshFacetArray facets = MeshTestHelpers::triangulateGrid(size);
+
+        kernel.Adopt(points, facets, true);
+    }
+
+    std::vector<MeshCore::MeshSegment> FindSegments(
+        const MeshCore::MeshSurfaceSegmentPtr& segm,
+        int threads
+    )
+    {
+        std::vector<MeshCore::MeshSurfaceSegmentPtr> segms {segm};
+        MeshCore::MeshSegmentAlgorithm finder(kernel);
+        finder.SetThreads(threads);
+        finder.FindSegments(segms);
+        return segm->GetSegments();
+    }
+
+    MeshCore::MeshKernel kernel;
+    std::vector<MeshCore::CurvatureInfo> info;
+};
+
+TEST_F(SegmentationTest, TestStatelessSegmentsMatchSequentialOrder)
+{
+    auto serial = std::make_shared<SerialPlanarSegment>(info, 2, 0.1F);
+    std::vector<MeshCore::MeshSegment> expected = FindSegments(serial, 1);
+    ASSERT_GT(expected.size(), 1);
+
+    for (int threads : {1, 4}) {
+        auto planar = std::make_shared<MeshCore::MeshCurvaturePlanarSegment>(info, 2, 0.1F);
+        ASSERT_TRUE(planar->IsStateless());
+        EXPECT_EQ(FindSegments(planar, threads), expected);
+    }
+}
+
+TEST(PlaneFitTest, TestFitByMoments)
+{
+    // points on the plane z = 1 + 0.5 * x - 0.25 * y
+    std::vector<Base::Vector3f> points;
+    MeshCore::PointMoments moments;
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 3; j++) {
+            float x = float(i);
+            float y = float(j * j);
+            points.emplace_back(x, y, 1.0F + 0.5F * x - 0.25F * y);
+            moments.Add(points.back());
+        }
+    }
+
+    MeshCore::PlaneFit byPoints;
+    byPoints.AddPoints(points);
+    MeshCore::PlaneFit byMoments;
+    float dev1 = byPoints.Fit();
+    float dev2 = byMoments.Fit(moments);
+    ASSERT_NE(dev2, std::numeric_limits<float>::max());
+    EXPECT_NEAR(dev1, dev2, 1e-5F);
+    EXPECT_NEAR(dev2, 0.0F, 1e-5F);
+
+    Base::Vector3f normal(-0.5F, 0.25F, 1.0F);
+    normal.Normalize();
+    EXPECT_NEAR(std::fabs(byMoments.GetNormal() * normal), 1.0F, 1e-5F);
+    Base::Vector3f base = byMoments.GetBase();
+    EXPECT_NEAR(base.z, 1.0F + 0.5F * base.x - 0.25F * base.y, 1e-5F);
+    EXPECT_NEAR(base.x, byPoints.GetBase().x, 1e-5F);
+    EXPECT_NEAR(base.y, byPoints.GetBase().y, 1e-5F);
+    EXPECT_NEAR(base.z, byPoints.GetBase().z, 1e-5F);
+
+    moments.Clear();
+    EXPECT_EQ(moments.count, 0);
+    EXPECT_EQ(byMoments.Fit(moments), std::numeric_limits<float>::max());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
+#include <Mod/Mesh/App/Core/ExactSetOperations.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/SetOperations.h>
+#include "MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SetOperationsTest: public ::testing::Test
+{
+protected:
+    static MeshCore::MeshKernel Run(
+        MeshCore::SetOperations::OperationType type,
+        bool exact = false
+    )
+    {
+        Base::Vector3f center1(0.0F, 0.0F, 0.0F);
+        Base::Vector3f center2(0.6F, 0.3F, 0.2F);
+        MeshCore::MeshKernel sphere1 = MeshTestHelpers::makeSphere(center1, 1.0F);
+        MeshCore::MeshKernel sphere2 = MeshTestHelpers::makeSphere(center2, 1.0F);
+        MeshCore::MeshKernel result;
+        if (exact) {
+            MeshCore::ExactSetOperations setOp(sphere1, sphere2, result, type);
+            setOp.Do();
+        }
+        else {
+            MeshCore::SetOperations setOp(sphere1, sphere2, result, type, 1e-5F);
+            setOp.Do();
+        }
+        return result;
+    }
+
+    // volume of the intersection of two unit spheres with a distance of d
+    static float LensVolume()
+    {
+        float d = std::sqrt(0.6F * 0.6F + 0.3F * 0.3F + 0.2F * 0.2F);
+        return std::numbers::pi_v<float> * (4.0F + d) * (2.0F - d) * (2.0F - d) / 12.0F;
+    }
+};
+
+TEST_F(SetOperationsTest, TestIntersect)
+{
+    MeshCore::MeshKernel result = Run(MeshCore::SetOperations::Intersect);
+    ASSERT_GT(result.CountFacets(), 0);
+    EXPECT_NEAR(result.GetVolume(), LensVolume(), 0.05F * LensVolume());
+}
+
+TEST_F(SetOperationsTest, TestUnion)
+{
+    MeshCore::MeshKernel result = Run(MeshCore::SetOperations::Union);
+    ASSERT_GT(result.CountFacets(), 0);
+    float volume = 8.0F / 3.0F * std::numbers::pi_v<float> - LensVolume();
+    EXPECT_NEAR(result.GetVolume(), volume, 0.05F * volume);
+}
+
+TEST_F(SetOperationsTest, TestDeterministic)
+{
+    // the parallel intersection and re-triangulation must not depend on the scheduling
+    MeshCore::MeshKernel result1 = Run(MeshCore::SetOperations::Difference);
+    MeshCore::MeshKernel result2 = Run(MeshCore::SetOperations::Difference);
+    ASSERT_GT(result1.CountFacets(), 0);
+    ASSERT_EQ(result1.CountPoints(), result2.CountPoints());
+    ASSERT_EQ(result1.CountFacets(), result2.CountFacets());
+    for (MeshCore::PointIndex i = 0; i < result1.CountPoints(); i++) {
+        EXPECT_EQ(result1.GetPoint(i), result2.GetPoint(i));
+    }
+}
+
+TEST_F(SetOperationsTest, TestExactIntersect)
+{
+    MeshCore::MeshKernel result = Run(MeshCore::SetOperations::Intersect, true);
+    ASSERT_GT(result.CountFacets(), 0);
+    EXPECT_NEAR(result.GetVolume(), LensVolume(), 0.05F * LensVolume());
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_FALSE(result.HasNonManifolds());
+}
+
+TEST_F(SetOperationsTest, TestExactUnion)
+{
+    MeshCore::MeshKernel result = Run(MeshCore::SetOperations::Union, true);
+    ASSERT_GT(result.CountFacets(), 0);
+    float volume = 8.0F / 3.0F * std::numbers::pi_v<float> - LensVolume();
+    EXPECT_NEAR(result.GetVolume(), volume, 0.05F * volume);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_FALSE(result.HasNonManifolds());
+}
+
+TEST_F(SetOperationsTest, TestExactDifference)
+{
+    MeshCore::MeshKernel result = Run(MeshCore::SetOperations::Difference, true);
+    ASSERT_GT(result.CountFacets(), 0);
+    float volume = 4.0F / 3.0F * std::numbers::pi_v<float> - LensVolume();
+    EXPECT_NEAR(result.GetVolume(), volume, 0.05F * volume);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_FALSE(result.HasNonManifolds());
+}
+
+TEST_F(SetOperationsTest, TestExactCoplanar)
+{
+    // the cubes share parts of four faces, so most facet pairs are coplanar
+    auto cube = [](float x) {
+        MeshCore::MeshPointArray points;
+        for (int i = 0; i < 8; i++) {
+            points.emplace_back(x + float(i & 1), float((i >> 1) & 1), float(i >> 2));
+        }
+        const int indices[12][3] = {
+            {0, 2, 1},
+            {1, 2, 3},
+            {4, 5, 6},
+            {5, 7, 6},
+            {0, 1, 4},
+            {1, 5, 4},
+            {2, 6, 3},
+            {3, 6, 7},
+            {0, 4, 2},
+            {2, 4, 6},
+            {1, 3, 5},
+            {3, 7, 5}
+        };
+        MeshCore::MeshFacetArray facets;
+        for (const auto& it : indices) {
+            facets.emplace_back(it[0], it[1], it[2]);
+        }
+        MeshCore::MeshKernel kernel;
+        kernel.Adopt(points, facets, true);
+        return kernel;
+    };
+
+    MeshCore::MeshKernel cube1 = cube(0.0F);
+    MeshCore::MeshKernel cube2 = cube(0.5F);
+    MeshCore::MeshKernel result1;
+    MeshCore::ExactSetOperations setOp1(cube1, cube2, result1, MeshCore::SetOperations::Union);
+    setOp1.Do();
+    EXPECT_NEAR(result1.GetVolume(), 1.5F, 1e-5F);
+    EXPECT_FALSE(result1.HasOpenEdges());
+
+    MeshCore::MeshKernel result2;
+    MeshCore::ExactSetOperations setOp2(cube1, cube2, result2, MeshCore::SetOperations::Intersect);
+    setOp2.Do();
+    EXPECT_NEAR(result2.GetVolume(), 0.5F, 1e-5F);
+    EXPECT_FALSE(result2.HasOpenEdges());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Smoothing.h>
+#include "MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SmoothingTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a flat grid with some bumps in the inner part
+        const int size = 8;
+        MeshCore::MeshPointArray points;
+        for (int i = 0; i <= size; i++) {
+            for (int j = 0; j <= size; j++) {
+                float z = ((i * 7 + j * 3) % 5 == 0) ? 1.0F : 0.0F;
+                points.emplace_back(float(i), float(j), z);
+            }
+        }
+
+        MeshCore::MeshFacetArray facets = MeshTestHelpers::triangulateGrid(size);
+
+        kernel.Adopt(points, facets, true);
+    }
+
+    // One step of the umbrella operator where all points use the old positions
+    static MeshCore::MeshPointArray Umbrella(const MeshCore::MeshKernel& kernel, double lambda)
+    {
+        const MeshCore::MeshPointArray& points = kernel.GetPoints();
+        MeshCore::MeshRefPointToPoints vv_it(kernel);
+        MeshCore::MeshRefPointToFacets vf_it(kernel);
+        MeshCore::MeshPointArray moved = points;
+        for (MeshCore::PointIndex pos = 0; pos < points.size(); pos++) {
+            const std::set<MeshCore::PointIndex>& cv = vv_it[pos];
+            if (cv.size() < 3 || cv.size() != vf_it[pos].size()) {
+                continue;
+            }
+
+            double w = lambda / double(cv.size());
+            double delx = 0.0, dely = 0.0, delz = 0.0;
+            for (MeshCore::PointIndex it : cv) {
+                delx += double(points[it].x - points[pos].x);
+                dely += double(points[it].y - points[pos].y);
+                delz += double(points[it].z - points[pos].z);
+            }
+            moved[pos].Set(
+                float(double(points[pos].x) + w * delx),
+                float(double(points[pos].y) + w * dely),
+                float(double(points[pos].z) + w * delz)
+            );
+        }
+        return moved;
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(SmoothingTest, TestLaplaceMovesAllPointsAtOnce)
+{
+    MeshCore::MeshKernel expected = kernel;
+    for (int i = 0; i < 3; i++) {
+        MeshCore::MeshPointArray points = Umbrella(expected, 0.5);
+        for (MeshCore::PointIndex pos = 0; pos < points.size(); pos++) {
+            expected.SetPoint(pos, points[pos]);
+        }
+    }
+
+    MeshCore::LaplaceSmoothing smooth(kernel);
+    smooth.SetLambda(0.5);
+    smooth.Smooth(3);
+
+    ASSERT_EQ(kernel.CountPoints(), expected.CountPoints());
+    for (MeshCore::PointIndex pos = 0; pos < kernel.CountPoints(); pos++) {
+        Base::Vector3f pnt = kernel.GetPoint(pos);
+        Base::Vector3f ref = expected.GetPoint(pos);
+        EXPECT_NEAR(pnt.x, ref.x, 1e-5F);
+        EXPECT_NEAR(pnt.y, ref.y, 1e-5F);
+        EXPECT_NEAR(pnt.z, ref.z, 1e-5F);
+    }
+}
+
+TEST_F(SmoothingTest, TestLaplaceOfFan)
+{
+    // a closed fan around a raised center point. The border points keep their positions and
+    // the center moves by lambda towards the mean of its neighbours in every step.
+    MeshCore::MeshPointArray points;
+    points.emplace_back(0.0F, 0.0F, 1.0F);
+    points.emplace_back(2.0F, 0.0F, 0.0F);
+    points.emplace_back(0.0F, 1.0F, 0.0F);
+    points.emplace_back(-2.0F, 0.0F, 0.0F);
+    points.emplace_back(0.0F, -1.0F, 0.0F);
+
+    MeshCore::MeshFacetArray facets;
+    facets.emplace_back(0, 1, 2);
+    facets.emplace_back(0, 2, 3);
+    facets.emplace_back(0, 3, 4);
+    facets.emplace_back(0, 4, 1);
+
+    MeshCore::MeshKernel fan;
+    fan.Adopt(points, facets, true);
+
+    MeshCore::LaplaceSmoothing smooth(fan);
+    smooth.SetLambda(0.5);
+    smooth.Smooth(3);
+
+    Base::Vector3f center = fan.GetPoint(0);
+    EXPECT_FLOAT_EQ(center.x, 0.0F);
+    EXPECT_FLOAT_EQ(center.y, 0.0F);
+    EXPECT_FLOAT_EQ(center.z, 0.125F);
+    EXPECT_EQ(fan.GetPoint(1), Base::Vector3f(2.0F, 0.0F, 0.0F));
+    EXPECT_EQ(fan.GetPoint(2), Base::Vector3f(0.0F, 1.0F, 0.0F));
+    EXPECT_EQ(fan.GetPoint(3), Base::Vector3f(-2.0F, 0.0F, 0.0F));
+    EXPECT_EQ(fan.GetPoint(4), Base::Vector3f(0.0F, -1.0F, 0.0F));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
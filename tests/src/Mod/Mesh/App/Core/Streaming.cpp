@@ -0,0 +1,341 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <Mod/Mesh/App/Core/IO/StreamOBJ.h>
+#include <Mod/Mesh/App/Core/IO/StreamPLY.h>
+#include <Mod/Mesh/App/Core/IO/StreamSTL.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Streaming.h>
+#include <Mod/Mesh/App/Core/TrimByPlane.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class StreamingTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a flat grid of 20 x 20 quads in the xy plane
+        const int size = 20;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                Base::Vector3f p1(float(i), float(j), 0.0F);
+                Base::Vector3f p2(float(i + 1), float(j), 0.0F);
+                Base::Vector3f p3(float(i + 1), float(j + 1), 0.0F);
+                Base::Vector3f p4(float(i), float(j + 1), 0.0F);
+                kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+                kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p3, p4));
+            }
+        }
+    }
+
+    std::string SaveBinary() const
+    {
+        std::stringstream str;
+        MeshCore::MeshOutput output(kernel);
+        output.SaveBinarySTL(str);
+        return str.str();
+    }
+
+    std::string SaveAscii() const
+    {
+        std::stringstream str;
+        MeshCore::MeshOutput output(kernel);
+        output.SaveAsciiSTL(str);
+        return str.str();
+    }
+
+    std::string SaveOBJ() const
+    {
+        std::stringstream str;
+        MeshCore::MeshOutput output(kernel);
+        output.SaveOBJ(str);
+        return str.str();
+    }
+
+    std::string SavePLY(bool binary) const
+    {
+        std::stringstream str;
+        MeshCore::MeshOutput output(kernel);
+        if (binary) {
+            output.SaveBinaryPLY(str);
+        }
+        else {
+            output.SaveAsciiPLY(str);
+        }
+        return str.str();
+    }
+
+    // reads all blocks and checks that the area is the one of the grid
+    static void CheckAllBlocks(MeshCore::StreamReader& reader, std::size_t blockSize)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        std::size_t numBlocks = 0;
+        std::size_t numFacets = 0;
+        float area = 0.0F;
+        while (reader.ReadBlock(facets)) {
+            EXPECT_LE(facets.size(), blockSize);
+            numBlocks++;
+            numFacets += facets.size();
+            for (const auto& it : facets) {
+                area += it.Area();
+            }
+        }
+        EXPECT_EQ(numBlocks, (800 + blockSize - 1) / blockSize);
+        EXPECT_EQ(numFacets, 800);
+        EXPECT_FLOAT_EQ(area, 400.0F);
+    }
+
+    const MeshCore::MeshKernel& GetKernel() const
+    {
+        return kernel;
+    }
+
+private:
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(StreamingTest, TestReadBinaryBlocks)
+{
+    std::stringstream str(SaveBinary());
+    MeshCore::StreamReaderSTL reader(str, 100);
+    EXPECT_TRUE(reader.IsValid());
+    EXPECT_FALSE(reader.IsAscii());
+    EXPECT_EQ(reader.CountFacets(), 800);
+
+    std::size_t numFacets = 0;
+    std::size_t numBlocks = 0;
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    while (reader.ReadBlock(facets)) {
+        numFacets += facets.size();
+        numBlocks++;
+    }
+    EXPECT_EQ(numFacets, 800);
+    EXPECT_EQ(numBlocks, 8);
+}
+
+TEST_F(StreamingTest, TestReadAsciiBlocks)
+{
+    std::stringstream str(SaveAscii());
+    MeshCore::StreamReaderSTL reader(str, 300);
+    EXPECT_TRUE(reader.IsValid());
+    EXPECT_TRUE(reader.IsAscii());
+
+    std::size_t numFacets = 0;
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    while (reader.ReadBlock(facets)) {
+        numFacets += facets.size();
+    }
+    EXPECT_EQ(numFacets, 800);
+}
+
+TEST_F(StreamingTest, TestReadAsciiWithoutNormal)
+{
+    std::stringstream str(
+        "solid test\n"
+        "  facet\n"
+        "    outer loop\n"
+        "      vertex 0 0 0\n"
+        "      vertex 1 0 0\n"
+        "      vertex 0 1 0\n"
+        "    endloop\n"
+        "  endfacet\n"
+        "endsolid test\n"
+    );
+    MeshCore::StreamReaderSTL reader(str);
+    EXPECT_TRUE(reader.IsAscii());
+
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    ASSERT_TRUE(reader.ReadBlock(facets));
+    ASSERT_EQ(facets.size(), 1);
+    EXPECT_EQ(facets[0].GetNormal(), Base::Vector3f(0.0F, 0.0F, 1.0F));
+}
+
+TEST_F(StreamingTest, TestReadOBJBlocks)
+{
+    std::stringstream str(SaveOBJ());
+    MeshCore::StreamReaderOBJ reader(str, 300);
+    EXPECT_TRUE(reader.IsValid());
+    EXPECT_EQ(reader.CountFacets(), 800);
+    CheckAllBlocks(reader, 300);
+
+    reader.Rewind();
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    EXPECT_TRUE(reader.ReadBlock(facets));
+    EXPECT_EQ(facets.size(), 300);
+}
+
+TEST_F(StreamingTest, TestReadOBJPolygons)
+{
+    // a quad given with relative indices and texture coordinates
+    std::stringstream str(
+        "v 0 0 0\n"
+        "v 1 0 0\n"
+        "v 1 1 0\n"
+        "v 0 1 0\n"
+        "vt 0 0\n"
+        "f -4/1 -3/1 -2/1 -1/1\n"
+    );
+    MeshCore::StreamReaderOBJ reader(str);
+    EXPECT_EQ(reader.CountPoints(), 4);
+    EXPECT_EQ(reader.CountFacets(), 2);
+
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    ASSERT_TRUE(reader.ReadBlock(facets));
+    ASSERT_EQ(facets.size(), 2);
+    EXPECT_FLOAT_EQ(facets[0].Area() + facets[1].Area(), 1.0F);
+    EXPECT_EQ(facets[0].GetNormal(), Base::Vector3f(0.0F, 0.0F, 1.0F));
+    EXPECT_FALSE(reader.ReadBlock(facets));
+}
+
+TEST_F(StreamingTest, TestReadAsciiPLYBlocks)
+{
+    std::stringstream str(SavePLY(false));
+    MeshCore::StreamReaderPLY reader(str, 300);
+    EXPECT_TRUE(reader.IsValid());
+    EXPECT_EQ(reader.CountPoints(), 441);
+    EXPECT_EQ(reader.CountFacets(), 800);
+    CheckAllBlocks(reader, 300);
+}
+
+TEST_F(StreamingTest, TestReadBinaryPLYBlocks)
+{
+    std::stringstream str(SavePLY(true));
+    MeshCore::StreamReaderPLY reader(str, 300);
+    EXPECT_TRUE(reader.IsValid());
+    EXPECT_EQ(reader.CountPoints(), 441);
+    CheckAllBlocks(reader, 300);
+
+    reader.Rewind();
+    CheckAllBlocks(reader, 300);
+}
+
+TEST_F(StreamingTest, TestReadPLYFacesFirst)
+{
+    // the faces come before the vertices and an unknown element must be skipped
+    std::stringstream str(
+        "ply\n"
+        "format ascii 1.0\n"
+        "element face 1\n"
+        "property uchar intensity\n"
+        "property list uchar int vertex_indices\n"
+        "element edge 1\n"
+        "property int vertex1\n"
+        "property int vertex2\n"
+        "element vertex 4\n"
+        "property float x\n"
+        "property float y\n"
+        "property float z\n"
+        "property uchar red\n"
+        "end_header\n"
+        "7 4 0 1 2 3\n"
+        "0 1\n"
+        "0 0 0 255\n"
+        "1 0 0 255\n"
+        "1 1 0 255\n"
+        "0 1 0 255\n"
+    );
+    MeshCore::StreamReaderPLY reader(str);
+    ASSERT_TRUE(reader.IsValid());
+    EXPECT_EQ(reader.CountPoints(), 4);
+
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    ASSERT_TRUE(reader.ReadBlock(facets));
+    ASSERT_EQ(facets.size(), 2);
+    EXPECT_FLOAT_EQ(facets[0].Area() + facets[1].Area(), 1.0F);
+    EXPECT_FALSE(reader.ReadBlock(facets));
+}
+
+TEST_F(StreamingTest, TestTrimFacetOnPlane)
+{
+    Base::Vector3f base(0.0F, 0.0F, 0.0F);
+    Base::Vector3f normal(1.0F, 0.0F, 0.0F);
+    std::vector<MeshCore::MeshGeomFacet> trimmed;
+
+    // one point on the plane, the others below: the facet is kept
+    MeshCore::MeshGeomFacet below(
+        Base::Vector3f(0.0F, 0.0F, 0.0F),
+        Base::Vector3f(-1.0F, 0.0F, 0.0F),
+        Base::Vector3f(-1.0F, 1.0F, 0.0F)
+    );
+    MeshCore::MeshTrimByPlane::TrimFacet(below, base, normal, trimmed);
+    ASSERT_EQ(trimmed.size(), 1);
+    EXPECT_FLOAT_EQ(trimmed[0].Area(), below.Area());
+
+    // one point on the plane, the others above: the facet is dropped
+    trimmed.clear();
+    MeshCore::MeshGeomFacet above(
+        Base::Vector3f(0.0F, 0.0F, 0.0F),
+        Base::Vector3f(1.0F, 0.0F, 0.0F),
+        Base::Vector3f(1.0F, 1.0F, 0.0F)
+    );
+    MeshCore::MeshTrimByPlane::TrimFacet(above, base, normal, trimmed);
+    EXPECT_TRUE(trimmed.empty());
+
+    // one point on the plane, one below and one above: the facet is split into one
+    trimmed.clear();
+    MeshCore::MeshGeomFacet split(
+        Base::Vector3f(0.0F, 1.0F, 0.0F),
+        Base::Vector3f(-1.0F, 0.0F, 0.0F),
+        Base::Vector3f(1.0F, 0.0F, 0.0F)
+    );
+    MeshCore::MeshTrimByPlane::TrimFacet(split, base, normal, trimmed);
+    ASSERT_EQ(trimmed.size(), 1);
+    EXPECT_FLOAT_EQ(trimmed[0].Area(), 0.5F * split.Area());
+    EXPECT_EQ(trimmed[0].GetNormal(), split.GetNormal());
+
+    // two points below and one above
+    trimmed.clear();
+    MeshCore::MeshGeomFacet two(
+        Base::Vector3f(-1.0F, 0.0F, 0.0F),
+        Base::Vector3f(1.0F, 0.0F, 0.0F),
+        Base::Vector3f(-1.0F, 2.0F, 0.0F)
+    );
+    MeshCore::MeshTrimByPlane::TrimFacet(two, base, normal, trimmed);
+    ASSERT_EQ(trimmed.size(), 2);
+    EXPECT_FLOAT_EQ(trimmed[0].Area() + trimmed[1].Area(), 1.5F);
+}
+
+TEST_F(StreamingTest, TestTrimAndWrite)
+{
+    std::stringstream in(SaveBinary());
+    std::stringstream out;
+    MeshCore::StreamReaderSTL reader(in, 64);
+    MeshCore::StreamWriterSTL writer(out);
+
+    // keep the half with x < 10
+    MeshCore::MeshStreamPipeline pipeline;
+    pipeline.SetTrimPlane(Base::Vector3f(10.0F, 0.0F, 0.0F), Base::Vector3f(1.0F, 0.0F, 0.0F));
+    Base::BoundBox3f box = pipeline.Run(reader, &writer);
+    EXPECT_EQ(pipeline.CountFacets(), 400);
+    EXPECT_FLOAT_EQ(box.MaxX, 10.0F);
+
+    MeshCore::MeshKernel result;
+    MeshCore::MeshInput input(result);
+    out.seekg(0);
+    EXPECT_TRUE(input.LoadBinarySTL(out));
+    EXPECT_EQ(result.CountFacets(), 400);
+}
+
+TEST_F(StreamingTest, TestPreview)
+{
+    std::stringstream in(SaveBinary());
+    MeshCore::StreamReaderSTL reader(in);
+
+    MeshCore::MeshStreamPipeline pipeline;
+    Base::BoundBox3f box = pipeline.Run(reader, nullptr);
+    reader.Rewind();
+
+    MeshCore::MeshStreamPreview preview(box, 5);
+    pipeline.SetPreview(&preview);
+    pipeline.Run(reader, nullptr);
+
+    MeshCore::MeshKernel kernel;
+    preview.Finish(kernel);
+    EXPECT_GT(kernel.CountFacets(), 0);
+    EXPECT_LT(kernel.CountFacets(), GetKernel().CountFacets());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
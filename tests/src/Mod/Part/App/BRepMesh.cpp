@@ -173,4 +173,50 @@ TEST_F(BRepMeshTest, testUnconnectedDomains)
     EXPECT_EQ(points.size(), 6);
     EXPECT_EQ(faces.size(), 4);
 }
+
+TEST_F(BRepMeshTest, testMergedPointOrder)
+{
+    std::vector<Base::Vector3d> points;
+    std::vector<Part::BRepMesh::Facet> faces;
+    Part::BRepMesh brepMesh;
+    brepMesh.getFacesFromDomains(getUnconnectedDomains(), points, faces);
+
+    // merged points keep the position and index of their first use
+    ASSERT_EQ(points.size(), 6);
+    ASSERT_EQ(faces.size(), 4);
+    EXPECT_EQ(points[0], Base::Vector3d(1.0e-10, 1.0e-10, 1.0e-10));
+    EXPECT_EQ(points[3], Base::Vector3d(1.0e-10, 10, 1.0e-10));
+    EXPECT_EQ(points[4], Base::Vector3d(0, 10, 10));
+    EXPECT_EQ(points[5], Base::Vector3d(0, 0, 10));
+
+    EXPECT_EQ(faces[2].I1, 0);
+    EXPECT_EQ(faces[2].I2, 3);
+    EXPECT_EQ(faces[2].I3, 4);
+    EXPECT_EQ(faces[3].I1, 0);
+    EXPECT_EQ(faces[3].I2, 4);
+    EXPECT_EQ(faces[3].I3, 5);
+}
+
+TEST_F(BRepMeshTest, testDegeneratedFacets)
+{
+    auto domains = getConnectedDomains();
+    Part::BRepMesh::Facet face;
+    face.I1 = 1;
+    face.I2 = 1;
+    face.I3 = 2;
+    domains[0].facets.insert(domains[0].facets.begin(), face);
+
+    std::vector<Base::Vector3d> points;
+    std::vector<Part::BRepMesh::Facet> faces;
+    Part::BRepMesh brepMesh;
+    brepMesh.getFacesFromDomains(domains, points, faces);
+
+    EXPECT_EQ(points.size(), 6);
+    EXPECT_EQ(faces.size(), 4);
+
+    auto segments = brepMesh.createSegments();
+    ASSERT_EQ(segments.size(), 2);
+    EXPECT_EQ(segments[0], Part::BRepMesh::Segment({0, 1}));
+    EXPECT_EQ(segments[1], Part::BRepMesh::Segment({2, 3}));
+}
 // NOLINTEND
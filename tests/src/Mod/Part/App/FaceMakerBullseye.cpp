@@ -8,10 +8,13 @@
 #include "PartTestHelpers.h"
 
 #include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepBuilderAPI_MakePolygon.hxx>
 #include <BRepBuilderAPI_MakeWire.hxx>
 #include <BRepGProp.hxx>
 #include <GC_MakeCircle.hxx>
 #include <GProp_GProps.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <gp_Pln.hxx>
 #include <numbers>
 
@@ -84,6 +87,20 @@ protected:
         return mw.Wire();
     }
 
+    // Build a CCW L-shaped wire on the XY plane, with the notch in the upper right corner
+    static TopoDS_Wire makeLShapeWire()
+    {
+        BRepBuilderAPI_MakePolygon poly;
+        poly.Add(gp_Pnt(0, 0, 0));
+        poly.Add(gp_Pnt(10, 0, 0));
+        poly.Add(gp_Pnt(10, 4, 0));
+        poly.Add(gp_Pnt(4, 4, 0));
+        poly.Add(gp_Pnt(4, 10, 0));
+        poly.Add(gp_Pnt(0, 10, 0));
+        poly.Close();
+        return poly.Wire();
+    }
+
     static double faceArea(const TopoDS_Shape& shape)
     {
         GProp_GProps props;
@@ -346,4 +363,65 @@ TEST_F(FaceMakerBullseyeTest, buildEssenceManyWires)
     EXPECT_NEAR(faceArea(fm.Shape()), expected, 1e-3);
 }
 
+TEST_F(FaceMakerBullseyeTest, buildEssenceSeparatePlatesWithHoles)
+{
+    FaceMakerBullseye fm;
+    gp_Pln plane;
+    fm.setPlane(plane);
+
+    // A row of plates, each with a hole, and a plate inside the hole of the last one
+    for (int i = 0; i < 4; ++i) {
+        double x = i * 20.0;
+        fm.addWire(makeCircleWire(x + 5, 5, 0, 2.0));
+        fm.addWire(makeRectWire(x, 0, x + 10, 10));
+    }
+    fm.addWire(makeRectWire(64, 4, 66, 6));
+
+    fm.Build();
+    ASSERT_TRUE(fm.IsDone());
+
+    TopTools_IndexedMapOfShape faces;
+    TopExp::MapShapes(fm.Shape(), TopAbs_FACE, faces);
+    EXPECT_EQ(faces.Extent(), 5);
+    double expected = 4 * (100.0 - std::numbers::pi * 4.0) + 4.0;
+    EXPECT_NEAR(faceArea(fm.Shape()), expected, 1e-4);
+}
+
+TEST_F(FaceMakerBullseyeTest, hitTestConcaveOuterWithHole)
+{
+    gp_Pln plane;
+    // An L-shaped outer wire with a hole in its corner
+    TestDriller driller(plane, makeLShapeWire());
+    driller.addHole(makeCircleWire(2, 2, 0, 1.5));
+
+    using HitTest = TestDriller::HitTest;
+    // Inside the bounding box of the outer wire, but in its notch
+    EXPECT_EQ(driller.hitTest(makeRectWire(7, 7, 8, 8)), HitTest::HitNone);
+    // Starting on the outer wire
+    EXPECT_EQ(driller.hitTest(makeRectWire(10, 1, 11, 2)), HitTest::HitNone);
+    EXPECT_EQ(driller.hitTest(makeRectWire(1.5, 1.5, 2.5, 2.5)), HitTest::HitOuter);
+    EXPECT_EQ(driller.hitTest(makeRectWire(6, 1, 8, 3)), HitTest::Hit);
+}
+
+TEST_F(FaceMakerBullseyeTest, buildEssenceConcaveOuterWithHole)
+{
+    FaceMakerBullseye fm;
+    gp_Pln plane;
+    fm.setPlane(plane);
+
+    // The profile in the notch of the L-shape is a face of its own and not a hole
+    fm.addWire(makeRectWire(7, 7, 8, 8));
+    fm.addWire(makeCircleWire(2, 2, 0, 1.5));
+    fm.addWire(makeLShapeWire());
+
+    fm.Build();
+    ASSERT_TRUE(fm.IsDone());
+
+    TopTools_IndexedMapOfShape faces;
+    TopExp::MapShapes(fm.Shape(), TopAbs_FACE, faces);
+    EXPECT_EQ(faces.Extent(), 2);
+    double expected = 64.0 - std::numbers::pi * 2.25 + 1.0;
+    EXPECT_NEAR(faceArea(fm.Shape()), expected, 1e-4);
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Part/App/OperationCache.h>
+#include <Mod/Part/App/ShapeContentHash.h>
+#include <Mod/Part/App/TopoShapeOpCode.h>
+
+#include <algorithm>
+#include <src/App/InitApplication.h>
+#include <BRep_Builder.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <Standard_Version.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+using namespace Part;
+
+class OperationCacheTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+#if OCC_VERSION_HEX < 0x070600
+        GTEST_SKIP() << "The operation cache requires OCCT 7.6";
+#endif
+        wasEnabled = OperationCache::instance().isEnabled();
+        OperationCache::instance().setEnabled(true);
+        OperationCache::instance().clear();
+    }
+
+    void TearDown() override
+    {
+        OperationCache::instance().setEnabled(wasEnabled);
+    }
+
+    static std::vector<std::string> names(const TopoShape& shape)
+    {
+        std::vector<std::string> result;
+        for (const auto& element : shape.getElementMap()) {
+            result.push_back(element.index.toString() + "=" + element.name.toString());
+        }
+        std::ranges::sort(result);
+        return result;
+    }
+
+    static TopoShape copy(const TopoShape& shape)
+    {
+        return {BRepBuilderAPI_Copy(shape.getShape()).Shape(), shape.Tag};
+    }
+
+    static TopoDS_Shape box(double x)
+    {
+        return BRepPrimAPI_MakeBox(gp_Pnt(x, 0.0, 0.0), 2.0, 2.0, 2.0).Shape();
+    }
+
+    bool wasEnabled = false;
+};
+
+TEST_F(OperationCacheTest, testBooleanOfCopiedShapes)
+{
+    TopoShape base(box(0.0), 1L);
+    TopoShape tool(box(1.0), 2L);
+    TopoShape first;
+    first.makeElementBoolean(OpCodes::Cut, {base, tool});
+    EXPECT_EQ(OperationCache::instance().size(), 1);
+    ASSERT_FALSE(first.getElementMap().empty());
+
+    // geometrically unchanged inputs return the cached result with the same names, including
+    // those of the faces of the base that the cut leaves unchanged
+    TopoShape second;
+    second.makeElementBoolean(OpCodes::Cut, {copy(base), copy(tool)});
+    EXPECT_TRUE(second.getShape().IsPartner(first.getShape()));
+    EXPECT_EQ(names(second), names(first));
+    EXPECT_EQ(OperationCache::instance().size(), 1);
+}
+
+TEST_F(OperationCacheTest, testBooleanOfMovedShape)
+{
+    TopoShape base(box(0.0), 1L);
+    TopoShape tool(box(1.0), 2L);
+    TopoShape first;
+    first.makeElementBoolean(OpCodes::Fuse, {base, tool});
+
+    gp_Trsf move;
+    move.SetTranslation(gp_Vec(0.0, 1.0, 0.0));
+    TopoShape moved(tool);
+    moved.move(move);
+    TopoShape second;
+    second.makeElementBoolean(OpCodes::Fuse, {base, moved});
+    EXPECT_FALSE(second.getShape().IsPartner(first.getShape()));
+    EXPECT_EQ(OperationCache::instance().size(), 2);
+}
+
+TEST_F(OperationCacheTest, testPrism)
+{
+    TopoShape face(TopoShape(box(0.0)).getSubShape(TopAbs_FACE, 1), 1L);
+    TopoShape first;
+    first.makeElementPrism(face, gp_Vec(-1.0, 0.0, 0.0));
+    TopoShape second;
+    second.makeElementPrism(copy(face), gp_Vec(-1.0, 0.0, 0.0));
+    EXPECT_TRUE(second.getShape().IsPartner(first.getShape()));
+    EXPECT_EQ(names(second), names(first));
+
+    TopoShape third;
+    third.makeElementPrism(face, gp_Vec(-2.0, 0.0, 0.0));
+    EXPECT_FALSE(third.getShape().IsPartner(first.getShape()));
+}
+
+TEST_F(OperationCacheTest, testDisabled)
+{
+    OperationCache::instance().setEnabled(false);
+    TopoShape base(box(0.0), 1L);
+    TopoShape tool(box(1.0), 2L);
+    TopoShape first;
+    first.makeElementBoolean(OpCodes::Common, {base, tool});
+    TopoShape second;
+    second.makeElementBoolean(OpCodes::Common, {base, tool});
+    EXPECT_FALSE(second.getShape().IsPartner(first.getShape()));
+    EXPECT_EQ(OperationCache::instance().size(), 0);
+}
+
+TEST_F(OperationCacheTest, testContentHashOfShapeChangedInPlace)
+{
+    TopoDS_Shape shape = box(0.0);
+    std::string hash = ShapeContentHash::compute(shape);
+    EXPECT_EQ(ShapeContentHash::compute(shape), hash);
+
+    // updating the tolerance keeps the TShape of the box
+    TopoDS_Vertex vertex = TopoDS::Vertex(TopExp_Explorer(shape, TopAbs_VERTEX).Current());
+    BRep_Builder().UpdateVertex(vertex, 0.1);
+    EXPECT_NE(ShapeContentHash::compute(shape), hash);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
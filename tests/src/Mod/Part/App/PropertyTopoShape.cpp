@@ -2,9 +2,19 @@
 
 #include <gtest/gtest.h>
 
+#include <BRep_Builder.hxx>
 #include <BRepFilletAPI_MakeFillet.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <gp_Trsf.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/FileInfo.h>
+#include <Base/Writer.h>
 #include "Mod/Part/App/FeaturePartCommon.h"
 #include "Mod/Part/App/PropertyTopoShape.h"
+#include "Mod/Part/App/ShapePayload.h"
 #include <src/App/InitApplication.h>
 #include "PartTestHelpers.h"
 #include "Mod/Part/App/TopoShapeCompoundPy.h"
@@ -269,3 +279,106 @@ TEST_F(PropertyTopoShapeTest, testRestore)
     EXPECT_TRUE(reader.isValid());
     EXPECT_TRUE(reader.isEndOfElement());
 }
+
+TEST_F(PropertyTopoShapeTest, testShapePayloadWithElementMap)
+{
+    // Arrange
+    const auto& shapeIn = _common->Shape.getShape();
+    std::stringstream stream;
+    // Act
+    ShapePayload::write(stream, shapeIn, true);
+    std::string elementMap;
+    TopoShape shapeOut(ShapePayload::read(stream, elementMap));
+    shapeOut.Hasher = shapeIn.Hasher;
+    std::istringstream mapStream(elementMap);
+    shapeOut.restoreElementMap(mapStream);
+    // Assert
+    EXPECT_EQ(getVolume(shapeOut.getShape()), 3);
+    EXPECT_EQ(shapeOut.countSubShapes(TopAbs_FACE), shapeIn.countSubShapes(TopAbs_FACE));
+    EXPECT_EQ(shapeOut.getElementMapSize(), 26);
+    EXPECT_EQ(shapeOut.getMappedName(Data::IndexedName("Face1")),
+              shapeIn.getMappedName(Data::IndexedName("Face1")));
+}
+
+TEST_F(PropertyTopoShapeTest, testShapePayloadOfSeparateSolids)
+{
+    // Arrange
+    TopoDS_Compound compound;
+    BRep_Builder builder;
+    builder.MakeCompound(compound);
+    builder.Add(compound, BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape());
+    builder.Add(compound, BRepPrimAPI_MakeBox(gp_Pnt(2.0, 0.0, 0.0), 1.0, 2.0, 1.0).Shape());
+    std::stringstream stream;
+    // Act
+    ShapePayload::write(stream, TopoShape(compound), false);
+    std::string elementMap;
+    auto shapeOut = ShapePayload::read(stream, elementMap);
+    // Assert
+    ASSERT_EQ(shapeOut.ShapeType(), TopAbs_COMPOUND);
+    EXPECT_EQ(shapeOut.NbChildren(), 2);
+    EXPECT_DOUBLE_EQ(getVolume(shapeOut), 3.0);
+    EXPECT_TRUE(elementMap.empty());
+}
+
+TEST_F(PropertyTopoShapeTest, testShapePayloadKeepsSharedSubShapes)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape();
+    gp_Trsf move;
+    move.SetTranslation(gp_Vec(2.0, 0.0, 0.0));
+    TopoDS_Compound compound;
+    BRep_Builder builder;
+    builder.MakeCompound(compound);
+    builder.Add(compound, box);
+    builder.Add(compound, box.Moved(TopLoc_Location(move)));
+    std::stringstream stream;
+    // Act
+    ShapePayload::write(stream, TopoShape(compound), false);
+    std::string elementMap;
+    auto shapeOut = ShapePayload::read(stream, elementMap);
+    // Assert
+    TopoDS_Iterator it(shapeOut);
+    ASSERT_TRUE(it.More());
+    auto first = it.Value();
+    it.Next();
+    ASSERT_TRUE(it.More());
+    EXPECT_TRUE(first.IsPartner(it.Value()));
+    EXPECT_DOUBLE_EQ(getVolume(shapeOut), 2.0);
+}
+
+TEST_F(PropertyTopoShapeTest, testSaveAndRestoreNativeShapeFormat)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    bool native = hGrp->GetBool("NativeShapeFormat", false);
+    hGrp->SetBool("NativeShapeFormat", true);
+    const auto& shapeIn = _common->Shape.getShape();
+    auto mappedName = shapeIn.getMappedName(Data::IndexedName("Face1"));
+    std::string objectName = _common->getNameInDocument();
+    std::string fileName = App::Application::getTempPath() + _docName + ".FCStd";
+    Base::StringWriter writer;
+    _common->Shape.Save(writer);
+    // Act
+    bool saved = _doc->saveAs(fileName.c_str());
+    hGrp->SetBool("NativeShapeFormat", native);
+    App::GetApplication().closeDocument(_docName.c_str());
+    _doc = nullptr;
+    _common = nullptr;
+    auto doc = App::GetApplication().openDocument(fileName.c_str());
+    // Assert
+    EXPECT_NE(writer.getString().find(".fcs"), std::string::npos);
+    ASSERT_TRUE(saved);
+    ASSERT_NE(doc, nullptr);
+    auto feature = freecad_cast<Part::Feature*>(doc->getObject(objectName.c_str()));
+    ASSERT_NE(feature, nullptr);
+    // the element map is restored in afterRestore() once the string hasher has been read
+    const auto& shapeOut = feature->Shape.getShape();
+    EXPECT_EQ(getVolume(shapeOut.getShape()), 3);
+    EXPECT_EQ(shapeOut.getElementMapSize(), 26);
+    EXPECT_EQ(shapeOut.getMappedName(Data::IndexedName("Face1")), mappedName);
+    // Tear down
+    App::GetApplication().closeDocument(doc->getName());
+    Base::FileInfo(fileName).deleteFile();
+}
@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <Mod/Part/App/TessellationCache.h>
+
+#include <src/App/InitApplication.h>
+#include <App/Application.h>
+#include <Base/FileInfo.h>
+#include <Base/TimeInfo.h>
+#include <BRep_Tool.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepTools.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_Version.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class TessellationCacheTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+#if OCC_VERSION_HEX < 0x070600
+        GTEST_SKIP() << "The tessellation cache requires OCCT 7.6";
+#endif
+        Part::TessellationCache::instance().clear();
+        shape = BRepPrimAPI_MakeCylinder(2.0, 5.0).Shape();
+    }
+
+    static void clean(const TopoDS_Shape& shape)
+    {
+#if OCC_VERSION_HEX < 0x070600
+        BRepTools::Clean(shape);
+#else
+        BRepTools::Clean(shape, Standard_True);
+#endif
+    }
+
+    static int countTriangles(const TopoDS_Shape& shape)
+    {
+        int count = 0;
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            TopLoc_Location loc;
+            const TopoDS_Face& face = TopoDS::Face(xp.Current());
+            Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+            if (mesh.IsNull()) {
+                return -1;
+            }
+            count += mesh->NbTriangles();
+        }
+        return count;
+    }
+
+    static bool hasEdgePolygons(const TopoDS_Shape& shape)
+    {
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            const TopoDS_Face& face = TopoDS::Face(xp.Current());
+            TopLoc_Location loc;
+            Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+            for (TopExp_Explorer xp2(face, TopAbs_EDGE); xp2.More(); xp2.Next()) {
+                const TopoDS_Edge& edge = TopoDS::Edge(xp2.Current());
+                if (BRep_Tool::PolygonOnTriangulation(edge, mesh, loc).IsNull()) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    TopoDS_Shape shape;
+};
+
+TEST_F(TessellationCacheTest, testRemeshSameShape)
+{
+    auto& cache = Part::TessellationCache::instance();
+    EXPECT_FALSE(cache.mesh(shape, 0.01, 0.5));
+    int numTriangles = countTriangles(shape);
+    EXPECT_GT(numTriangles, 0);
+    EXPECT_EQ(cache.size(), 1);
+
+    clean(shape);
+    EXPECT_EQ(countTriangles(shape), -1);
+
+    EXPECT_TRUE(cache.mesh(shape, 0.01, 0.5));
+    EXPECT_EQ(countTriangles(shape), numTriangles);
+    EXPECT_TRUE(hasEdgePolygons(shape));
+}
+
+TEST_F(TessellationCacheTest, testCopiedShape)
+{
+    auto& cache = Part::TessellationCache::instance();
+    EXPECT_FALSE(cache.mesh(shape, 0.01, 0.5));
+
+    // a copy has new sub-shapes but the same geometry
+    TopoDS_Shape copy = BRepBuilderAPI_Copy(shape, Standard_True, Standard_False).Shape();
+    EXPECT_TRUE(cache.mesh(copy, 0.01, 0.5));
+    EXPECT_EQ(countTriangles(copy), countTriangles(shape));
+    EXPECT_TRUE(hasEdgePolygons(copy));
+}
+
+TEST_F(TessellationCacheTest, testOtherParameters)
+{
+    auto& cache = Part::TessellationCache::instance();
+    EXPECT_FALSE(cache.mesh(shape, 0.01, 0.5));
+    clean(shape);
+    EXPECT_FALSE(cache.mesh(shape, 0.1, 0.5));
+    EXPECT_EQ(cache.size(), 2);
+}
+
+TEST_F(TessellationCacheTest, testKeepFinerTriangulation)
+{
+    auto& cache = Part::TessellationCache::instance();
+    EXPECT_FALSE(cache.mesh(shape, 0.1, 0.5));
+    clean(shape);
+    EXPECT_FALSE(cache.mesh(shape, 0.01, 0.5));
+    int numTriangles = countTriangles(shape);
+
+    // the cached coarser triangulation doesn't replace the finer one
+    EXPECT_TRUE(cache.mesh(shape, 0.1, 0.5));
+    EXPECT_EQ(countTriangles(shape), numTriangles);
+    EXPECT_TRUE(hasEdgePolygons(shape));
+}
+
+TEST_F(TessellationCacheTest, testMemoryLimit)
+{
+    auto& cache = Part::TessellationCache::instance();
+    std::size_t maxMemory = cache.getMaxMemory();
+    EXPECT_FALSE(cache.mesh(shape, 0.01, 0.5));
+    clean(shape);
+    EXPECT_FALSE(cache.mesh(shape, 0.1, 0.5));
+
+    // the most recently used entry is kept
+    cache.setMaxMemory(0);
+    EXPECT_EQ(cache.size(), 1);
+    clean(shape);
+    EXPECT_TRUE(cache.mesh(shape, 0.1, 0.5));
+    cache.setMaxMemory(maxMemory);
+}
+
+TEST_F(TessellationCacheTest, testDiskCache)
+{
+    auto& cache = Part::TessellationCache::instance();
+    Base::FileInfo dir(Base::FileInfo::getTempFileName("tessellation"));
+    EXPECT_FALSE(cache.mesh(shape, 0.01, 0.5, false, dir.filePath()));
+    int numTriangles = countTriangles(shape);
+
+    cache.clear();
+    clean(shape);
+    EXPECT_TRUE(cache.mesh(shape, 0.01, 0.5, false, dir.filePath()));
+    EXPECT_EQ(countTriangles(shape), numTriangles);
+    EXPECT_TRUE(hasEdgePolygons(shape));
+
+    dir.deleteDirectoryRecursive();
+}
+
+TEST_F(TessellationCacheTest, testDiskCacheHitTouchesFile)
+{
+    auto& cache = Part::TessellationCache::instance();
+    Base::FileInfo dir(Base::FileInfo::getTempFileName("tessellation"));
+    EXPECT_FALSE(cache.mesh(shape, 0.01, 0.5, false, dir.filePath()));
+
+    std::vector<Base::FileInfo> files = dir.getDirectoryContent();
+    ASSERT_EQ(files.size(), 1);
+    std::filesystem::path path = Base::FileInfo::stringToPath(files[0].filePath());
+    std::filesystem::last_write_time(
+        path,
+        std::filesystem::last_write_time(path) - std::chrono::hours(2)
+    );
+    std::time_t oldTime = files[0].lastModified().getTime_t();
+
+    // the size limit removes the least recently used files first
+    cache.clear();
+    clean(shape);
+    EXPECT_TRUE(cache.mesh(shape, 0.01, 0.5, false, dir.filePath()));
+    EXPECT_GT(files[0].lastModified().getTime_t(), oldTime);
+
+    dir.deleteDirectoryRecursive();
+}
+
+TEST_F(TessellationCacheTest, testCorruptedDiskCache)
+{
+    auto& cache = Part::TessellationCache::instance();
+    Base::FileInfo dir(Base::FileInfo::getTempFileName("tessellation"));
+    EXPECT_FALSE(cache.mesh(shape, 0.01, 0.5, false, dir.filePath()));
+
+    // overwrite the number of faces with a value that exceeds the file size
+    std::vector<Base::FileInfo> files = dir.getDirectoryContent();
+    ASSERT_EQ(files.size(), 1);
+    EXPECT_TRUE(files[0].hasExtension("tess"));
+    {
+        std::fstream str(files[0].filePath(), std::ios::in | std::ios::out | std::ios::binary);
+        str.seekp(8);
+        uint32_t numFaces = 0xffffffff;
+        str.write(reinterpret_cast<const char*>(&numFaces), sizeof(numFaces));
+    }
+
+    cache.clear();
+    clean(shape);
+    EXPECT_FALSE(cache.mesh(shape, 0.01, 0.5, false, dir.filePath()));
+    EXPECT_GT(countTriangles(shape), 0);
+
+    // the file is replaced and no temporary file is left
+    files = dir.getDirectoryContent();
+    ASSERT_EQ(files.size(), 1);
+    EXPECT_TRUE(files[0].hasExtension("tess"));
+
+    dir.deleteDirectoryRecursive();
+}
+
+TEST_F(TessellationCacheTest, testDiskCacheSizeLimit)
+{
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    hGrp->SetUnsigned("TessellationDiskCacheSize", 0);
+
+    auto& cache = Part::TessellationCache::instance();
+    Base::FileInfo dir(Base::FileInfo::getTempFileName("tessellation"));
+    EXPECT_FALSE(cache.mesh(shape, 0.01, 0.5, false, dir.filePath()));
+    EXPECT_TRUE(dir.getDirectoryContent().empty());
+
+    hGrp->RemoveUnsigned("TessellationDiskCacheSize");
+    dir.deleteDirectoryRecursive();
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -3,6 +3,9 @@
 #include <gtest/gtest.h>
 #include "PartTestHelpers.h"
 #include <Mod/Part/App/TopoShape.h>
+#include <BRep_Builder.hxx>
+#include <Standard_Failure.hxx>
+#include <TopoDS_Shell.hxx>
 #include "src/App/InitApplication.h"
 
 
@@ -157,4 +160,48 @@ TEST_F(TopoShapeTest, TestGetSubshape)
     EXPECT_THROW(cube1.getSubShape("WOOHOO", false), Base::ValueError);  // Invalid
 }
 
+TEST_F(TopoShapeTest, TestIsValidChecksChildrenOfCompound)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    Part::TopoShape inner;
+    inner.makeElementCompound({cube2});
+    Part::TopoShape compound;
+    compound.makeElementCompound({cube1, inner});
+    Part::TopoShape empty;
+    empty.makeElementCompound({});
+    // Act
+    bool valid = compound.isValid();
+    bool validAgain = compound.isValid();
+    // Assert
+    EXPECT_TRUE(valid);
+    EXPECT_TRUE(validAgain);
+    EXPECT_TRUE(empty.isValid());
+    EXPECT_THROW(Part::TopoShape().isValid(), Standard_Failure);  // Null shape
+}
+
+TEST_F(TopoShapeTest, TestIsValidReportsEachChild)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    TopoDS_Shell shell;
+    BRep_Builder().MakeShell(shell);  // An empty shell is invalid
+    Part::TopoShape compound;
+    compound.makeElementCompound({cube1, cube2, Part::TopoShape(shell)});
+    std::vector<std::pair<int, bool>> results;
+    auto report = [&results](int index, const TopoDS_Shape&, bool valid) {
+        results.emplace_back(index, valid);
+        return true;
+    };
+    // Act
+    bool valid = compound.isValid(report);
+    // Assert
+    EXPECT_FALSE(valid);
+    EXPECT_FALSE(compound.isValid());
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results[0], std::make_pair(0, true));
+    EXPECT_EQ(results[1], std::make_pair(1, true));
+    EXPECT_EQ(results[2], std::make_pair(2, false));
+}
+
 // clang-format on
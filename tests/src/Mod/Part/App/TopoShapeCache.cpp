@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <Mod/Part/App/TopoShape.h>
 #include <Mod/Part/App/TopoShapeCache.h>
@@ -9,8 +10,11 @@
 #include <TopoDS_TVertex.hxx>
 #include <BRep_TVertex.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRep_Builder.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopoDS_Edge.hxx>
 
 // NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -289,4 +293,52 @@ TEST_F(TopoShapeCacheTest, FindAncestor)
     EXPECT_FALSE(ancestorResultCompound.IsNull());
 }
 
+TEST_F(TopoShapeCacheTest, IncidenceMatchesMapShapesAndAncestors)
+{
+    // Arrange
+    const auto [shape, ancestors] = CreateFusedCubes();
+    Part::TopoShapeCache cache(shape);
+    TopTools_IndexedDataMapOfShapeListOfShape edgeFaces;
+    TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, edgeFaces);
+
+    // Act
+    const auto& incidence = cache.getIncidence(TopAbs_EDGE, TopAbs_FACE);
+
+    // Assert
+    const auto& faces = cache.getAncestry(TopAbs_FACE);
+    ASSERT_EQ(int(incidence.ancestorOffsets.size()), edgeFaces.Extent() + 1);
+    ASSERT_EQ(int(incidence.childOffsets.size()), faces.count() + 1);
+    for (int i = 1; i <= edgeFaces.Extent(); ++i) {
+        const TopoDS_Shape& edge = edgeFaces.FindKey(i);
+        std::vector<int> expected;
+        for (const auto& face : edgeFaces.FindFromIndex(i)) {
+            expected.push_back(cache.findShape(shape, face));
+        }
+        EXPECT_EQ(cache.findAncestors(shape, edge, TopAbs_FACE), expected);
+        EXPECT_TRUE(cache.findAncestor(shape, edge, TopAbs_FACE).IsEqual(edgeFaces(i).First()));
+    }
+    for (int i = 1; i <= faces.count(); ++i) {
+        for (int k = incidence.childOffsets[i - 1]; k < incidence.childOffsets[i]; ++k) {
+            auto edge = cache.findShape(shape, TopAbs_EDGE, incidence.children[k]);
+            EXPECT_EQ(std::ranges::count(cache.findAncestors(shape, edge, TopAbs_FACE), i), 1);
+        }
+    }
+}
+
+TEST_F(TopoShapeCacheTest, ValidityIsResetWhenShapeChangesInPlace)
+{
+    // Arrange
+    auto box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    Part::TopoShapeCache cache(box);
+    cache.getValidity().valid = 1;
+    ASSERT_EQ(cache.getValidity().valid, 1);
+    TopExp_Explorer explorer(box, TopAbs_VERTEX);
+
+    // Act
+    BRep_Builder().UpdateVertex(TopoDS::Vertex(explorer.Current()), 0.5);
+
+    // Assert
+    EXPECT_EQ(cache.getValidity().valid, -1);
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -3,13 +3,16 @@
 #include <TColgp_Array2OfPnt.hxx>
 #include <gtest/gtest.h>
 #include "src/App/InitApplication.h"
+#include <Mod/Part/App/FCBRepAlgoAPI_ParallelFuse.h>
 #include <Mod/Part/App/TopoShape.h>
 #include "Mod/Part/App/TopoShapeMapper.h"
 #include <Mod/Part/App/TopoShapeOpCode.h>
 
 #include "PartTestHelpers.h"
 
+#include <algorithm>
 #include <boost/core/ignore_unused.hpp>
+#include <BRep_Tool.hxx>
 #include <BRepAdaptor_CompCurve.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
@@ -1585,6 +1588,51 @@ TEST_F(TopoShapeExpansionTest, makeElementBooleanFuse)
     ));
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementBooleanFuseOfSeparateGroups)
+{
+    // Arrange two rows of overlapping cubes far away from each other
+    std::vector<TopoShape> cubes;
+    TopTools_ListOfShape shapes;
+    for (int i = 0; i < 5; ++i) {
+        cubes.emplace_back(BRepPrimAPI_MakeBox(gp_Pnt(i * 0.5, 0, 0), 1, 1, 1).Solid(), i + 1L);
+        cubes.emplace_back(BRepPrimAPI_MakeBox(gp_Pnt(i * 0.5, 10, 0), 1, 1, 1).Solid(), i + 11L);
+    }
+    for (const auto& cube : cubes) {
+        shapes.Append(cube.getShape());
+    }
+    FCBRepAlgoAPI_ParallelFuse mkFuse;
+    mkFuse.SetShapes(shapes);
+    mkFuse.Build();
+    ASSERT_TRUE(mkFuse.IsDone());
+    TopTools_ListOfShape tools(shapes);
+    TopTools_ListOfShape arguments;
+    arguments.Append(tools.First());
+    tools.RemoveFirst();
+    BRepAlgoAPI_Fuse serialFuse;
+    serialFuse.SetArguments(arguments);
+    serialFuse.SetTools(tools);
+    serialFuse.SetNonDestructive(Standard_True);
+    serialFuse.Build();
+    TopoShape expected(0L);
+    expected.makeShapeWithElementMap(serialFuse.Shape(), MapperMaker(serialFuse), cubes, Part::OpCodes::Fuse);
+    auto names = [](const TopoShape& shape) {
+        std::vector<std::string> result;
+        for (const auto& element : shape.getElementMap()) {
+            result.push_back(element.name.toString());
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+    // Act
+    TopoShape result(0L);
+    result.makeElementBoolean(Part::OpCodes::Fuse, cubes);
+    // Assert the rows are fused independently with the names of a single fuse
+    EXPECT_EQ(mkFuse.NbGroups(), 2);
+    EXPECT_EQ(result.countSubShapes(TopAbs_SOLID), 2);
+    EXPECT_FLOAT_EQ(getVolume(result.getShape()), 6);
+    EXPECT_EQ(names(result), names(expected));
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementDraft)
 {  // Draft as in Draft Angle or sloped sides for removing shapes from a mold.
     // Arrange
@@ -2509,6 +2557,31 @@ TEST_F(TopoShapeExpansionTest, makeElementSlices)
                                                              // TopoNaming logics
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementSlicesOfSeparateSolids)
+{
+    // Arrange
+    TopoShape cube1 {BRepPrimAPI_MakeBox(gp_Pnt(0, 0, 0), 1, 1, 1).Solid(), 1L};
+    TopoShape cube2 {BRepPrimAPI_MakeBox(gp_Pnt(3, 0, 0), 1, 1, 1).Solid(), 2L};
+    TopoShape compound;
+    compound.makeElementCompound({cube1, cube2});
+    Base::Vector3d direction {1.0, 0.0, 0.0};
+    std::vector<double> distances {0.5, 2.0, 3.25, 3.75};
+    // Act
+    auto result = TopoShape().makeElementSlices(compound, direction, distances);
+    // Assert the plane between the cubes doesn't create a wire
+    auto wires = result.getSubTopoShapes(TopAbs_WIRE);
+    ASSERT_EQ(wires.size(), 3);
+    EXPECT_FLOAT_EQ(getLength(result.getShape()), 12);
+    // Assert that the wires are in the order of the distances
+    std::vector<double> hits {0.5, 3.25, 3.75};
+    for (std::size_t i = 0; i < hits.size(); ++i) {
+        EXPECT_FLOAT_EQ(getLength(wires[i].getShape()), 4);
+        for (auto& vertex : wires[i].getSubShapes(TopAbs_VERTEX)) {
+            EXPECT_DOUBLE_EQ(BRep_Tool::Pnt(TopoDS::Vertex(vertex)).X(), hits[i]);
+        }
+    }
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementMirror)
 {
     // Arrange
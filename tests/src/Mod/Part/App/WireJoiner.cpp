@@ -382,6 +382,35 @@ TEST_F(WireJoinerTest, setSplitEdges)
     EXPECT_EQ(wireSplitEdges.getSubTopoShapes(TopAbs_EDGE).size(), 4);
 }
 
+TEST_F(WireJoinerTest, splitEdgesOfGrid)
+{
+    // Arrange
+
+    // Four horizontal and four vertical lines crossing each other, each line overhangs the grid a
+    // little so that all the intersections are found by splitting the edges
+    std::vector<TopoDS_Shape> edges;
+    for (int i = 0; i < 4; ++i) {
+        double pos = i;
+        gp_Pnt left(-0.1, pos, 0.0), right(3.1, pos, 0.0);
+        gp_Pnt bottom(pos, -0.1, 0.0), top(pos, 3.1, 0.0);
+        edges.push_back(BRepBuilderAPI_MakeEdge(left, right).Edge());
+        edges.push_back(BRepBuilderAPI_MakeEdge(bottom, top).Edge());
+    }
+
+    auto wj {WireJoiner()};
+    auto result {TopoShape(1)};
+
+    // Act
+
+    wj.addShape(edges);
+    wj.getResultWires(result);
+
+    // Assert
+
+    // Each of the 9 cells of the grid is a tight bound wire
+    EXPECT_EQ(result.getSubTopoShapes(TopAbs_WIRE).size(), 9);
+}
+
 TEST_F(WireJoinerTest, setMergeEdges)
 {
     // Arrange
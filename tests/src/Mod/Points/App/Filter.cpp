@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <src/App/InitApplication.h>
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/PropertyStandard.h>
+#include <Base/Interpreter.h>
+#include <Mod/Points/App/Filter.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class FilterTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+        Base::Interpreter().runString("import Points");
+    }
+
+    void SetUp() override
+    {
+        docName = App::GetApplication().getUniqueDocumentName("test");
+        doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+
+        // a grid of 10 x 10 points with a spacing of 0.1 in the xy plane
+        Points::PointKernel kernel;
+        for (int i = 0; i < 10; i++) {
+            for (int j = 0; j < 10; j++) {
+                kernel.push_back(Base::Vector3d(0.1 * i, 0.1 * j, 0.0));
+            }
+        }
+        source = doc->addObject<Points::Feature>("Source");
+        source->Points.setValue(kernel);
+        filter = doc->addObject<Points::Filter>("Filter");
+        filter->Source.setValue(source);
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(docName.c_str());
+    }
+
+    std::string docName;
+    App::Document* doc {};
+    Points::Feature* source {};
+    Points::Filter* filter {};
+};
+
+TEST_F(FilterTest, TestVoxelGrid)
+{
+    filter->VoxelSize.setValue(0.5);
+    doc->recompute();
+
+    EXPECT_TRUE(filter->isValid());
+    EXPECT_EQ(filter->Points.getValue().size(), 4);
+}
+
+TEST_F(FilterTest, TestZeroVoxelSize)
+{
+    filter->VoxelSize.setValue(0.0);
+    doc->recompute();
+
+    EXPECT_TRUE(filter->isError());
+    EXPECT_EQ(filter->Points.getValue().size(), 0);
+}
+
+TEST_F(FilterTest, TestFilterColors)
+{
+    auto colors = dynamic_cast<App::PropertyColorList*>(
+        source->addDynamicProperty("App::PropertyColorList", "Color")
+    );
+    ASSERT_NE(colors, nullptr);
+    colors->setValues(std::vector<Base::Color>(100, Base::Color(1.0F, 0.0F, 0.0F)));
+
+    filter->VoxelSize.setValue(0.5);
+    doc->recompute();
+
+    auto selected = dynamic_cast<App::PropertyColorList*>(filter->getPropertyByName("Color"));
+    ASSERT_NE(selected, nullptr);
+    EXPECT_EQ(selected->getSize(), 4);
+}
+
+TEST_F(FilterTest, TestPythonVoxelFilter)
+{
+    Base::Interpreter().runString("pts = Points.Points([(0, 0, 0), (0.1, 0, 0), (1, 0, 0)])");
+    Py::Object result = Base::Interpreter().runStringObject("pts.voxelFilter(0.5)");
+
+    Base::PyGILStateLocker lock;
+    ASSERT_TRUE(result.isList());
+    EXPECT_EQ(Py::List(result).size(), 2);
+}
+
+TEST_F(FilterTest, TestPythonZeroVoxelSize)
+{
+    Base::Interpreter().runString("pts = Points.Points([(0, 0, 0), (1, 0, 0)])");
+    try {
+        Base::Interpreter().runString("pts.voxelFilter(0.0)");
+        FAIL() << "voxelFilter accepted a voxel size of zero";
+    }
+    catch (const Base::PyException& e) {
+        EXPECT_EQ(e.getPyExceptionType(), PyExc_ValueError);
+    }
+}
+
+TEST_F(FilterTest, TestPythonOutlierFilters)
+{
+    Base::Interpreter().runString(
+        "pts = Points.Points([(0, 0, 0), (0.1, 0, 0), (0, 0.1, 0), (0.1, 0.1, 0), (5, 5, 5)])"
+    );
+    Py::Object radius = Base::Interpreter().runStringObject("pts.radiusOutlierFilter(0.5, 2)");
+    Py::Object statistical = Base::Interpreter().runStringObject(
+        "pts.statisticalOutlierFilter(2, 1.0)"
+    );
+
+    Base::PyGILStateLocker lock;
+    Py::List expected;
+    for (int i = 0; i < 4; i++) {
+        expected.append(Py::Long(i));
+    }
+    EXPECT_TRUE(radius == expected);
+    EXPECT_TRUE(statistical == expected);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
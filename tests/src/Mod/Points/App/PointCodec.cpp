@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <Base/Exception.h>
+#include <Base/Stream.h>
+#include <Mod/Points/App/PointCodec.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointCodecTest: public ::testing::Test
+{
+protected:
+    static std::vector<Base::Vector3f> makePoints(int num)
+    {
+        std::vector<Base::Vector3f> points;
+        points.reserve(num);
+        for (int i = 0; i < num; i++) {
+            float t = float(i) * 0.01F;
+            points.emplace_back(std::cos(t) * 10.0F, std::sin(t) * 10.0F, t);
+        }
+        return points;
+    }
+
+    template<typename T>
+    static std::vector<T> roundTrip(const Points::PointCodec& codec, const std::vector<T>& values)
+    {
+        std::stringstream buffer;
+        Base::OutputStream out(buffer);
+        codec.write(out, values);
+
+        Base::InputStream in(buffer);
+        uint32_t magic = 0;
+        in >> magic;
+        EXPECT_EQ(magic, Points::PointCodec::magic());
+
+        std::vector<T> result;
+        Points::PointCodec().read(in, result);
+        return result;
+    }
+};
+
+TEST_F(PointCodecTest, TestEmpty)
+{
+    std::vector<Base::Vector3f> points;
+    EXPECT_TRUE(roundTrip(Points::PointCodec(), points).empty());
+}
+
+TEST_F(PointCodecTest, TestLossless)
+{
+    // use a small chunk size to cover several chunks
+    Points::PointCodec codec(0, 1000);
+    auto points = makePoints(5500);
+    auto result = roundTrip(codec, points);
+    ASSERT_EQ(result.size(), points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(result[i], points[i]);
+    }
+}
+
+TEST_F(PointCodecTest, TestQuantized)
+{
+    Points::PointCodec codec(16, 1000);
+    auto points = makePoints(5500);
+    auto result = roundTrip(codec, points);
+    ASSERT_EQ(result.size(), points.size());
+    // the bounding range is 20 in x and y, so the error must be below 20 / 2^16
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_LE(Base::Distance(result[i], points[i]), 0.001F);
+    }
+}
+
+TEST_F(PointCodecTest, TestQuantizedNaN)
+{
+    // quantization falls back to lossless coding for non-finite values
+    Points::PointCodec codec(16);
+    std::vector<float> values {0.5F, std::numeric_limits<float>::quiet_NaN(), -2.25F, 1.0e-7F};
+    auto result = roundTrip(codec, values);
+    ASSERT_EQ(result.size(), values.size());
+    EXPECT_EQ(result[0], values[0]);
+    EXPECT_TRUE(std::isnan(result[1]));
+    EXPECT_EQ(result[2], values[2]);
+    EXPECT_EQ(result[3], values[3]);
+}
+
+TEST_F(PointCodecTest, TestTruncated)
+{
+    std::stringstream buffer;
+    Base::OutputStream out(buffer);
+    Points::PointCodec(0, 1000).write(out, makePoints(2500));
+    std::string data = buffer.str();
+
+    // cut off the data inside the header and inside the last chunk
+    for (std::size_t size : {std::size_t(12), data.size() - 10}) {
+        std::stringstream truncated(data.substr(0, size));
+        Base::InputStream in(truncated);
+        uint32_t magic = 0;
+        in >> magic;
+        std::vector<Base::Vector3f> result;
+        EXPECT_THROW(Points::PointCodec().read(in, result), Base::BadFormatError);
+    }
+}
+
+TEST_F(PointCodecTest, TestCountExceedsData)
+{
+    // headers of a corrupted file with a huge number of points must not allocate memory for them
+    auto makeHeader = [](std::stringstream& buffer, uint64_t count, uint32_t chunkSize) {
+        Base::OutputStream out(buffer);
+        uint32_t numChunks = uint32_t((count + chunkSize - 1) / chunkSize);
+        out << uint32_t(1) << uint32_t(3) << uint32_t(0) << count << chunkSize << numChunks;
+    };
+
+    {
+        std::stringstream buffer;
+        makeHeader(buffer, uint64_t(1) << 40, 1U << 20);
+        Base::InputStream in(buffer);
+        std::vector<Base::Vector3f> result;
+        EXPECT_THROW(Points::PointCodec().read(in, result), Base::BadFormatError);
+        EXPECT_TRUE(result.empty());
+    }
+    {
+        std::stringstream buffer;
+        makeHeader(buffer, 1000000000, 1000000000);
+        Base::OutputStream out(buffer);
+        out << uint32_t(10);
+        out.write("0123456789", 10);
+        Base::InputStream in(buffer);
+        std::vector<Base::Vector3f> result;
+        EXPECT_THROW(Points::PointCodec().read(in, result), Base::BadFormatError);
+        EXPECT_TRUE(result.empty());
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
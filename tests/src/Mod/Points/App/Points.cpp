@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include <gtest/gtest.h>
+#include <E57Format.h>
 #include <Base/FileInfo.h>
+#include <Base/Stream.h>
 #include <Mod/Points/App/Points.h>
 #include <Mod/Points/App/PointsAlgos.h>
 
@@ -62,6 +64,38 @@ protected:
         return col;
     }
 
+    // more points than fit into one block of the readers
+    static std::vector<Base::Vector3f> getManyPoints()
+    {
+        const int count = 150000;
+        std::vector<Base::Vector3f> points;
+        points.reserve(count);
+        for (int i = 0; i < count; i++) {
+            points.emplace_back(float(i % 100), float(i / 100 % 100), float(i / 10000));
+        }
+        return points;
+    }
+    static std::vector<float> getManyIntensities()
+    {
+        std::vector<float> intensity(getManyPoints().size());
+        for (std::size_t i = 0; i < intensity.size(); i++) {
+            intensity[i] = float(i);
+        }
+        return intensity;
+    }
+    // checks the points at the block borders of the readers
+    static void checkManyPoints(const Points::Reader& reader)
+    {
+        std::vector<Base::Vector3f> points = getManyPoints();
+        const auto& result = reader.getPoints().getBasicPoints();
+        ASSERT_EQ(result.size(), points.size());
+        ASSERT_EQ(reader.getIntensities().size(), points.size());
+        for (std::size_t index : {0, 1023, 1024, 65535, 65536, 131072, 149999}) {
+            EXPECT_EQ(result[index], points[index]);
+            EXPECT_FLOAT_EQ(reader.getIntensities()[index], float(index));
+        }
+    }
+
 private:
     Points::PointKernel kernel;
     Base::FileInfo tmp;
@@ -218,6 +252,31 @@ TEST_F(PointsTest, TestPCDWithProperties)
     EXPECT_EQ(reader.getHeight(), 1);
 }
 
+TEST_F(PointsTest, TestPLYVoxelSize)
+{
+    std::string name = getFileName();
+    Points::PlyWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.setNormals(getNormals());
+    writer.write(name);
+
+    // all points of the unit cube lie in the same voxel
+    Points::PlyReader reader;
+    reader.setVoxelSize(2.0);
+    reader.read(name);
+
+    EXPECT_EQ(reader.getPoints().size(), 1);
+    EXPECT_EQ(reader.getIntensities().size(), 1);
+    EXPECT_EQ(reader.getNormals().size(), 1);
+    EXPECT_EQ(reader.getWidth(), 1);
+    EXPECT_EQ(reader.getHeight(), 1);
+
+    // each point gets its own voxel
+    reader.setVoxelSize(0.5);
+    reader.read(name);
+    EXPECT_EQ(reader.getPoints().size(), 8);
+}
+
 TEST_F(PointsTest, TestPCDStructured)
 {
     std::string name = getFileName();
@@ -240,4 +299,127 @@ TEST_F(PointsTest, TestPCDStructured)
     EXPECT_EQ(reader.getWidth(), 4);
     EXPECT_EQ(reader.getHeight(), 2);
 }
+
+TEST_F(PointsTest, TestPLYMultipleBlocks)
+{
+    std::string name = getFileName();
+    Points::PointKernel kernel;
+    kernel.setBasicPoints(getManyPoints());
+    Points::PlyWriter writer(kernel);
+    writer.setIntensities(getManyIntensities());
+    writer.write(name);
+
+    Points::PlyReader reader;
+    reader.read(name);
+    checkManyPoints(reader);
+}
+
+TEST_F(PointsTest, TestBinaryPLYMultipleBlocks)
+{
+    std::string name = getFileName();
+    std::vector<Base::Vector3f> points = getManyPoints();
+    {
+        Base::FileInfo fi(name);
+        Base::ofstream str(fi, std::ios::out | std::ios::binary);
+        str << "ply\n"
+            << "format binary_big_endian 1.0\n"
+            << "element vertex " << points.size() << "\n"
+            << "property float x\n"
+            << "property float y\n"
+            << "property float z\n"
+            << "property float intensity\n"
+            << "end_header\n";
+        Base::OutputStream out(str);
+        out.setByteOrder(Base::Stream::BigEndian);
+        for (std::size_t i = 0; i < points.size(); i++) {
+            out << points[i].x << points[i].y << points[i].z << float(i);
+        }
+    }
+
+    Points::PlyReader reader;
+    reader.read(name);
+    checkManyPoints(reader);
+}
+
+TEST_F(PointsTest, TestPCDMultipleBlocks)
+{
+    std::string name = getFileName();
+    Points::PointKernel kernel;
+    kernel.setBasicPoints(getManyPoints());
+    Points::PcdWriter writer(kernel);
+    writer.setIntensities(getManyIntensities());
+    writer.write(name);
+
+    Points::PcdReader reader;
+    reader.read(name);
+    checkManyPoints(reader);
+}
+
+TEST_F(PointsTest, TestE57MultipleBlocks)
+{
+    // two scans where the second one is moved by its pose
+    std::string name = getFileName() + ".e57";
+    std::vector<Base::Vector3f> points = getManyPoints();
+    points.resize(5000);
+    {
+        e57::ImageFile imf(name, "w");
+        e57::StructureNode root = imf.root();
+        root.set("formatName", e57::StringNode(imf, "ASTM E57 3D Imaging Data File"));
+        e57::VectorNode data3D(imf, true);
+        root.set("data3D", data3D);
+
+        for (int scan = 0; scan < 2; scan++) {
+            e57::StructureNode scanNode(imf);
+            if (scan > 0) {
+                e57::StructureNode pose(imf);
+                e57::StructureNode translation(imf);
+                translation.set("x", e57::FloatNode(imf, 10.0));
+                translation.set("y", e57::FloatNode(imf, 0.0));
+                translation.set("z", e57::FloatNode(imf, 0.0));
+                pose.set("translation", translation);
+                scanNode.set("pose", pose);
+            }
+
+            e57::StructureNode proto(imf);
+            proto.set("cartesianX", e57::FloatNode(imf));
+            proto.set("cartesianY", e57::FloatNode(imf));
+            proto.set("cartesianZ", e57::FloatNode(imf));
+            proto.set("intensity", e57::FloatNode(imf));
+            e57::VectorNode codecs(imf, true);
+            e57::CompressedVectorNode cvn(imf, proto, codecs);
+            scanNode.set("points", cvn);
+            data3D.append(scanNode);
+
+            std::vector<double> x, y, z, intensity;
+            for (std::size_t i = 0; i < points.size(); i++) {
+                x.push_back(points[i].x);
+                y.push_back(points[i].y);
+                z.push_back(points[i].z);
+                intensity.push_back(double(i));
+            }
+            std::vector<e57::SourceDestBuffer> sdb;
+            sdb.emplace_back(imf, "cartesianX", x.data(), x.size(), true, true);
+            sdb.emplace_back(imf, "cartesianY", y.data(), y.size(), true, true);
+            sdb.emplace_back(imf, "cartesianZ", z.data(), z.size(), true, true);
+            sdb.emplace_back(imf, "intensity", intensity.data(), intensity.size(), true, true);
+            e57::CompressedVectorWriter cvw = cvn.writer(sdb);
+            cvw.write(points.size());
+            cvw.close();
+        }
+        imf.close();
+    }
+
+    Points::E57Reader reader(false, false, 0.0);
+    reader.read(name);
+    Base::FileInfo(name).deleteFile();
+
+    const auto& result = reader.getPoints().getBasicPoints();
+    ASSERT_EQ(result.size(), 2 * points.size());
+    ASSERT_EQ(reader.getIntensities().size(), 2 * points.size());
+    for (std::size_t index : {0, 1023, 1024, 4999}) {
+        EXPECT_EQ(result[index], points[index]);
+        EXPECT_EQ(result[index + 5000], points[index] + Base::Vector3f(10.0F, 0.0F, 0.0F));
+        EXPECT_FLOAT_EQ(reader.getIntensities()[index + 5000], float(index));
+    }
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -2,7 +2,9 @@
 
 #include "gtest/gtest.h"
 #include <src/App/InitApplication.h>
+#include <App/PropertyStandard.h>
 #include <Mod/Points/App/PointsFeature.h>
+#include <Mod/Points/App/Tools.h>
 
 class PointsFeatureTest: public ::testing::Test
 {
@@ -35,4 +37,35 @@ TEST_F(PointsFeatureTest, getComplexElementTypes)
 
     EXPECT_EQ(types.size(), 0);
 }
+
+TEST_F(PointsFeatureTest, selectPropertyRemovesStaleValues)
+{
+    using ColorList = App::PropertyColorList;
+    Points::Feature source;
+    Points::Feature target;
+    auto colors = dynamic_cast<ColorList*>(
+        source.addDynamicProperty(ColorList::getClassTypeId().getName(), "Color")
+    );
+    ASSERT_NE(colors, nullptr);
+    colors->setValues({Base::Color(1.0F, 0.0F, 0.0F), Base::Color(0.0F, 1.0F, 0.0F)});
+
+    std::vector<unsigned long> indices {1};
+    EXPECT_TRUE(Points::selectProperty<ColorList>(&target, &source, "Color", indices));
+    auto selected = dynamic_cast<ColorList*>(target.getPropertyByName("Color"));
+    ASSERT_NE(selected, nullptr);
+    EXPECT_EQ(selected->getSize(), 1);
+
+    // the source has no value for the index
+    indices = {2};
+    EXPECT_FALSE(Points::selectProperty<ColorList>(&target, &source, "Color", indices));
+    EXPECT_EQ(target.getPropertyByName("Color"), nullptr);
+
+    // the source has no colors
+    indices = {1};
+    EXPECT_TRUE(Points::selectProperty<ColorList>(&target, &source, "Color", indices));
+    source.removeDynamicProperty("Color");
+    EXPECT_FALSE(Points::selectProperty<ColorList>(&target, &source, "Color", indices));
+    EXPECT_EQ(target.getPropertyByName("Color"), nullptr);
+}
+
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <random>
+#include <Base/Exception.h>
+#include <Mod/Points/App/PointsFilter.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsFilterTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a dense cloud on a plane and a few points far away from it
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(0.0F, 10.0F);
+        std::normal_distribution<float> noise(0.5F, 0.01F);
+        for (int i = 0; i < 10000; i++) {
+            points.emplace_back(dist(gen), dist(gen), noise(gen));
+        }
+        points.emplace_back(5.0F, 5.0F, 5.0F);
+        points.emplace_back(-5.0F, 2.0F, 1.0F);
+        points.emplace_back(20.0F, 20.0F, -3.0F);
+    }
+
+    bool isOutlier(unsigned long index) const
+    {
+        return index >= 10000;
+    }
+
+    std::vector<Base::Vector3f> points;
+};
+
+TEST_F(PointsFilterTest, TestVoxelGrid)
+{
+    Points::PointsFilter filter(points);
+    std::vector<unsigned long> indices = filter.VoxelGrid(1.0);
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+
+    // 100 voxels on the plane and one per outlier
+    EXPECT_EQ(indices.size(), 103);
+
+    // no two kept points share a voxel
+    std::vector<std::tuple<int, int, int>> voxels;
+    for (unsigned long index : indices) {
+        const Base::Vector3f& pnt = points[index];
+        voxels.emplace_back(int(std::floor(pnt.x)), int(std::floor(pnt.y)), int(std::floor(pnt.z)));
+    }
+    std::sort(voxels.begin(), voxels.end());
+    EXPECT_EQ(std::adjacent_find(voxels.begin(), voxels.end()), voxels.end());
+}
+
+TEST_F(PointsFilterTest, TestVoxelGridInvalidSize)
+{
+    Points::PointsFilter filter(points);
+    EXPECT_THROW(filter.VoxelGrid(0.0), Base::ValueError);
+    EXPECT_THROW(filter.VoxelGrid(-1.0), Base::ValueError);
+}
+
+TEST_F(PointsFilterTest, TestRadiusOutliers)
+{
+    Points::PointsFilter filter(points);
+    std::vector<unsigned long> indices = filter.RadiusOutliers(0.5, 3);
+    EXPECT_TRUE(std::none_of(indices.begin(), indices.end(), [this](unsigned long index) {
+        return isOutlier(index);
+    }));
+    EXPECT_GT(indices.size(), 9900);
+}
+
+TEST_F(PointsFilterTest, TestStatisticalOutliers)
+{
+    Points::PointsFilter filter(points);
+    std::vector<unsigned long> indices = filter.StatisticalOutliers(8, 3.0);
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+    EXPECT_TRUE(std::none_of(indices.begin(), indices.end(), [this](unsigned long index) {
+        return isOutlier(index);
+    }));
+    EXPECT_GT(indices.size(), 9900);
+}
+
+TEST_F(PointsFilterTest, TestNormalSpaceSampling)
+{
+    // most normals point upwards, a few sideways
+    std::vector<Base::Vector3f> normals(points.size(), Base::Vector3f(0.0F, 0.0F, 1.0F));
+    for (std::size_t i = 0; i < 100; i++) {
+        normals[i * 7] = Base::Vector3f(1.0F, 0.0F, 0.0F);
+    }
+
+    Points::PointsFilter filter(points);
+    std::vector<unsigned long> indices = filter.NormalSpaceSampling(normals, 200);
+    EXPECT_EQ(indices.size(), 200);
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+    EXPECT_EQ(std::adjacent_find(indices.begin(), indices.end()), indices.end());
+
+    // the rare direction is sampled as often as the common one
+    auto sideways = std::count_if(indices.begin(), indices.end(), [&normals](unsigned long index) {
+        return normals[index].x > 0.5F;
+    });
+    EXPECT_EQ(sideways, 100);
+}
+
+TEST_F(PointsFilterTest, TestSelect)
+{
+    std::vector<int> values {10, 11, 12, 13};
+    EXPECT_EQ(Points::PointsFilter::Select(values, {0, 2, 3}), (std::vector<int> {10, 12, 13}));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <Mod/Points/App/PointsOctree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsOctreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-10.0F, 10.0F);
+        for (int i = 0; i < 20000; i++) {
+            points.emplace_back(dist(gen), dist(gen), dist(gen));
+        }
+        // some duplicates and an invalid point
+        points.push_back(points[5]);
+        points.push_back(points[5]);
+        points.emplace_back(std::numeric_limits<float>::quiet_NaN(), 0.0F, 0.0F);
+        octree.Build(points);
+    }
+
+    std::vector<Base::Vector3f> points;
+    Points::PointsOctree octree;
+};
+
+TEST_F(PointsOctreeTest, TestBuild)
+{
+    EXPECT_EQ(octree.Size(), points.size() - 1);
+    EXPECT_GT(octree.CountNodes(), 1);
+    EXPECT_GT(octree.GetDepth(), 1);
+
+    Points::PointsOctree empty;
+    empty.Build({});
+    EXPECT_TRUE(empty.IsEmpty());
+    std::vector<unsigned long> indices;
+    EXPECT_EQ(empty.Sample(points, 1.0F, indices), 0);
+}
+
+TEST_F(PointsOctreeTest, TestInSide)
+{
+    Base::BoundBox3f box(-2.0F, -3.0F, -1.0F, 4.0F, 1.0F, 2.5F);
+    std::vector<unsigned long> indices;
+    octree.InSide(points, box, indices);
+    std::sort(indices.begin(), indices.end());
+
+    // the invalid point is the last one and not indexed
+    std::vector<unsigned long> expected;
+    for (std::size_t i = 0; i + 1 < points.size(); i++) {
+        if (box.IsInBox(points[i])) {
+            expected.push_back(i);
+        }
+    }
+    EXPECT_EQ(indices, expected);
+}
+
+TEST_F(PointsOctreeTest, TestInSphere)
+{
+    Base::Vector3f center(1.0F, 2.0F, -3.0F);
+    std::vector<unsigned long> indices;
+    octree.InSphere(points, center, 2.5F, indices);
+    std::sort(indices.begin(), indices.end());
+
+    std::vector<unsigned long> expected;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (Base::DistanceP2(points[i], center) <= 2.5F * 2.5F) {
+            expected.push_back(i);
+        }
+    }
+    EXPECT_EQ(indices, expected);
+}
+
+TEST_F(PointsOctreeTest, TestFindNearest)
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> dist(-12.0F, 12.0F);
+    for (int i = 0; i < 100; i++) {
+        Base::Vector3f pnt(dist(gen), dist(gen), dist(gen));
+        unsigned long expected = 0;
+        float minDist = std::numeric_limits<float>::max();
+        for (std::size_t j = 0; j < points.size(); j++) {
+            float d = Base::DistanceP2(points[j], pnt);
+            if (d < minDist) {
+                minDist = d;
+                expected = j;
+            }
+        }
+
+        unsigned long index = 0;
+        float distance = 0.0F;
+        ASSERT_TRUE(octree.FindNearest(points, pnt, 100.0F, index, distance));
+        EXPECT_EQ(index, expected);
+        EXPECT_FLOAT_EQ(distance, std::sqrt(minDist));
+    }
+
+    unsigned long index = 0;
+    float distance = 0.0F;
+    EXPECT_FALSE(octree.FindNearest(points, Base::Vector3f(50.0F, 0.0F, 0.0F), 1.0F, index, distance));
+}
+
+TEST_F(PointsOctreeTest, TestFindNearestK)
+{
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<float> dist(-12.0F, 12.0F);
+    for (int i = 0; i < 50; i++) {
+        Base::Vector3f pnt(dist(gen), dist(gen), dist(gen));
+        std::vector<std::pair<float, unsigned long>> expected;
+        for (std::size_t j = 0; j + 1 < points.size(); j++) {
+            expected.emplace_back(Base::DistanceP2(points[j], pnt), j);
+        }
+        std::partial_sort(expected.begin(), expected.begin() + 10, expected.end());
+
+        std::vector<unsigned long> indices;
+        std::vector<float> dists;
+        ASSERT_EQ(octree.FindNearest(points, pnt, 10, 100.0F, indices, dists), 10);
+        for (std::size_t j = 0; j < 10; j++) {
+            EXPECT_EQ(indices[j], expected[j].second);
+            EXPECT_FLOAT_EQ(dists[j], std::sqrt(expected[j].first));
+        }
+    }
+
+    // the duplicates are all found
+    std::vector<unsigned long> indices;
+    std::vector<float> dists;
+    octree.FindNearest(points, points[5], 3, 100.0F, indices, dists);
+    EXPECT_EQ(indices, (std::vector<unsigned long> {5, 20000, 20001}));
+}
+
+TEST_F(PointsOctreeTest, TestSample)
+{
+    std::vector<unsigned long> all;
+    octree.Sample(points, 0.0F, all);
+    EXPECT_EQ(all.size(), octree.Size());
+
+    std::vector<unsigned long> coarse;
+    octree.Sample(points, 2.0F, coarse);
+    EXPECT_FALSE(coarse.empty());
+    EXPECT_LT(coarse.size(), all.size() / 2);
+
+    // a coarse sample must still cover the whole cloud
+    for (int i = 0; i < 100; i++) {
+        const Base::Vector3f& pnt = points[i * 101];
+        float minDist = std::numeric_limits<float>::max();
+        for (unsigned long index : coarse) {
+            minDist = std::min(minDist, Base::Distance(points[index], pnt));
+        }
+        EXPECT_LT(minDist, 2.0F * std::sqrt(3.0F));
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <gp_Pnt.hxx>
+#include <Mod/ReverseEngineering/App/ApproxSurface.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class ApproxSurfaceTest: public ::testing::Test
+{
+protected:
+    // samples z = f(x, y) on a grid of size x size points over [-1, 1] x [-1, 1]
+    static TColgp_Array1OfPnt sample(int size, const std::function<double(double, double)>& func)
+    {
+        TColgp_Array1OfPnt points(0, size * size - 1);
+        int index = 0;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                double x = -1.0 + 2.0 * i / (size - 1);
+                double y = -1.0 + 2.0 * j / (size - 1);
+                points(index++) = gp_Pnt(x, y, func(x, y));
+            }
+        }
+        return points;
+    }
+
+    static double maxDistance(
+        const TColgp_Array1OfPnt& points,
+        const Handle(Geom_BSplineSurface) & surf
+    )
+    {
+        double maxDist = 0.0;
+        for (int i = points.Lower(); i <= points.Upper(); i++) {
+            GeomAPI_ProjectPointOnSurf proj(points(i), surf);
+            maxDist = std::max(maxDist, proj.LowerDistance());
+        }
+        return maxDist;
+    }
+
+    static double paraboloid(double x, double y)
+    {
+        return x * x + y * y;
+    }
+};
+
+TEST_F(ApproxSurfaceTest, TestFitParaboloid)
+{
+    // A paraboloid is a polynomial surface of degree 2 and thus exactly representable by a
+    // bicubic B-spline when the parameters are linear in x and y
+    TColgp_Array1OfPnt points = sample(21, paraboloid);
+    Reen::BSplineParameterCorrection pc(4, 4, 6, 6);
+    pc.SetUV(Base::Vector3d(1, 0, 0), Base::Vector3d(0, 1, 0));
+    Handle(Geom_BSplineSurface) surf = pc.CreateSurface(points, 0, false);
+
+    ASSERT_FALSE(surf.IsNull());
+    EXPECT_EQ(surf->NbUPoles(), 6);
+    EXPECT_EQ(surf->NbVPoles(), 6);
+    EXPECT_LT(maxDistance(points, surf), 1e-4);
+}
+
+TEST_F(ApproxSurfaceTest, TestParameterCorrection)
+{
+    TColgp_Array1OfPnt points = sample(21, paraboloid);
+    Reen::BSplineParameterCorrection pc(4, 4, 6, 6);
+    pc.SetUV(Base::Vector3d(1, 0, 0), Base::Vector3d(0, 1, 0));
+    Handle(Geom_BSplineSurface) surf = pc.CreateSurface(points, 5, true);
+
+    ASSERT_FALSE(surf.IsNull());
+    EXPECT_LT(maxDistance(points, surf), 1e-3);
+}
+
+TEST_F(ApproxSurfaceTest, TestSmoothPlane)
+{
+    // The coordinates are solved independently so that the smoothing terms can't move the
+    // poles out of the plane of the points
+    TColgp_Array1OfPnt points = sample(11, [](double, double) {
+        return 0.0;
+    });
+    Reen::BSplineParameterCorrection pc(4, 4, 6, 6);
+    pc.SetUV(Base::Vector3d(1, 0, 0), Base::Vector3d(0, 1, 0));
+    pc.EnableSmoothing(true, 0.5);
+    Handle(Geom_BSplineSurface) surf = pc.CreateSurface(points, 0, false);
+
+    ASSERT_FALSE(surf.IsNull());
+    for (int i = 1; i <= surf->NbUPoles(); i++) {
+        for (int j = 1; j <= surf->NbVPoles(); j++) {
+            EXPECT_NEAR(surf->Pole(i, j).Z(), 0.0, 1e-9);
+        }
+    }
+}
+
+TEST_F(ApproxSurfaceTest, TestTooFewPoints)
+{
+    TColgp_Array1OfPnt points = sample(5, paraboloid);
+    Reen::BSplineParameterCorrection pc(4, 4, 6, 6);
+    Handle(Geom_BSplineSurface) surf = pc.CreateSurface(points, 0, false);
+
+    EXPECT_TRUE(surf.IsNull());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <Mod/Points/App/Points.h>
+#include <Mod/ReverseEngineering/App/Segmentation.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class NormalEstimationTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // evenly distributed points on a sphere around the origin
+        const int numPoints = 2000;
+        const double radius = 10.0;
+        const double golden = std::numbers::pi * (3.0 - std::sqrt(5.0));
+        for (int i = 0; i < numPoints; i++) {
+            double z = 1.0 - 2.0 * (i + 0.5) / numPoints;
+            double r = std::sqrt(1.0 - z * z);
+            double phi = golden * i;
+            sphere.push_back(
+                Base::Vector3d(radius * r * std::cos(phi), radius * r * std::sin(phi), radius * z)
+            );
+        }
+    }
+
+    Points::PointKernel sphere;
+};
+
+TEST_F(NormalEstimationTest, TestSphere)
+{
+    Reen::NormalEstimation estimation(sphere);
+    estimation.setKSearch(10);
+    std::vector<Base::Vector3d> normals;
+    estimation.perform(normals);
+
+    ASSERT_EQ(normals.size(), sphere.size());
+    for (std::size_t i = 0; i < sphere.size(); i++) {
+        Base::Vector3d dir = sphere.getPoint(i);
+        dir.Normalize();
+        // the orientation starts with +z at the top and is propagated outwards
+        EXPECT_GT(normals[i] * dir, 0.99) << "point " << i;
+    }
+}
+
+TEST_F(NormalEstimationTest, TestSphereUnoriented)
+{
+    Reen::NormalEstimation estimation(sphere);
+    estimation.setKSearch(10);
+    estimation.setOrientNormals(false);
+    std::vector<Base::Vector3d> normals;
+    estimation.perform(normals);
+
+    ASSERT_EQ(normals.size(), sphere.size());
+    for (std::size_t i = 0; i < sphere.size(); i++) {
+        Base::Vector3d dir = sphere.getPoint(i);
+        dir.Normalize();
+        EXPECT_GT(std::fabs(normals[i] * dir), 0.99) << "point " << i;
+    }
+}
+
+TEST_F(NormalEstimationTest, TestSearchRadius)
+{
+    Reen::NormalEstimation estimation(sphere);
+    estimation.setSearchRadius(1.5);
+    std::vector<Base::Vector3d> normals;
+    estimation.perform(normals);
+
+    ASSERT_EQ(normals.size(), sphere.size());
+    for (std::size_t i = 0; i < sphere.size(); i++) {
+        Base::Vector3d dir = sphere.getPoint(i);
+        dir.Normalize();
+        EXPECT_GT(normals[i] * dir, 0.99) << "point " << i;
+    }
+}
+
+TEST_F(NormalEstimationTest, TestInvalidPoints)
+{
+    // an invalid point and a point without enough neighbours get a null vector
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    sphere.push_back(Base::Vector3d(nan, nan, nan));
+    sphere.push_back(Base::Vector3d(100.0, 100.0, 100.0));
+
+    Reen::NormalEstimation estimation(sphere);
+    estimation.setKSearch(10);
+    estimation.setSearchRadius(1.5);
+    std::vector<Base::Vector3d> normals;
+    estimation.perform(normals);
+
+    ASSERT_EQ(normals.size(), sphere.size());
+    EXPECT_EQ(normals[sphere.size() - 2], Base::Vector3d());
+    EXPECT_EQ(normals[sphere.size() - 1], Base::Vector3d());
+    for (std::size_t i = 0; i < sphere.size() - 2; i++) {
+        EXPECT_NEAR(normals[i].Length(), 1.0, 1e-5) << "point " << i;
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <Base/Exception.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Mesh.h>
+#include <Mod/Points/App/Points.h>
+#include <Mod/ReverseEngineering/App/SurfaceTriangulation.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class ImageTriangulationTest: public ::testing::Test
+{
+protected:
+    // a flat grid of 4 columns and 3 rows with a spacing of 1
+    static constexpr int width = 4;
+    static constexpr int height = 3;
+
+    void SetUp() override
+    {
+        for (int row = 0; row < height; row++) {
+            for (int col = 0; col < width; col++) {
+                grid.push_back(Base::Vector3d(col, row, 0.0));
+            }
+        }
+    }
+
+    void setPoint(int row, int col, const Base::Vector3d& pnt)
+    {
+        grid.setPoint(row * width + col, pnt);
+    }
+
+    void expectValidTopology() const
+    {
+        const MeshCore::MeshKernel& kernel = mesh.getKernel();
+        EXPECT_TRUE(MeshCore::MeshEvalNeighbourhood(kernel).Evaluate());
+        EXPECT_TRUE(MeshCore::MeshEvalOrientation(kernel).Evaluate());
+        EXPECT_TRUE(MeshCore::MeshEvalTopology(kernel).Evaluate());
+    }
+
+    Points::PointKernel grid;
+    Mesh::MeshObject mesh;
+};
+
+TEST_F(ImageTriangulationTest, TestFlatGrid)
+{
+    Reen::ImageTriangulation tria(width, height, grid, mesh);
+    tria.perform();
+
+    // each of the six cells is split into two triangles
+    EXPECT_EQ(mesh.countPoints(), 12);
+    EXPECT_EQ(mesh.countFacets(), 12);
+    EXPECT_FLOAT_EQ(mesh.getKernel().GetSurface(), 6.0F);
+    expectValidTopology();
+}
+
+TEST_F(ImageTriangulationTest, TestInvalidCorner)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    setPoint(0, 0, Base::Vector3d(nan, nan, nan));
+
+    Reen::ImageTriangulation tria(width, height, grid, mesh);
+    tria.perform();
+
+    // the corner cell keeps one triangle and the invalid point is dropped
+    EXPECT_EQ(mesh.countPoints(), 11);
+    EXPECT_EQ(mesh.countFacets(), 11);
+    EXPECT_FLOAT_EQ(mesh.getKernel().GetSurface(), 5.5F);
+    expectValidTopology();
+}
+
+TEST_F(ImageTriangulationTest, TestInvalidInnerPoint)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    setPoint(1, 1, Base::Vector3d(nan, nan, nan));
+
+    Reen::ImageTriangulation tria(width, height, grid, mesh);
+    tria.perform();
+
+    // the four cells around the invalid point keep one triangle each
+    EXPECT_EQ(mesh.countPoints(), 11);
+    EXPECT_EQ(mesh.countFacets(), 8);
+    EXPECT_FLOAT_EQ(mesh.getKernel().GetSurface(), 4.0F);
+    expectValidTopology();
+}
+
+TEST_F(ImageTriangulationTest, TestMaxEdgeLength)
+{
+    // lift the last corner so that the edges to it become longer than the limit
+    setPoint(height - 1, width - 1, Base::Vector3d(width - 1, height - 1, 5.0));
+
+    Reen::ImageTriangulation tria(width, height, grid, mesh);
+    tria.setMaxEdgeLength(2.0F);
+    tria.perform();
+
+    EXPECT_EQ(mesh.countPoints(), 11);
+    EXPECT_EQ(mesh.countFacets(), 11);
+    expectValidTopology();
+}
+
+TEST_F(ImageTriangulationTest, TestDepthDiscontinuity)
+{
+    // the right half of the grid is far behind the left half when seen from above
+    for (int row = 0; row < height; row++) {
+        for (int col = 2; col < width; col++) {
+            setPoint(row, col, Base::Vector3d(col, row, -10.0));
+        }
+    }
+
+    Reen::ImageTriangulation tria(width, height, grid, mesh);
+    tria.setViewpoint(Base::Vector3f(1.5F, 1.0F, 100.0F), 10.0F);
+    tria.perform();
+
+    // the cells across the step are skipped
+    EXPECT_EQ(mesh.countPoints(), 12);
+    EXPECT_EQ(mesh.countFacets(), 8);
+    expectValidTopology();
+}
+
+TEST_F(ImageTriangulationTest, TestSizeMismatch)
+{
+    Reen::ImageTriangulation tria(width + 1, height, grid, mesh);
+    EXPECT_THROW(tria.perform(), Base::RuntimeError);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)